@@ -133,6 +133,14 @@ public:
   void appendMoveInstruction(const MoveInstructionPoly& mi);
   void appendMoveInstruction(const MoveInstructionPoly&& mi);
 
+  /**
+   * @brief Append a range of move instructions
+   * @details The container is grown once for the entire range instead of once per instruction
+   * @param mis The move instructions to append
+   */
+  void appendMoveInstructions(const std::vector<MoveInstructionPoly>& mis);
+  void appendMoveInstructions(std::vector<MoveInstructionPoly>&& mis);
+
   iterator insertMoveInstruction(const_iterator p, const MoveInstructionPoly& x);
   iterator insertMoveInstruction(const_iterator p, MoveInstructionPoly&& x);
 
@@ -241,6 +249,24 @@ public:
    */
   std::vector<std::reference_wrapper<const InstructionPoly>> flatten(const flattenFilterFn& filter = nullptr) const;
 
+  /**
+   * @brief Flattens a CompositeInstruction into the provided vector
+   * @details The vector is cleared but keeps its capacity, so it can be reused to flatten without reallocating
+   * @param flattened The vector to store the references to the original instruction elements
+   * @param filter Used to filter only what should be considered. Should return true to include otherwise false
+   */
+  void flatten(std::vector<std::reference_wrapper<InstructionPoly>>& flattened,
+               const flattenFilterFn& filter = nullptr);
+
+  /**
+   * @brief Flattens a CompositeInstruction into the provided vector
+   * @details The vector is cleared but keeps its capacity, so it can be reused to flatten without reallocating
+   * @param flattened The vector to store the references to the original instruction elements
+   * @param filter Used to filter only what should be considered. Should return true to include otherwise false
+   */
+  void flatten(std::vector<std::reference_wrapper<const InstructionPoly>>& flattened,
+               const flattenFilterFn& filter = nullptr) const;
+
   bool operator==(const CompositeInstruction& rhs) const;
 
   bool operator!=(const CompositeInstruction& rhs) const;
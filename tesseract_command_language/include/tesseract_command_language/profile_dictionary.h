@@ -29,12 +29,14 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <any>
+#include <functional>
 #include <iostream>
 #include <typeindex>
 #include <unordered_map>
 #include <memory>
+#include <atomic>
 #include <mutex>
-#include <shared_mutex>
+#include <stdexcept>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
@@ -55,6 +57,11 @@ using ProfileRemapping = std::unordered_map<std::string, std::unordered_map<std:
  *      - The key is the profile name
  *      - Where std::shared_ptr<const T> is the profile
  *    The ProfleEntry<T> is also stored in std::unordered_map where the key here is the std::type_index(typeid(T))
+ *
+ *    The profiles are stored in an immutable Snapshot. Writers copy the current snapshot, modify the copy and publish
+ *    it as the new version, so readers never take the dictionary mutex. Readers resolving many profiles should call
+ *    getSnapshot() once per request and perform all lookups on the snapshot, which also guarantees a consistent view
+ *    of the profiles for the entire request.
  * @note When adding a profile entry the T should be the base class type.
  */
 class ProfileDictionary
@@ -63,6 +70,154 @@ public:
   using Ptr = std::shared_ptr<ProfileDictionary>;
   using ConstPtr = std::shared_ptr<const ProfileDictionary>;
 
+  /** @brief The profile map associated with a profile type */
+  template <typename ProfileType>
+  using ProfileEntry = std::unordered_map<std::string, std::shared_ptr<const ProfileType>>;
+
+  /** @brief An immutable version of the profile dictionary which can be read concurrently */
+  class Snapshot
+  {
+  public:
+    using ConstPtr = std::shared_ptr<const Snapshot>;
+
+    /**
+     * @brief Check if a profile entry exists
+     * @param ns The namesspace to search under
+     * @return True if exists, otherwise false
+     */
+    template <typename ProfileType>
+    bool hasProfileEntry(const std::string& ns) const
+    {
+      return (findProfileEntry<ProfileType>(ns) != nullptr);
+    }
+
+    /**
+     * @brief Get a profile entry
+     * @return The profile map associated with the profile entry
+     */
+    template <typename ProfileType>
+    const ProfileEntry<ProfileType>& getProfileEntry(const std::string& ns) const
+    {
+      auto it = profiles_.find(ns);
+      if (it == profiles_.end())
+        throw std::runtime_error("Profile namespace does not exist for '" + ns + "'!");
+
+      const ProfileEntry<ProfileType>* entry = findProfileEntry<ProfileType>(ns);
+      if (entry != nullptr)
+        return *entry;
+
+      throw std::runtime_error("Profile entry does not exist for type name '" +
+                               std::string(std::type_index(typeid(ProfileType)).name()) + "' in namespace '" + ns +
+                               "'!");
+    }
+
+    /**
+     * @brief Check if a profile exists
+     * @details If profile entry does not exist it also returns false
+     * @return True if profile exists, otherwise false
+     */
+    template <typename ProfileType>
+    bool hasProfile(const std::string& ns, const std::string& profile_name) const
+    {
+      return (findProfile<ProfileType>(ns, profile_name) != nullptr);
+    }
+
+    /**
+     * @brief Get a profile by name
+     * @details Check if the profile exist before calling this function, if missing an exception is thrown
+     * @param profile_name The profile name
+     * @return The profile
+     */
+    template <typename ProfileType>
+    std::shared_ptr<const ProfileType> getProfile(const std::string& ns, const std::string& profile_name) const
+    {
+      const auto& it = profiles_.at(ns);
+      const auto& it2 = it.at(std::type_index(typeid(ProfileType)));
+      return std::any_cast<const ProfileEntry<ProfileType>&>(it2->entry).at(profile_name);
+    }
+
+    /**
+     * @brief Find a profile by name
+     * @param ns The profile namespace
+     * @param profile_name The profile name
+     * @return The profile if it exists, otherwise nullptr
+     */
+    template <typename ProfileType>
+    std::shared_ptr<const ProfileType> findProfile(const std::string& ns, const std::string& profile_name) const
+    {
+      const ProfileEntry<ProfileType>* entry = findProfileEntry<ProfileType>(ns);
+      if (entry == nullptr)
+        return nullptr;
+
+      auto it = entry->find(profile_name);
+      if (it == entry->end())
+        return nullptr;
+
+      return it->second;
+    }
+
+    /**
+     * @brief Call a function for every profile in the snapshot, in no particular order
+     * @details Profiles are immutable, so snapshots holding the same profile objects under the same names are
+     * equivalent even if they belong to different dictionaries.
+     * @param fn The function called with the namespace, profile type, profile name and profile
+     */
+    void forEachProfile(const std::function<void(const std::string& ns,
+                                                 const std::type_index& type,
+                                                 const std::string& profile_name,
+                                                 const std::shared_ptr<const void>& profile)>& fn) const
+    {
+      for (const auto& ns : profiles_)
+      {
+        for (const auto& entry : ns.second)
+        {
+          for (const auto& profile : entry.second->profiles)
+            fn(ns.first, entry.first, profile.first, profile.second);
+        }
+      }
+    }
+
+  private:
+    friend class ProfileDictionary;
+
+    /** @brief A profile entry and a type erased view of its profiles */
+    struct StoredEntry
+    {
+      /** @brief The ProfileEntry<ProfileType> */
+      std::any entry;
+
+      /** @brief The same profiles without their type, used to enumerate them */
+      std::unordered_map<std::string, std::shared_ptr<const void>> profiles;
+    };
+
+    /**
+     * @brief The profiles stored by namespace and profile type
+     * @details Each profile entry is shared between snapshots and only copied when it is modified
+     */
+    std::unordered_map<std::string, std::unordered_map<std::type_index, std::shared_ptr<const StoredEntry>>> profiles_;
+
+    template <typename ProfileType>
+    const ProfileEntry<ProfileType>* findProfileEntry(const std::string& ns) const
+    {
+      auto it = profiles_.find(ns);
+      if (it == profiles_.end())
+        return nullptr;
+
+      auto it2 = it->second.find(std::type_index(typeid(ProfileType)));
+      if (it2 == it->second.end())
+        return nullptr;
+
+      return std::any_cast<ProfileEntry<ProfileType>>(&it2->second->entry);
+    }
+  };
+
+  /**
+   * @brief Get the current version of the profiles
+   * @details The snapshot is immutable and is not affected by later changes to the dictionary
+   * @return The current snapshot
+   */
+  Snapshot::ConstPtr getSnapshot() const { return std::atomic_load(&snapshot_); }
+
   /**
    * @brief Check if a profile entry exists
    * @param ns The namesspace to search under
@@ -71,25 +226,21 @@ public:
   template <typename ProfileType>
   bool hasProfileEntry(const std::string& ns) const
   {
-    std::shared_lock lock(mutex_);
-    auto it = profiles_.find(ns);
-    if (it == profiles_.end())
-      return false;
-
-    return (it->second.find(std::type_index(typeid(ProfileType))) != it->second.end());
+    return getSnapshot()->hasProfileEntry<ProfileType>(ns);
   }
 
   /** @brief Remove a profile entry */
   template <typename ProfileType>
   void removeProfileEntry(const std::string& ns)
   {
-    std::unique_lock lock(mutex_);
-
-    auto it = profiles_.find(ns);
-    if (it == profiles_.end())
+    std::scoped_lock lock(mutex_);
+    auto it = snapshot_->profiles_.find(ns);
+    if (it == snapshot_->profiles_.end())
       return;
 
-    it->second.erase(std::type_index(typeid(ProfileType)));
+    auto next = std::make_shared<Snapshot>(*snapshot_);
+    next->profiles_[ns].erase(std::type_index(typeid(ProfileType)));
+    publish(std::move(next));
   }
 
   /**
@@ -97,19 +248,9 @@ public:
    * @return The profile map associated with the profile entry
    */
   template <typename ProfileType>
-  std::unordered_map<std::string, std::shared_ptr<const ProfileType>> getProfileEntry(const std::string& ns) const
+  ProfileEntry<ProfileType> getProfileEntry(const std::string& ns) const
   {
-    std::shared_lock lock(mutex_);
-    auto it = profiles_.find(ns);
-    if (it == profiles_.end())
-      throw std::runtime_error("Profile namespace does not exist for '" + ns + "'!");
-
-    auto it2 = it->second.find(std::type_index(typeid(ProfileType)));
-    if (it2 != it->second.end())
-      return std::any_cast<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it2->second);
-
-    throw std::runtime_error("Profile entry does not exist for type name '" +
-                             std::string(std::type_index(typeid(ProfileType)).name()) + "' in namespace '" + ns + "'!");
+    return getSnapshot()->getProfileEntry<ProfileType>(ns);
   }
 
   /**
@@ -131,29 +272,15 @@ public:
     if (profile == nullptr)
       throw std::runtime_error("Adding profile that is a nullptr");
 
-    std::unique_lock lock(mutex_);
-    auto it = profiles_.find(ns);
-    if (it == profiles_.end())
-    {
-      std::unordered_map<std::string, std::shared_ptr<const ProfileType>> new_entry;
-      new_entry[profile_name] = profile;
-      profiles_[ns][std::type_index(typeid(ProfileType))] = new_entry;
-    }
-    else
-    {
-      auto it2 = it->second.find(std::type_index(typeid(ProfileType)));
-      if (it2 != it->second.end())
-      {
-        std::any_cast<std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it2->second)[profile_name] =
-            profile;
-      }
-      else
-      {
-        std::unordered_map<std::string, std::shared_ptr<const ProfileType>> new_entry;
-        new_entry[profile_name] = profile;
-        it->second[std::type_index(typeid(ProfileType))] = new_entry;
-      }
-    }
+    std::scoped_lock lock(mutex_);
+    auto next = std::make_shared<Snapshot>(*snapshot_);
+    ProfileEntry<ProfileType> entry;
+    if (const ProfileEntry<ProfileType>* current_entry = snapshot_->findProfileEntry<ProfileType>(ns))
+      entry = *current_entry;
+
+    entry[profile_name] = std::move(profile);
+    next->profiles_[ns][std::type_index(typeid(ProfileType))] = createStoredEntry<ProfileType>(std::move(entry));
+    publish(std::move(next));
   }
 
   /**
@@ -164,21 +291,7 @@ public:
   template <typename ProfileType>
   bool hasProfile(const std::string& ns, const std::string& profile_name) const
   {
-    std::shared_lock lock(mutex_);
-    auto it = profiles_.find(ns);
-    if (it == profiles_.end())
-      return false;
-
-    auto it2 = it->second.find(std::type_index(typeid(ProfileType)));
-    if (it2 != it->second.end())
-    {
-      const auto& profile_map =
-          std::any_cast<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it2->second);
-      auto it3 = profile_map.find(profile_name);
-      if (it3 != profile_map.end())
-        return true;
-    }
-    return false;
+    return getSnapshot()->hasProfile<ProfileType>(ns, profile_name);
   }
 
   /**
@@ -190,12 +303,20 @@ public:
   template <typename ProfileType>
   std::shared_ptr<const ProfileType> getProfile(const std::string& ns, const std::string& profile_name) const
   {
-    std::shared_lock lock(mutex_);
-    const auto& it = profiles_.at(ns);
-    const auto& it2 = it.at(std::type_index(typeid(ProfileType)));
-    const auto& profile_map =
-        std::any_cast<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it2);
-    return profile_map.at(profile_name);
+    return getSnapshot()->getProfile<ProfileType>(ns, profile_name);
+  }
+
+  /**
+   * @brief Find a profile by name
+   * @details Unlike hasProfile followed by getProfile this only loads the current snapshot once
+   * @param ns The profile namespace
+   * @param profile_name The profile name
+   * @return The profile if it exists, otherwise nullptr
+   */
+  template <typename ProfileType>
+  std::shared_ptr<const ProfileType> findProfile(const std::string& ns, const std::string& profile_name) const
+  {
+    return getSnapshot()->findProfile<ProfileType>(ns, profile_name);
   }
 
   /**
@@ -205,20 +326,43 @@ public:
   template <typename ProfileType>
   void removeProfile(const std::string& ns, const std::string& profile_name)
   {
-    std::unique_lock lock(mutex_);
-    auto it = profiles_.find(ns);
-    if (it == profiles_.end())
+    std::scoped_lock lock(mutex_);
+    const ProfileEntry<ProfileType>* current_entry = snapshot_->findProfileEntry<ProfileType>(ns);
+    if (current_entry == nullptr || current_entry->find(profile_name) == current_entry->end())
       return;
 
-    auto it2 = it->second.find(std::type_index(typeid(ProfileType)));
-    if (it2 != it->second.end())
-      std::any_cast<std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it2->second)
-          .erase(profile_name);
+    ProfileEntry<ProfileType> entry = *current_entry;
+    entry.erase(profile_name);
+
+    auto next = std::make_shared<Snapshot>(*snapshot_);
+    next->profiles_[ns][std::type_index(typeid(ProfileType))] = createStoredEntry<ProfileType>(std::move(entry));
+    publish(std::move(next));
   }
 
 protected:
-  std::unordered_map<std::string, std::unordered_map<std::type_index, std::any>> profiles_;
-  mutable std::shared_mutex mutex_;
+  /** @brief The current version of the profiles, this must only be replaced using publish() */
+  Snapshot::ConstPtr snapshot_{ std::make_shared<const Snapshot>() };
+
+  /** @brief Serializes writers, readers never take this mutex */
+  mutable std::mutex mutex_;
+
+  /** @brief Store a profile entry along with the type erased view of its profiles */
+  template <typename ProfileType>
+  static std::shared_ptr<const Snapshot::StoredEntry> createStoredEntry(ProfileEntry<ProfileType> entry)
+  {
+    auto stored = std::make_shared<Snapshot::StoredEntry>();
+    for (const auto& profile : entry)
+      stored->profiles.emplace(profile.first, profile.second);
+
+    stored->entry = std::move(entry);
+    return stored;
+  }
+
+  /** @brief Publish a new version of the profiles, the caller must hold the mutex */
+  void publish(std::shared_ptr<Snapshot> snapshot)
+  {
+    std::atomic_store(&snapshot_, Snapshot::ConstPtr(std::move(snapshot)));
+  }
 };
 }  // namespace tesseract_planning
 
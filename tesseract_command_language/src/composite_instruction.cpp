@@ -26,6 +26,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <boost/serialization/nvp.hpp>
@@ -46,6 +47,30 @@ bool moveFilter(const InstructionPoly& instruction, const CompositeInstruction&
   return instruction.isMoveInstruction();
 }
 
+namespace
+{
+/** @brief Check if the filter is moveFilter, which is the most common filter and can be evaluated inline */
+bool isMoveFilter(const flattenFilterFn& filter)
+{
+  using FilterFnPtr = bool (*)(const InstructionPoly&, const CompositeInstruction&);
+  const FilterFnPtr* fn = filter.target<FilterFnPtr>();
+  return (fn != nullptr && *fn == &moveFilter);
+}
+
+/** @brief Flatten the move instructions without calling the filter through std::function for every instruction */
+template <typename Flattened, typename Composite>
+void flattenMoveInstructions(Flattened& flattened, Composite& composite)
+{
+  for (auto& i : composite.getInstructions())
+  {
+    if (i.isCompositeInstruction())
+      flattenMoveInstructions(flattened, i.template as<CompositeInstruction>());
+    else if (i.isMoveInstruction())
+      flattened.emplace_back(i);
+  }
+}
+}  // namespace
+
 CompositeInstruction::CompositeInstruction(std::string profile,
                                            CompositeInstructionOrder order,
                                            tesseract_common::ManipulatorInfo manipulator_info)
@@ -104,6 +129,33 @@ void CompositeInstruction::appendMoveInstruction(const MoveInstructionPoly& mi)
 
 void CompositeInstruction::appendMoveInstruction(const MoveInstructionPoly&& mi) { container_.emplace_back(mi); }
 
+/**
+ * @brief Reserve space to append n elements
+ * @details The capacity still grows geometrically so repeated bulk appends remain amortized constant per element
+ */
+static void reserveAppend(std::vector<InstructionPoly>& container, std::size_t n)
+{
+  const std::size_t required = container.size() + n;
+  if (required > container.capacity())
+    container.reserve(std::max(required, 2 * container.capacity()));
+}
+
+void CompositeInstruction::appendMoveInstructions(const std::vector<MoveInstructionPoly>& mis)
+{
+  reserveAppend(container_, mis.size());
+  for (const auto& mi : mis)
+    container_.emplace_back(mi);
+}
+
+void CompositeInstruction::appendMoveInstructions(std::vector<MoveInstructionPoly>&& mis)
+{
+  reserveAppend(container_, mis.size());
+  for (auto& mi : mis)
+    container_.emplace_back(std::move(mi));
+
+  mis.clear();
+}
+
 CompositeInstruction::iterator CompositeInstruction::insertMoveInstruction(const_iterator p,
                                                                            const MoveInstructionPoly& x)
 {
@@ -184,7 +236,7 @@ long CompositeInstruction::getInstructionCount(const locateFilterFn& locate_filt
 std::vector<std::reference_wrapper<InstructionPoly>> CompositeInstruction::flatten(const flattenFilterFn& filter)
 {
   std::vector<std::reference_wrapper<InstructionPoly>> flattened;
-  flattenHelper(flattened, *this, filter);
+  flatten(flattened, filter);
   return flattened;
 }
 
@@ -192,10 +244,30 @@ std::vector<std::reference_wrapper<const InstructionPoly>>
 CompositeInstruction::flatten(const flattenFilterFn& filter) const
 {
   std::vector<std::reference_wrapper<const InstructionPoly>> flattened;
-  flattenHelper(flattened, *this, filter);
+  flatten(flattened, filter);
   return flattened;
 }
 
+void CompositeInstruction::flatten(std::vector<std::reference_wrapper<InstructionPoly>>& flattened,
+                                   const flattenFilterFn& filter)
+{
+  flattened.clear();
+  if (isMoveFilter(filter))
+    flattenMoveInstructions(flattened, *this);
+  else
+    flattenHelper(flattened, *this, filter);
+}
+
+void CompositeInstruction::flatten(std::vector<std::reference_wrapper<const InstructionPoly>>& flattened,
+                                   const flattenFilterFn& filter) const
+{
+  flattened.clear();
+  if (isMoveFilter(filter))
+    flattenMoveInstructions(flattened, *this);
+  else
+    flattenHelper(flattened, *this, filter);
+}
+
 void CompositeInstruction::print(const std::string& prefix) const
 {
   std::cout << prefix + "Composite Instruction, Description: " << getDescription() << std::endl;
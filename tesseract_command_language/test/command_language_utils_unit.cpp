@@ -154,6 +154,35 @@ TEST(TesseractCommandLanguageUtilsUnit, flatten)  // NOLINT
       }
     }
   }
+
+  // flatten(composite, moveFilter) into a reused buffer
+  {
+    composite.push_back(WaitInstruction(1.5));
+
+    std::vector<std::reference_wrapper<const InstructionPoly>> flattened;
+    const CompositeInstruction& const_composite = composite;
+    const_composite.flatten(flattened, moveFilter);
+    EXPECT_EQ(flattened.size(), i_max * j_max * k_max);
+    for (const auto& i : flattened)
+      EXPECT_TRUE(i.get().isMoveInstruction());
+
+    // The buffer is cleared and matches a filter which is not moveFilter
+    flattenFilterFn filter = [](const InstructionPoly& i, const CompositeInstruction&) {
+      return i.isMoveInstruction();
+    };
+    std::vector<std::reference_wrapper<const InstructionPoly>> expected = const_composite.flatten(filter);
+    const_composite.flatten(flattened, moveFilter);
+    ASSERT_EQ(flattened.size(), expected.size());
+    for (std::size_t i = 0; i < flattened.size(); ++i)
+      EXPECT_EQ(&flattened[i].get(), &expected[i].get());
+
+    // Without a filter the wait instruction is included
+    std::vector<std::reference_wrapper<InstructionPoly>> mutable_flattened;
+    composite.flatten(mutable_flattened);
+    EXPECT_EQ(mutable_flattened.size(), i_max * j_max * k_max + 1);
+    composite.flatten(mutable_flattened, moveFilter);
+    EXPECT_EQ(mutable_flattened.size(), i_max * j_max * k_max);
+  }
 }
 
 TEST(TesseractCommandLanguageUtilsUnit, toJointTrajectoryTests)  // NOLINT
@@ -416,4 +416,67 @@ static void BM_VectorStateWaypointUPtrCopy(benchmark::State& state)
 
 BENCHMARK(BM_VectorStateWaypointUPtrCopy);
 
+/** @brief Create a program with many raster programs */
+CompositeInstruction getLargeProgram()
+{
+  CompositeInstruction program;
+  const CompositeInstruction raster_program = getProgram();
+  for (std::size_t i = 0; i < 100; ++i)
+    program.push_back(raster_program);
+
+  return program;
+}
+
+static void BM_CompositeInstructionFlatten(benchmark::State& state)
+{
+  const CompositeInstruction program = getLargeProgram();
+  for (auto _ : state)
+  {
+    auto flattened = program.flatten();
+    benchmark::DoNotOptimize(flattened.data());
+  }
+}
+
+BENCHMARK(BM_CompositeInstructionFlatten);
+
+static void BM_CompositeInstructionFlattenFilter(benchmark::State& state)
+{
+  const CompositeInstruction program = getLargeProgram();
+  const flattenFilterFn filter = [](const InstructionPoly& instruction, const CompositeInstruction& /*composite*/) {
+    return instruction.isMoveInstruction();
+  };
+  for (auto _ : state)
+  {
+    auto flattened = program.flatten(filter);
+    benchmark::DoNotOptimize(flattened.data());
+  }
+}
+
+BENCHMARK(BM_CompositeInstructionFlattenFilter);
+
+static void BM_CompositeInstructionFlattenMoveFilter(benchmark::State& state)
+{
+  const CompositeInstruction program = getLargeProgram();
+  for (auto _ : state)
+  {
+    auto flattened = program.flatten(moveFilter);
+    benchmark::DoNotOptimize(flattened.data());
+  }
+}
+
+BENCHMARK(BM_CompositeInstructionFlattenMoveFilter);
+
+static void BM_CompositeInstructionFlattenMoveFilterBuffer(benchmark::State& state)
+{
+  const CompositeInstruction program = getLargeProgram();
+  std::vector<std::reference_wrapper<const InstructionPoly>> flattened;
+  for (auto _ : state)
+  {
+    program.flatten(flattened, moveFilter);
+    benchmark::DoNotOptimize(flattened.data());
+  }
+}
+
+BENCHMARK(BM_CompositeInstructionFlattenMoveFilterBuffer);
+
 BENCHMARK_MAIN();
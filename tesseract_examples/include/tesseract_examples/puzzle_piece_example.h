@@ -44,8 +44,15 @@ namespace tesseract_examples
 class PuzzlePieceExample : public Example
 {
 public:
+  /**
+   * @brief Constructor
+   * @param env The environment
+   * @param plotter The plotter
+   * @param window_size If greater than zero the path is solved as overlapping trajopt windows of this size
+   */
   PuzzlePieceExample(tesseract_environment::Environment::Ptr env,
-                     tesseract_visualization::Visualization::Ptr plotter = nullptr);
+                     tesseract_visualization::Visualization::Ptr plotter = nullptr,
+                     int window_size = 0);
   ~PuzzlePieceExample() override = default;
   PuzzlePieceExample(const PuzzlePieceExample&) = default;
   PuzzlePieceExample& operator=(const PuzzlePieceExample&) = default;
@@ -55,6 +62,7 @@ public:
   bool run() override final;
 
 private:
+  int window_size_;
   static tesseract_common::VectorIsometry3d
   makePuzzleToolPoses(const tesseract_common::ResourceLocator::ConstPtr& locator);
 };
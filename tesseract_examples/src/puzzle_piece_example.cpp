@@ -123,8 +123,9 @@ PuzzlePieceExample::makePuzzleToolPoses(const tesseract_common::ResourceLocator:
 }
 
 PuzzlePieceExample::PuzzlePieceExample(tesseract_environment::Environment::Ptr env,
-                                       tesseract_visualization::Visualization::Ptr plotter)
-  : Example(std::move(env), std::move(plotter))
+                                       tesseract_visualization::Visualization::Ptr plotter,
+                                       int window_size)
+  : Example(std::move(env), std::move(plotter)), window_size_(window_size)
 {
 }
 
@@ -209,6 +210,7 @@ bool PuzzlePieceExample::run()
   trajopt_solver_profile->opt_info.max_iter = 200;
   trajopt_solver_profile->opt_info.min_approx_improve = 1e-3;
   trajopt_solver_profile->opt_info.min_trust_box_size = 1e-3;
+  trajopt_solver_profile->window.window_size = window_size_;
 
   // Create profile dictionary
   auto profiles = std::make_shared<ProfileDictionary>();
@@ -241,6 +243,18 @@ bool PuzzlePieceExample::run()
   stopwatch.stop();
   CONSOLE_BRIDGE_logInform("Planning took %f seconds.", stopwatch.elapsedSeconds());
 
+  // Report the joint path length so the quality of different solver settings can be compared
+  if (input.isSuccessful())
+  {
+    auto ci = input.data_storage.getData(output_key).as<CompositeInstruction>();
+    tesseract_common::JointTrajectory trajectory = toJointTrajectory(ci);
+    double path_length{ 0 };
+    for (std::size_t i = 1; i < trajectory.size(); ++i)
+      path_length += (trajectory[i].position - trajectory[i - 1].position).norm();
+
+    CONSOLE_BRIDGE_logInform("Joint path length %f radians (trajopt window size %d).", path_length, window_size_);
+  }
+
   // Plot Process Trajectory
   if (plotter_ != nullptr && plotter_->isConnected())
   {
@@ -45,4 +45,9 @@ int main(int /*argc*/, char** /*argv*/)
   PuzzlePieceExample example(env, nullptr);
   if (!example.run())
     exit(1);
+
+  // Solve the same path as overlapping windows to compare planning time and path length
+  PuzzlePieceExample windowed_example(env, nullptr, 20);
+  if (!windowed_example.run())
+    exit(1);
 }
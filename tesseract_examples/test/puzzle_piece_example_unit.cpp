@@ -25,6 +25,21 @@ TEST(TesseractExamples, PuzzlePieceCppExampleUnit)  // NOLINT
   EXPECT_TRUE(example.run());
 }
 
+TEST(TesseractExamples, PuzzlePieceWindowedCppExampleUnit)  // NOLINT
+{
+  auto locator = std::make_shared<TesseractSupportResourceLocator>();
+  tesseract_common::fs::path urdf_path =
+      locator->locateResource("package://tesseract_support/urdf/puzzle_piece_workcell.urdf")->getFilePath();
+  tesseract_common::fs::path srdf_path =
+      locator->locateResource("package://tesseract_support/urdf/puzzle_piece_workcell.srdf")->getFilePath();
+  auto env = std::make_shared<Environment>();
+  if (!env->init(urdf_path, srdf_path, locator))
+    exit(1);
+
+  PuzzlePieceExample example(env, nullptr, 20);
+  EXPECT_TRUE(example.run());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
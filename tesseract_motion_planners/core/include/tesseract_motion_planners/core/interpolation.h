@@ -423,6 +423,19 @@ tesseract_common::VectorIsometry3d interpolate(const Eigen::Isometry3d& start,
                                                const Eigen::Isometry3d& stop,
                                                long steps);
 
+/**
+ * @brief Interpolate between two transforms into the provided buffer
+ * @details The buffer is resized to steps + 1, so reusing the buffer across calls avoids reallocation
+ * @param start The Start Transform
+ * @param stop The Stop/End Transform
+ * @param steps The number of step
+ * @param result The buffer to store the transforms with a length = steps + 1
+ */
+void interpolate(const Eigen::Isometry3d& start,
+                 const Eigen::Isometry3d& stop,
+                 long steps,
+                 tesseract_common::VectorIsometry3d& result);
+
 /**
  * @brief Interpolate between two Eigen::VectorXd and return a Matrix
  * @param start The Start State
@@ -434,6 +447,19 @@ Eigen::MatrixXd interpolate(const Eigen::Ref<const Eigen::VectorXd>& start,
                             const Eigen::Ref<const Eigen::VectorXd>& stop,
                             long steps);
 
+/**
+ * @brief Interpolate between two Eigen::VectorXd into the provided buffer
+ * @details Each state is written as a contiguous column, so this can write directly into a block of a larger matrix
+ * @param start The Start State
+ * @param stop The Stop/End State
+ * @param steps The number of step
+ * @param result The buffer to store the states, this must have rows = start.size() and columns = steps + 1
+ */
+void interpolate(const Eigen::Ref<const Eigen::VectorXd>& start,
+                 const Eigen::Ref<const Eigen::VectorXd>& stop,
+                 long steps,
+                 Eigen::Ref<Eigen::MatrixXd> result);
+
 /**
  * @brief Interpolate between two waypoints return a vector of waypoints.
  * @param start The Start Waypoint
@@ -488,6 +514,24 @@ std::array<Eigen::VectorXd, 2> getClosestJointSolution(const KinematicGroupInstr
                                                        const KinematicGroupInstructionInfo& info2,
                                                        const Eigen::VectorXd& seed);
 
+/**
+ * @brief Find the closest joint solution for a sequence of cartesian poses, like the waypoints of a raster
+ * @details Solutions which can not satisfy the limits and duplicate configurations are removed before the redundant
+ * solutions are expanded. Each pose selects the solution nearest to the solution selected for the previous pose,
+ * which is also used as the inverse kinematics seed.
+ * @param manip The kinematic group used to solve inverse kinematics
+ * @param poses The tcp poses relative to the working frame
+ * @param working_frame The working frame of the poses
+ * @param tcp_frame The tcp frame
+ * @param seed The seed used for the first pose
+ * @return The closest joint solution for each pose. An entry is empty if it failed to solve inverse kinematics.
+ */
+std::vector<Eigen::VectorXd> getClosestJointSolutions(const tesseract_kinematics::KinematicGroup& manip,
+                                                      const tesseract_common::VectorIsometry3d& poses,
+                                                      const std::string& working_frame,
+                                                      const std::string& tcp_frame,
+                                                      const Eigen::VectorXd& seed);
+
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_MOTION_PLANNERS_INTERPOLATION_H
@@ -94,6 +94,15 @@ struct PlannerRequest
    * will be used if it is not null
    */
   std::shared_ptr<void> data;
+
+  /**
+   * @brief If true the planner problem provided in data is updated from the instructions before it is solved
+   * @details Only the waypoint targets and the seed are updated, so the instructions must have the same structure as
+   * the instructions used to create the problem. The previous solution is used as the seed (warm start). If the problem
+   * can not be updated a new problem is created. The problem in data is not modified, the updated problem is returned
+   * in the response data.
+   */
+  bool update_data{ false };
 };
 
 struct PlannerResponse
@@ -30,6 +30,9 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
 #include <console_bridge/console.h>
+#include <map>
+#include <vector>
+#include <functional>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/constants.h>
@@ -38,6 +41,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/robot_config.h>
 #include <tesseract_motion_planners/core/types.h>
 #include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_command_language/poly/move_instruction_poly.h>
 
 namespace tesseract_planning
 {
@@ -134,8 +138,12 @@ std::shared_ptr<const ProfileType> getProfile(const std::string& ns,
                                               const ProfileDictionary& profile_dictionary,
                                               std::shared_ptr<const ProfileType> default_profile = nullptr)
 {
-  if (profile_dictionary.hasProfile<ProfileType>(ns, profile))
-    return profile_dictionary.getProfile<ProfileType>(ns, profile);
+  if (auto found = profile_dictionary.findProfile<ProfileType>(ns, profile))
+    return found;
+
+  // Only gather the available profiles when they will actually be logged
+  if (console_bridge::getLogLevel() > console_bridge::CONSOLE_BRIDGE_LOG_DEBUG)
+    return default_profile;
 
   CONSOLE_BRIDGE_logDebug("Profile '%s' was not found in namespace '%s' for type '%s'. Using default if available. "
                           "Available "
@@ -179,6 +187,128 @@ std::shared_ptr<const ProfileType> applyProfileOverrides(const std::string& ns,
   return nominal_profile;
 }
 
+/**
+ * @brief Resolves profiles for a single request, remembering every profile it has already resolved
+ * @details Each unique profile name and override dictionary pair is resolved once, taking into account remapping,
+ * the profile dictionary and overrides, so looking up the same profile for thousands of instructions only costs a
+ * single lookup. All misses share the same default profile instance.
+ *
+ * The resolver takes a snapshot of the profile dictionary on construction so lookups do not touch the dictionary
+ * mutex and see a consistent set of profiles even if the dictionary is modified while the request is being processed.
+ * @note This is not thread safe and is intended to be used on the stack for the duration of a single request. The
+ * profile remapping must outlive the resolver.
+ */
+template <typename ProfileType>
+class ProfileResolver
+{
+public:
+  /**
+   * @brief Constructor
+   * @param ns The namespace to search for requested profiles
+   * @param profile_dictionary The dictionary that contains the profiles
+   * @param profile_remapping Remapping used to remap a profile name based on the namespace
+   * @param default_profile Profile that is returned if the requested profile is not found. Default = nullptr
+   */
+  ProfileResolver(std::string ns,
+                  const ProfileDictionary& profile_dictionary,
+                  const PlannerProfileRemapping& profile_remapping,
+                  std::shared_ptr<const ProfileType> default_profile = nullptr)
+    : ns_(std::move(ns))
+    , profiles_(profile_dictionary.getSnapshot())
+    , profile_remapping_(profile_remapping)
+    , default_profile_(std::move(default_profile))
+  {
+  }
+
+  /**
+   * @brief Resolve a profile
+   * @param profile The requested profile name in the instruction
+   * @param overrides The profile overrides of the instruction. Default = nullptr
+   * @return The resolved profile, otherwise the default profile
+   */
+  std::shared_ptr<const ProfileType> resolve(const std::string& profile,
+                                             const ProfileDictionary::ConstPtr& overrides = nullptr)
+  {
+    auto key = std::make_pair(profile, overrides.get());
+    auto it = cache_.find(key);
+    if (it != cache_.end())
+      return it->second;
+
+    std::string profile_string = getProfileString(ns_, profile, profile_remapping_);
+    std::shared_ptr<const ProfileType> resolved = profiles_->findProfile<ProfileType>(ns_, profile_string);
+    if (resolved == nullptr)
+    {
+      CONSOLE_BRIDGE_logDebug("Profile '%s' was not found in namespace '%s' for type '%s'. Using default if available.",
+                              profile_string.c_str(),
+                              ns_.c_str(),
+                              typeid(ProfileType).name());
+      resolved = default_profile_;
+    }
+
+    if (overrides != nullptr)
+    {
+      if (auto override_profile = overrides->findProfile<ProfileType>(ns_, profile_string))
+        resolved = std::move(override_profile);
+    }
+
+    cache_.emplace(std::move(key), resolved);
+    return resolved;
+  }
+
+  /** @brief Get the default profile shared by all unresolved profiles */
+  const std::shared_ptr<const ProfileType>& getDefaultProfile() const { return default_profile_; }
+
+private:
+  std::string ns_;
+  ProfileDictionary::Snapshot::ConstPtr profiles_;
+  const PlannerProfileRemapping& profile_remapping_;
+  std::shared_ptr<const ProfileType> default_profile_;
+  std::map<std::pair<std::string, const ProfileDictionary*>, std::shared_ptr<const ProfileType>> cache_;
+};
+
+/**
+ * @brief An immutable table of the resolved profiles for each move instruction of a request
+ * @details The profile at index i corresponds to move_instructions[i] and may be nullptr if no profile was found and
+ * no default profile was provided.
+ */
+template <typename ProfileType>
+class ProfileTable
+{
+public:
+  /**
+   * @brief Resolve the profile for every move instruction
+   * @param move_instructions The flattened move instructions (const or mutable instruction references)
+   * @param resolver The resolver used to look up the profiles
+   * @param use_path_profile If true the path profile of an instruction is used when it is not empty
+   */
+  template <typename InstructionRefs>
+  ProfileTable(const InstructionRefs& move_instructions,
+               ProfileResolver<ProfileType>& resolver,
+               bool use_path_profile = false)
+  {
+    profiles_.reserve(move_instructions.size());
+    for (const auto& instruction : move_instructions)
+    {
+      const auto& mi = instruction.get().as<MoveInstructionPoly>();
+      const std::string& profile =
+          (use_path_profile && !mi.getPathProfile().empty()) ? mi.getPathProfile() : mi.getProfile();
+      profiles_.push_back(resolver.resolve(profile, mi.getProfileOverrides()));
+    }
+  }
+
+  /** @brief Get the resolved profile for the move instruction at index */
+  const std::shared_ptr<const ProfileType>& operator[](std::size_t index) const { return profiles_[index]; }
+
+  /** @brief Get the resolved profile for the move instruction at index, throws if out of range */
+  const std::shared_ptr<const ProfileType>& at(std::size_t index) const { return profiles_.at(index); }
+
+  /** @brief The number of resolved profiles */
+  std::size_t size() const { return profiles_.size(); }
+
+private:
+  std::vector<std::shared_ptr<const ProfileType>> profiles_;
+};
+
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_MOTION_PLANNERS_PLANNER_UTILS_H
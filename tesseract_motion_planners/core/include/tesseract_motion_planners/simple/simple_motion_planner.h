@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/core/planner.h>
 #include <tesseract_motion_planners/simple/profile/simple_planner_profile.h>
+#include <tesseract_motion_planners/planner_utils.h>
 
 namespace tesseract_planning
 {
@@ -71,7 +72,8 @@ protected:
   CompositeInstruction processCompositeInstruction(const CompositeInstruction& instructions,
                                                    MoveInstructionPoly& prev_instruction,
                                                    MoveInstructionPoly& prev_seed,
-                                                   const PlannerRequest& request) const;
+                                                   const PlannerRequest& request,
+                                                   ProfileResolver<SimplePlannerPlanProfile>& profile_resolver) const;
 };
 
 }  // namespace tesseract_planning
@@ -24,6 +24,13 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_motion_planners/core/interpolation.h>
 #include <tesseract_command_language/utils.h>
 #include <tesseract_kinematics/core/utils.h>
@@ -929,12 +936,20 @@ std::vector<MoveInstructionPoly> interpolateCartCartWaypoint(const JointGroupIns
 tesseract_common::VectorIsometry3d interpolate(const Eigen::Isometry3d& start,
                                                const Eigen::Isometry3d& stop,
                                                long steps)
+{
+  tesseract_common::VectorIsometry3d result;
+  interpolate(start, stop, steps, result);
+  return result;
+}
+
+void interpolate(const Eigen::Isometry3d& start,
+                 const Eigen::Isometry3d& stop,
+                 long steps,
+                 tesseract_common::VectorIsometry3d& result)
 {
   // Required position change
   Eigen::Vector3d delta_translation = (stop.translation() - start.translation());
   Eigen::Vector3d start_pos = start.translation();
-  Eigen::Affine3d stop_prime = start.inverse() * stop;
-  Eigen::AngleAxisd delta_rotation(stop_prime.rotation());
 
   // Step size
   Eigen::Vector3d step = delta_translation / steps;
@@ -944,33 +959,47 @@ tesseract_common::VectorIsometry3d interpolate(const Eigen::Isometry3d& start,
   Eigen::Quaterniond stop_q(stop.rotation());
   double slerp_ratio = 1.0 / static_cast<double>(steps);
 
-  tesseract_common::VectorIsometry3d result;
-  Eigen::Vector3d trans;
-  Eigen::Quaterniond q;
-  Eigen::Isometry3d pose;
-  result.reserve(static_cast<size_t>(steps) + 1);
+  result.resize(static_cast<std::size_t>(steps) + 1);
   for (unsigned i = 0; i <= static_cast<unsigned>(steps); ++i)
   {
-    trans = start_pos + step * i;
-    q = start_q.slerp(slerp_ratio * i, stop_q);
-    pose = (Eigen::Translation3d(trans) * q);
-    result.push_back(pose);
+    Eigen::Isometry3d& pose = result[i];
+    pose.linear() = start_q.slerp(slerp_ratio * i, stop_q).toRotationMatrix();
+    pose.translation() = start_pos + step * i;
+    pose.makeAffine();
   }
-  return result;
 }
 
 Eigen::MatrixXd interpolate(const Eigen::Ref<const Eigen::VectorXd>& start,
                             const Eigen::Ref<const Eigen::VectorXd>& stop,
                             long steps)
+{
+  Eigen::MatrixXd result(start.size(), steps + 1);
+  interpolate(start, stop, steps, result);
+  return result;
+}
+
+void interpolate(const Eigen::Ref<const Eigen::VectorXd>& start,
+                 const Eigen::Ref<const Eigen::VectorXd>& stop,
+                 long steps,
+                 Eigen::Ref<Eigen::MatrixXd> result)
 {
   assert(start.size() == stop.size());
+  assert(result.rows() == start.size() && result.cols() == steps + 1);
 
-  Eigen::MatrixXd result(start.size(), steps + 1);
+  if (steps < 1)
+  {
+    result.col(0) = stop;
+    return;
+  }
 
-  for (int i = 0; i < start.size(); ++i)
-    result.row(i) = Eigen::VectorXd::LinSpaced(steps + 1, start(i), stop(i));
+  // The second half is computed from the stop state so both end points are exact
+  const Eigen::VectorXd delta = (stop - start) / static_cast<double>(steps);
+  const long half = (steps + 1) / 2;
+  for (long i = 0; i < half; ++i)
+    result.col(i) = start + static_cast<double>(i) * delta;
 
-  return result;
+  for (long i = half; i <= steps; ++i)
+    result.col(i) = stop - static_cast<double>(steps - i) * delta;
 }
 
 std::vector<WaypointPoly> interpolate_waypoint(const WaypointPoly& start, const WaypointPoly& stop, long steps)
@@ -1021,30 +1050,33 @@ std::vector<MoveInstructionPoly> getInterpolatedInstructions(const std::vector<s
                                                              const Eigen::MatrixXd& states,
                                                              const MoveInstructionPoly& base_instruction)
 {
+  // Create the child prototype once, each interpolated instruction is a copy with a new uuid and position
+  MoveInstructionPoly prototype = base_instruction.createChild();
+  JointWaypointPoly prototype_jwp = prototype.createJointWaypoint();
+  prototype_jwp.setNames(joint_names);
+  prototype_jwp.setIsConstrained(false);
+  prototype.assignJointWaypoint(prototype_jwp);
+  if (!base_instruction.getPathProfile().empty())
+  {
+    prototype.setProfile(base_instruction.getPathProfile());
+    prototype.setPathProfile(base_instruction.getPathProfile());
+  }
+
   // Convert to MoveInstructions
   std::vector<MoveInstructionPoly> move_instructions;
+  move_instructions.reserve(static_cast<std::size_t>(std::max<long>(states.cols() - 1, 1)));
   for (long i = 1; i < states.cols() - 1; ++i)
   {
-    MoveInstructionPoly move_instruction = base_instruction.createChild();
-    JointWaypointPoly jwp = move_instruction.createJointWaypoint();
-    jwp.setNames(joint_names);
-    jwp.setPosition(states.col(i));
-    jwp.setIsConstrained(false);
-    move_instruction.assignJointWaypoint(jwp);
-    if (!base_instruction.getPathProfile().empty())
-    {
-      move_instruction.setProfile(base_instruction.getPathProfile());
-      move_instruction.setPathProfile(base_instruction.getPathProfile());
-    }
-    move_instructions.push_back(move_instruction);
+    MoveInstructionPoly& move_instruction = move_instructions.emplace_back(prototype);
+    move_instruction.regenerateUUID();
+    move_instruction.getWaypoint().as<JointWaypointPoly>().setPosition(states.col(i));
   }
 
-  MoveInstructionPoly move_instruction{ base_instruction };
+  MoveInstructionPoly& move_instruction = move_instructions.emplace_back(base_instruction);
   if (base_instruction.getWaypoint().isCartesianWaypoint())
     move_instruction.getWaypoint().as<CartesianWaypointPoly>().setSeed(
         tesseract_common::JointState(joint_names, states.col(states.cols() - 1)));
 
-  move_instructions.push_back(move_instruction);
   return move_instructions;
 }
 
@@ -1053,114 +1085,229 @@ std::vector<MoveInstructionPoly> getInterpolatedInstructions(const tesseract_com
                                                              const Eigen::MatrixXd& states,
                                                              const MoveInstructionPoly& base_instruction)
 {
+  // Create the child prototype once, each interpolated instruction is a copy with a new uuid, transform and seed
+  MoveInstructionPoly prototype = base_instruction.createChild();
+  if (!base_instruction.getWaypoint().isCartesianWaypoint())
+    prototype.assignCartesianWaypoint(prototype.createCartesianWaypoint());
+
+  if (!base_instruction.getPathProfile().empty())
+  {
+    prototype.setProfile(base_instruction.getPathProfile());
+    prototype.setPathProfile(base_instruction.getPathProfile());
+  }
+
   // Convert to MoveInstructions
   std::vector<MoveInstructionPoly> move_instructions;
+  move_instructions.reserve(static_cast<std::size_t>(std::max<long>(states.cols() - 1, 1)));
+  tesseract_common::JointState seed(joint_names, Eigen::VectorXd());
+  for (long i = 1; i < states.cols() - 1; ++i)
+  {
+    MoveInstructionPoly& move_instruction = move_instructions.emplace_back(prototype);
+    move_instruction.regenerateUUID();
+    auto& cwp = move_instruction.getWaypoint().as<CartesianWaypointPoly>();
+    cwp.setTransform(poses[static_cast<std::size_t>(i)]);
+    seed.position = states.col(i);
+    cwp.setSeed(seed);
+  }
+
+  MoveInstructionPoly& move_instruction = move_instructions.emplace_back(base_instruction);
   if (base_instruction.getWaypoint().isCartesianWaypoint())
+    move_instruction.getWaypoint().as<CartesianWaypointPoly>().setSeed(
+        tesseract_common::JointState(joint_names, states.col(states.cols() - 1)));
+
+  return move_instructions;
+}
+
+namespace
+{
+/**
+ * @brief Check if two solutions are the same configuration
+ * @details Redundancy capable joints are compared modulo 2 pi because their redundant solutions are expanded later
+ */
+bool isSameConfiguration(const Eigen::VectorXd& a,
+                         const Eigen::VectorXd& b,
+                         const std::vector<Eigen::Index>& redundancy_indices)
+{
+  static const double tolerance = 1e-6;
+  Eigen::VectorXd diff = (a - b).cwiseAbs();
+  for (const auto& idx : redundancy_indices)
+    diff(idx) = std::abs(std::remainder(diff(idx), 2 * M_PI));
+
+  return (diff.maxCoeff() < tolerance);
+}
+
+/**
+ * @brief Solve inverse kinematics and get all solutions, including redundant solutions, which satisfy the limits
+ * @details Solutions which can not satisfy the limits and duplicate configurations are removed before the redundant
+ * solutions are expanded.
+ */
+tesseract_kinematics::IKSolutions getValidJointSolutions(const tesseract_kinematics::KinematicGroup& manip,
+                                                         const tesseract_kinematics::KinGroupIKInput& ik_input,
+                                                         const Eigen::VectorXd& seed,
+                                                         const tesseract_common::KinematicLimits& limits,
+                                                         const std::vector<Eigen::Index>& redundancy_indices)
+{
+  const Eigen::MatrixX2d& joint_limits = limits.joint_limits;
+  tesseract_kinematics::IKSolutions solutions = manip.calcInvKin({ ik_input }, seed);
+
+  // Remove solutions where a joint which is not redundancy capable violates the limits and duplicate configurations
+  tesseract_kinematics::IKSolutions unique_solutions;
+  unique_solutions.reserve(solutions.size());
+  for (auto& solution : solutions)
   {
-    for (long i = 1; i < states.cols() - 1; ++i)
+    bool valid{ true };
+    for (Eigen::Index i = 0; i < solution.size() && valid; ++i)
     {
-      MoveInstructionPoly move_instruction = base_instruction.createChild();
-      move_instruction.getWaypoint().as<CartesianWaypointPoly>().setTransform(poses[static_cast<std::size_t>(i)]);
-      move_instruction.getWaypoint().as<CartesianWaypointPoly>().setSeed(
-          tesseract_common::JointState(joint_names, states.col(i)));
-      if (!base_instruction.getPathProfile().empty())
-      {
-        move_instruction.setProfile(base_instruction.getPathProfile());
-        move_instruction.setPathProfile(base_instruction.getPathProfile());
-      }
-      move_instructions.push_back(move_instruction);
+      bool redundant = (std::find(redundancy_indices.begin(), redundancy_indices.end(), i) != redundancy_indices.end());
+      valid = redundant || (solution(i) >= joint_limits(i, 0) && solution(i) <= joint_limits(i, 1));
     }
 
-    MoveInstructionPoly move_instruction = base_instruction;
-    move_instruction.getWaypoint().as<CartesianWaypointPoly>().setSeed(
-        tesseract_common::JointState(joint_names, states.col(states.cols() - 1)));
-    move_instructions.push_back(move_instruction);
+    if (!valid)
+      continue;
+
+    auto it = std::find_if(unique_solutions.begin(), unique_solutions.end(), [&](const Eigen::VectorXd& s) {
+      return isSameConfiguration(s, solution, redundancy_indices);
+    });
+
+    if (it == unique_solutions.end())
+      unique_solutions.push_back(std::move(solution));
   }
-  else
+
+  // Expand the redundant solutions
+  tesseract_kinematics::IKSolutions valid_solutions;
+  valid_solutions.reserve(unique_solutions.size());
+  for (const auto& solution : unique_solutions)
+  {
+    if (tesseract_common::satisfiesPositionLimits<double>(solution, joint_limits))
+      valid_solutions.push_back(solution);
+
+    auto redundant_solutions =
+        tesseract_kinematics::getRedundantSolutions<double>(solution, joint_limits, redundancy_indices);
+    for (auto& redundant_solution : redundant_solutions)
+    {
+      if (tesseract_common::satisfiesPositionLimits<double>(redundant_solution, joint_limits))
+        valid_solutions.push_back(std::move(redundant_solution));
+    }
+  }
+
+  return valid_solutions;
+}
+
+/**
+ * @brief Find the solution nearest to the target
+ * @details The distance accumulation stops as soon as it exceeds the current best distance
+ * @return The index of the nearest solution, the solutions must not be empty
+ */
+std::size_t findNearestSolution(const tesseract_kinematics::IKSolutions& solutions, const Eigen::VectorXd& target)
+{
+  assert(!solutions.empty());
+  std::size_t nearest{ 0 };
+  double best = std::numeric_limits<double>::max();
+  for (std::size_t i = 0; i < solutions.size(); ++i)
   {
-    for (long i = 1; i < states.cols() - 1; ++i)
+    const Eigen::VectorXd& solution = solutions[i];
+    double d{ 0 };
+    for (Eigen::Index j = 0; j < solution.size() && d < best; ++j)
+      d += (solution(j) - target(j)) * (solution(j) - target(j));
+
+    if (d < best)
+    {
+      nearest = i;
+      best = d;
+    }
+  }
+
+  return nearest;
+}
+
+/**
+ * @brief Find the closest pair of solutions between the two sets
+ * @details The second set is sorted by the first joint so for each solution of the first set only the solutions of
+ * the second set whose first joint is within the current best distance are searched.
+ * @return The indices of the closest pair, the solutions must not be empty
+ */
+std::pair<std::size_t, std::size_t> findClosestSolutionPair(const tesseract_kinematics::IKSolutions& solutions1,
+                                                            const tesseract_kinematics::IKSolutions& solutions2)
+{
+  assert(!solutions1.empty() && !solutions2.empty());
+  std::vector<std::size_t> order(solutions2.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&solutions2](std::size_t a, std::size_t b) {
+    return solutions2[a](0) < solutions2[b](0);
+  });
+
+  std::pair<std::size_t, std::size_t> closest{ 0, order.front() };
+  double best = std::numeric_limits<double>::max();
+  auto check = [&](std::size_t i1, std::size_t i2) {
+    const Eigen::VectorXd& a = solutions1[i1];
+    const Eigen::VectorXd& b = solutions2[i2];
+    double d{ 0 };
+    for (Eigen::Index j = 0; j < a.size() && d < best; ++j)
+      d += (a(j) - b(j)) * (a(j) - b(j));
+
+    if (d < best)
     {
-      MoveInstructionPoly move_instruction = base_instruction.createChild();
-      CartesianWaypointPoly cwp = move_instruction.createCartesianWaypoint();
-      cwp.setTransform(poses[static_cast<std::size_t>(i)]);
-      cwp.setSeed(tesseract_common::JointState(joint_names, states.col(i)));
-      move_instruction.assignCartesianWaypoint(cwp);
-      if (!base_instruction.getPathProfile().empty())
-      {
-        move_instruction.setProfile(base_instruction.getPathProfile());
-        move_instruction.setPathProfile(base_instruction.getPathProfile());
-      }
-      move_instructions.push_back(move_instruction);
+      closest = { i1, i2 };
+      best = d;
     }
+  };
+
+  for (std::size_t i1 = 0; i1 < solutions1.size(); ++i1)
+  {
+    const double key = solutions1[i1](0);
+    auto start = std::lower_bound(order.begin(), order.end(), key, [&solutions2](std::size_t i, double value) {
+      return solutions2[i](0) < value;
+    });
 
-    move_instructions.push_back(base_instruction);
+    // Search upward and downward from the first joint value until the first joint alone exceeds the best distance
+    for (auto it = start; it != order.end(); ++it)
+    {
+      const double d0 = solutions2[*it](0) - key;
+      if (d0 * d0 >= best)
+        break;
+
+      check(i1, *it);
+    }
+
+    for (auto it = start; it != order.begin();)
+    {
+      --it;
+      const double d0 = key - solutions2[*it](0);
+      if (d0 * d0 >= best)
+        break;
+
+      check(i1, *it);
+    }
   }
 
-  return move_instructions;
+  return closest;
 }
+}  // namespace
 
 Eigen::VectorXd getClosestJointSolution(const KinematicGroupInstructionInfo& info, const Eigen::VectorXd& seed)
 {
-  auto limits = info.manip->getLimits();
-  auto redundancy_indices = info.manip->getRedundancyCapableJointIndices();
-
   if (!info.has_cartesian_waypoint)
     throw std::runtime_error("Instruction waypoint type is not a CartesianWaypoint, unable to extract cartesian pose!");
 
   Eigen::Isometry3d cwp =
       info.instruction.getWaypoint().as<CartesianWaypointPoly>().getTransform() * info.tcp_offset.inverse();
 
-  Eigen::VectorXd jp_final;
-  tesseract_kinematics::IKSolutions jp;
+  /// @todo: May be nice to add contact checking to find best solution, but may not be necessary because this is
+  /// used to generate the seed
   tesseract_kinematics::KinGroupIKInput ik_input(cwp, info.working_frame, info.tcp_frame);
-  tesseract_kinematics::IKSolutions solutions = info.manip->calcInvKin({ ik_input }, seed);
-  for (const auto& sol : solutions)
-  {
-    jp.push_back(sol);
-    auto redundant_solutions =
-        tesseract_kinematics::getRedundantSolutions<double>(sol, limits.joint_limits, redundancy_indices);
-    jp.insert(jp.end(), redundant_solutions.begin(), redundant_solutions.end());
-  }
+  tesseract_kinematics::IKSolutions solutions = getValidJointSolutions(
+      *info.manip, ik_input, seed, info.manip->getLimits(), info.manip->getRedundancyCapableJointIndices());
 
-  if (!jp.empty())
-  {
-    // Find closest solution to the start state
-    double dist = std::numeric_limits<double>::max();
-    for (const auto& solution : jp)
-    {
-      if (tesseract_common::satisfiesPositionLimits<double>(solution, limits.joint_limits))
-      {
-        if (jp_final.rows() == 0)
-        {
-          jp_final = solution;
-          dist = (solution - seed).norm();
-          continue;
-        }
-
-        /// @todo: May be nice to add contact checking to find best solution, but may not be necessary because this is
-        /// used to generate the seed
-        double d = (solution - seed).norm();
-        if (d < dist)
-        {
-          jp_final = solution;
-          dist = d;
-        }
-      }
-    }
-  }
-  return jp_final;
+  if (solutions.empty())
+    return {};
+
+  return solutions[findNearestSolution(solutions, seed)];
 }
 
 std::array<Eigen::VectorXd, 2> getClosestJointSolution(const KinematicGroupInstructionInfo& info1,
                                                        const KinematicGroupInstructionInfo& info2,
                                                        const Eigen::VectorXd& seed)
 {
-  auto manip1_limits = info1.manip->getLimits();
-  auto manip1_redundancy_indices = info1.manip->getRedundancyCapableJointIndices();
-
-  auto manip2_limits = info2.manip->getLimits();
-  auto manip2_redundancy_indices = info2.manip->getRedundancyCapableJointIndices();
-
   if (!info1.has_cartesian_waypoint || !info2.has_cartesian_waypoint)
     throw std::runtime_error("Instruction waypoint type is not a CartesianWaypoint, unable to extract cartesian pose!");
 
@@ -1169,107 +1316,65 @@ std::array<Eigen::VectorXd, 2> getClosestJointSolution(const KinematicGroupInstr
   Eigen::Isometry3d cwp2 =
       info2.instruction.getWaypoint().as<CartesianWaypointPoly>().getTransform() * info2.tcp_offset.inverse();
 
-  std::array<Eigen::VectorXd, 2> results;
-
   // Calculate IK for start and end
-  Eigen::VectorXd j1_final;
-  tesseract_kinematics::IKSolutions j1;
   tesseract_kinematics::KinGroupIKInput ik_input1(cwp1, info1.working_frame, info1.tcp_frame);
-  tesseract_kinematics::IKSolutions j1_solutions = info1.manip->calcInvKin({ ik_input1 }, seed);
-  j1_solutions.erase(std::remove_if(j1_solutions.begin(),
-                                    j1_solutions.end(),
-                                    [&manip1_limits](const Eigen::VectorXd& solution) {
-                                      return !tesseract_common::satisfiesPositionLimits<double>(
-                                          solution, manip1_limits.joint_limits);
-                                    }),
-                     j1_solutions.end());
-
-  // Get redundant solutions
-  for (const auto& sol : j1_solutions)
-  {
-    j1.push_back(sol);
-    auto redundant_solutions =
-        tesseract_kinematics::getRedundantSolutions<double>(sol, manip1_limits.joint_limits, manip1_redundancy_indices);
-    j1.insert(j1.end(), redundant_solutions.begin(), redundant_solutions.end());
-  }
+  tesseract_kinematics::IKSolutions j1 = getValidJointSolutions(
+      *info1.manip, ik_input1, seed, info1.manip->getLimits(), info1.manip->getRedundancyCapableJointIndices());
 
-  Eigen::VectorXd j2_final;
-  tesseract_kinematics::IKSolutions j2;
   tesseract_kinematics::KinGroupIKInput ik_input2(cwp2, info2.working_frame, info2.tcp_frame);
-  tesseract_kinematics::IKSolutions j2_solutions = info2.manip->calcInvKin({ ik_input2 }, seed);
-  j2_solutions.erase(std::remove_if(j2_solutions.begin(),
-                                    j2_solutions.end(),
-                                    [&manip2_limits](const Eigen::VectorXd& solution) {
-                                      // NOLINTNEXTLINE(clang-analyzer-core.uninitialized.UndefReturn)
-                                      return !tesseract_common::satisfiesPositionLimits<double>(
-                                          solution, manip2_limits.joint_limits);
-                                    }),
-                     j2_solutions.end());
-
-  // Get redundant solutions
-  for (const auto& sol : j2_solutions)
-  {
-    j2.push_back(sol);
-    auto redundant_solutions =
-        tesseract_kinematics::getRedundantSolutions<double>(sol, manip2_limits.joint_limits, manip2_redundancy_indices);
-    j2.insert(j2.end(), redundant_solutions.begin(), redundant_solutions.end());
-  }
+  tesseract_kinematics::IKSolutions j2 = getValidJointSolutions(
+      *info2.manip, ik_input2, seed, info2.manip->getLimits(), info2.manip->getRedundancyCapableJointIndices());
 
+  /// @todo: May be nice to add contact checking to find best solution, but may not be necessary because this is
+  /// used to generate the seed.
+  std::array<Eigen::VectorXd, 2> results;
   if (!j1.empty() && !j2.empty())
   {
     // Find closest solution to the end state
-    double dist = std::numeric_limits<double>::max();
-    j1_final = j1[0];
-    j2_final = j2[0];
-    for (const auto& j1_solution : j1)
-    {
-      for (const auto& j2_solution : j2)
-      {
-        /// @todo: May be nice to add contact checking to find best solution, but may not be necessary because this is
-        /// used to generate the seed.
-        double d = (j2_solution - j1_solution).norm();
-        if (d < dist)
-        {
-          j1_final = j1_solution;
-          j2_final = j2_solution;
-          dist = d;
-        }
-      }
-    }
-    results[0] = j1_final;
-    results[1] = j2_final;
+    std::pair<std::size_t, std::size_t> closest = findClosestSolutionPair(j1, j2);
+    results[0] = j1[closest.first];
+    results[1] = j2[closest.second];
   }
   else if (!j1.empty())
   {
-    double dist = std::numeric_limits<double>::max();
-    j1_final = j1[0];
-    for (const auto& j1_solution : j1)
-    {
-      double d = (seed - j1_solution).norm();
-      if (d < dist)
-      {
-        j1_final = j1_solution;
-        dist = d;
-      }
-    }
-
-    results[0] = j1_final;
+    results[0] = j1[findNearestSolution(j1, seed)];
   }
   else if (!j2.empty())
   {
-    double dist = std::numeric_limits<double>::max();
-    j2_final = j2[0];
-    for (const auto& j2_solution : j2)
+    results[1] = j2[findNearestSolution(j2, seed)];
+  }
+
+  return results;
+}
+
+std::vector<Eigen::VectorXd> getClosestJointSolutions(const tesseract_kinematics::KinematicGroup& manip,
+                                                      const tesseract_common::VectorIsometry3d& poses,
+                                                      const std::string& working_frame,
+                                                      const std::string& tcp_frame,
+                                                      const Eigen::VectorXd& seed)
+{
+  const tesseract_common::KinematicLimits limits = manip.getLimits();
+  const std::vector<Eigen::Index> redundancy_indices = manip.getRedundancyCapableJointIndices();
+
+  std::vector<Eigen::VectorXd> results;
+  results.reserve(poses.size());
+
+  // The previous selected solution is used as the inverse kinematics seed and the target of the nearest search
+  Eigen::VectorXd reference = seed;
+  for (const auto& pose : poses)
+  {
+    tesseract_kinematics::KinGroupIKInput ik_input(pose, working_frame, tcp_frame);
+    tesseract_kinematics::IKSolutions solutions =
+        getValidJointSolutions(manip, ik_input, reference, limits, redundancy_indices);
+
+    if (solutions.empty())
     {
-      double d = (seed - j2_solution).norm();
-      if (d < dist)
-      {
-        j2_final = j2_solution;
-        dist = d;
-      }
+      results.emplace_back();
+      continue;
     }
 
-    results[1] = j1_final;
+    reference = solutions[findNearestSolution(solutions, reference)];
+    results.push_back(reference);
   }
 
   return results;
@@ -85,8 +85,10 @@ PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
   {
     MoveInstructionPoly start_instruction_copy = null_instruction;
     MoveInstructionPoly start_instruction_seed_copy = null_instruction;
-    seed =
-        processCompositeInstruction(request.instructions, start_instruction_copy, start_instruction_seed_copy, request);
+    ProfileResolver<SimplePlannerPlanProfile> profile_resolver(
+        name_, *request.profiles, request.plan_profile_remapping, std::make_shared<SimplePlannerLVSNoIKPlanProfile>());
+    seed = processCompositeInstruction(
+        request.instructions, start_instruction_copy, start_instruction_seed_copy, request, profile_resolver);
   }
   catch (std::exception& e)
   {
@@ -131,7 +133,9 @@ PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
 CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const CompositeInstruction& instructions,
                                                                       MoveInstructionPoly& prev_instruction,
                                                                       MoveInstructionPoly& prev_seed,
-                                                                      const PlannerRequest& request) const
+                                                                      const PlannerRequest& request,
+                                                                      ProfileResolver<SimplePlannerPlanProfile>&
+                                                                          profile_resolver) const
 {
   CompositeInstruction seed(instructions);
   seed.clear();
@@ -142,8 +146,8 @@ CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const Comp
 
     if (instruction.isCompositeInstruction())
     {
-      seed.push_back(
-          processCompositeInstruction(instruction.as<CompositeInstruction>(), prev_instruction, prev_seed, request));
+      seed.push_back(processCompositeInstruction(
+          instruction.as<CompositeInstruction>(), prev_instruction, prev_seed, request, profile_resolver));
     }
     else if (instruction.isMoveInstruction())
     {
@@ -187,22 +191,10 @@ CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const Comp
       }
 
       // If a path profile exists for the instruction it should use that instead of the termination profile
-      SimplePlannerPlanProfile::ConstPtr plan_profile;
-      if (base_instruction.getPathProfile().empty())
-      {
-        std::string profile = getProfileString(name_, base_instruction.getProfile(), request.plan_profile_remapping);
-        plan_profile = getProfile<SimplePlannerPlanProfile>(
-            name_, profile, *request.profiles, std::make_shared<SimplePlannerLVSNoIKPlanProfile>());
-        plan_profile = applyProfileOverrides(name_, profile, plan_profile, base_instruction.getProfileOverrides());
-      }
-      else
-      {
-        std::string profile =
-            getProfileString(name_, base_instruction.getPathProfile(), request.plan_profile_remapping);
-        plan_profile = getProfile<SimplePlannerPlanProfile>(
-            name_, profile, *request.profiles, std::make_shared<SimplePlannerLVSNoIKPlanProfile>());
-        plan_profile = applyProfileOverrides(name_, profile, plan_profile, base_instruction.getProfileOverrides());
-      }
+      const std::string& profile = base_instruction.getPathProfile().empty() ? base_instruction.getProfile() :
+                                                                                  base_instruction.getPathProfile();
+      SimplePlannerPlanProfile::ConstPtr plan_profile =
+          profile_resolver.resolve(profile, base_instruction.getProfileOverrides());
 
       if (!plan_profile)
         throw std::runtime_error("SimpleMotionPlanner: Invalid profile");
@@ -221,11 +213,9 @@ CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const Comp
       assert(instruction_seed.back().getPathProfile() == base_instruction.getPathProfile());
       assert(instruction_seed.back().getProfile() == base_instruction.getProfile());
 
-      for (const auto& instr : instruction_seed)
-        seed.push_back(instr);
-
       prev_instruction = base_instruction;
       prev_seed = instruction_seed.back();
+      seed.appendMoveInstructions(std::move(instruction_seed));
     }
     else
     {
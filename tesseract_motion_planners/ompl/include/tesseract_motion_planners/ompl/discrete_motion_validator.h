@@ -33,17 +33,47 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
-/** @brief Continuous collision check between two states */
+/** @brief The order in which the interpolated states of a motion are validated */
+enum class OMPLMotionValidationOrder
+{
+  /** @brief Validate the interpolated states sequentially from the first state to the second state */
+  LINEAR = 0,
+  /**
+   * @brief Validate the second state first followed by the interpolated states coarse-to-fine by recursively
+   * bisecting the motion. Collisions tend to occur in the middle of long motions so invalid motions are rejected
+   * with fewer checks. Valid motions require the same number of checks as LINEAR.
+   */
+  BISECTION = 1
+};
+
+/** @brief Discrete collision check between two states */
 class DiscreteMotionValidator : public ompl::base::MotionValidator
 {
 public:
-  DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info);
+  DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info,
+                          OMPLMotionValidationOrder order = OMPLMotionValidationOrder::LINEAR);
 
   bool checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const override;
 
+  /** @note The first invalid state is required to compute the last valid state so this always uses LINEAR order */
   bool checkMotion(const ompl::base::State* s1,
                    const ompl::base::State* s2,
                    std::pair<ompl::base::State*, double>& lastValid) const override;
+
+  /** @brief Get the order in which the interpolated states are validated */
+  OMPLMotionValidationOrder getValidationOrder() const;
+
+private:
+  /**
+   * @brief Check the motion by validating the interpolated states coarse-to-fine
+   * @param s1 First OMPL State
+   * @param s2 Second OMPL State
+   * @return True if all states are valid, otherwise false.
+   */
+  bool checkMotionBisection(const ompl::base::State* s1, const ompl::base::State* s2) const;
+
+  /** @brief The order in which the interpolated states are validated */
+  OMPLMotionValidationOrder order_;
 };
 }  // namespace tesseract_planning
 
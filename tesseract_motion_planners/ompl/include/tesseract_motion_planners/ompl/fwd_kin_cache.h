@@ -0,0 +1,90 @@
+/**
+ * @file fwd_kin_cache.h
+ * @brief Tesseract OMPL planner small forward kinematics cache
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_OMPL_FWD_KIN_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_OMPL_FWD_KIN_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_kinematics/core/joint_group.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A small fixed capacity cache of forward kinematics results keyed on the exact joint values
+ *
+ * Motion validators repeatedly check the same endpoint states (the tree node a motion starts from and the state it
+ * is extended toward), so keeping the last few results avoids recomputing the forward kinematics for them.
+ * Entries are replaced in first-in first-out order. This is not thread safe and is intended to be stored per thread.
+ */
+class FwdKinCache
+{
+public:
+  /**
+   * @brief Constructor
+   * @param capacity The max number of entries stored, if zero nothing is cached
+   */
+  FwdKinCache(std::size_t capacity = 2);
+
+  /**
+   * @brief Get the link transforms for the provided joint values, computing and storing them on a cache miss
+   * @details The returned reference is only valid until the next call that results in a cache miss
+   * @param manip The joint group used to calculate the forward kinematics
+   * @param joint_values The joint values
+   * @return The link transforms
+   */
+  const tesseract_common::TransformMap& calcFwdKin(const tesseract_kinematics::JointGroup& manip,
+                                                   const Eigen::Ref<const Eigen::VectorXd>& joint_values);
+
+  /** @brief The max number of entries stored */
+  std::size_t capacity() const;
+
+  /** @brief The number of lookups that were served from the cache */
+  std::size_t getHitCount() const;
+
+  /** @brief The number of lookups that required calculating the forward kinematics */
+  std::size_t getMissCount() const;
+
+  /** @brief Remove all entries */
+  void clear();
+
+private:
+  std::size_t capacity_;
+  std::size_t next_{ 0 };
+  std::size_t hits_{ 0 };
+  std::size_t misses_{ 0 };
+  std::vector<std::pair<Eigen::VectorXd, tesseract_common::TransformMap>> entries_;
+
+  /** @brief Storage used when the capacity is zero */
+  tesseract_common::TransformMap uncached_;
+};
+
+}  // namespace tesseract_planning
+#endif  // TESSERACT_MOTION_PLANNERS_OMPL_FWD_KIN_CACHE_H
@@ -0,0 +1,101 @@
+/**
+ * @file lazy_motion_validator.h
+ * @brief Tesseract OMPL planner motion validator which defers full motion checks until a path is found
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_OMPL_LAZY_MOTION_VALIDATOR_H
+#define TESSERACT_MOTION_PLANNERS_OMPL_LAZY_MOTION_VALIDATOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <ompl/base/MotionValidator.h>
+#include <atomic>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+/**
+ * @brief Motion validator which only checks a subset of the states of a motion while lazy
+ *
+ * While lazy only the second state and every n-th interpolated state are checked using the state validity checker,
+ * so edges are accepted cheaply while searching. Once a path is found the planner disables lazy mode and checks the
+ * path with the wrapped motion validator, removing its invalid motions from the planners and searching again.
+ *
+ * @note This requires the state validity checker to perform collision checking, so it is not used with continuous
+ * collision checking.
+ */
+class LazyMotionValidator : public ompl::base::MotionValidator
+{
+public:
+  /**
+   * @brief Constructor
+   * @param space_info The space information
+   * @param motion_validator The motion validator used when not lazy
+   * @param check_stride The interval of interpolated states checked while lazy, if zero only the second state is checked
+   */
+  LazyMotionValidator(const ompl::base::SpaceInformationPtr& space_info,
+                      ompl::base::MotionValidatorPtr motion_validator,
+                      int check_stride = 0);
+
+  bool checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const override;
+
+  bool checkMotion(const ompl::base::State* s1,
+                   const ompl::base::State* s2,
+                   std::pair<ompl::base::State*, double>& lastValid) const override;
+
+  /** @brief Enable or disable lazy checking, this is safe to call while other threads are checking motions */
+  void setLazy(bool lazy);
+
+  /** @brief Check if lazy checking is enabled */
+  bool isLazy() const;
+
+  /** @brief Get the interval of interpolated states checked while lazy */
+  int getCheckStride() const;
+
+  /** @brief Get the motion validator used when not lazy */
+  const ompl::base::MotionValidatorPtr& getMotionValidator() const;
+
+private:
+  /**
+   * @brief Check the second state and every check_stride_ interpolated state
+   * @param s1 First OMPL State
+   * @param s2 Second OMPL State
+   * @param lastValid If not nullptr it is populated with the last state known to be valid
+   * @return True if all checked states are valid, otherwise false.
+   */
+  bool checkMotionLazy(const ompl::base::State* s1,
+                       const ompl::base::State* s2,
+                       std::pair<ompl::base::State*, double>* lastValid) const;
+
+  /** @brief The motion validator used when not lazy */
+  ompl::base::MotionValidatorPtr motion_validator_;
+
+  /** @brief The interval of interpolated states checked while lazy */
+  int check_stride_;
+
+  /** @brief Indicate if lazy checking is enabled */
+  std::atomic<bool> lazy_{ false };
+};
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_OMPL_LAZY_MOTION_VALIDATOR_H
@@ -0,0 +1,191 @@
+/**
+ * @file ompl_experience_cache.h
+ * @brief Tesseract OMPL planner experience cache used to reuse planner roadmaps across requests
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_OMPL_OMPL_EXPERIENCE_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_OMPL_OMPL_EXPERIENCE_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <ompl/geometric/SimpleSetup.h>
+#include <ompl/base/PlannerData.h>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/filesystem.h>
+#include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief The planning state retained between requests
+ *
+ * The planners are bound to the space information of the simple setup so both must be reused together.
+ */
+struct OMPLExperience
+{
+  using Ptr = std::shared_ptr<OMPLExperience>;
+  using ConstPtr = std::shared_ptr<const OMPLExperience>;
+
+  /** @brief The environment revision the experience was collected with */
+  int revision{ 0 };
+
+  /** @brief The values of the joints which are not part of the manipulator when the experience was collected */
+  std::unordered_map<std::string, double> static_joint_values;
+
+  /** @brief The simple setup whose space information and validators the planners are bound to */
+  ompl::geometric::SimpleSetupPtr simple_setup;
+
+  /** @brief The planners holding the explored state from previous requests */
+  std::vector<ompl::base::PlannerPtr> planners;
+
+  /** @brief The type of each planner */
+  std::vector<OMPLPlannerType> planner_types;
+
+  /**
+   * @brief Replace the start and goal states and the optimization objective of the stored simple setup and clear the
+   * planners query data
+   * @details Only planners which support multiple queries (PRM, PRMstar, LazyPRM, LazyPRMstar) retain their roadmap, all other
+   * planners start over.
+   * @param pdef The problem definition containing the new start and goal states
+   * @param objective The optimization objective created for the space information of the stored simple setup, the
+   * objective of the problem definition can not be used since it is bound to a different space information
+   */
+  void setQuery(const ompl::base::ProblemDefinition& pdef, const ompl::base::OptimizationObjectivePtr& objective) const;
+};
+
+/**
+ * @brief A thread safe store of OMPL planning experience keyed on environment, manipulator and profile configuration
+ *
+ * An experience is checked out for the duration of a solve so concurrent requests never share planners. If a request
+ * finds no entry (or the entry is in use) it plans from scratch and checks in its planners afterwards. Entries are
+ * invalidated when the environment revision or the value of a joint outside of the manipulator changes.
+ *
+ * If a storage directory is provided the roadmaps of multi-query planners can be saved with save() and will be loaded
+ * when creating new planners for the same key and environment revision.
+ */
+class OMPLExperienceCache
+{
+public:
+  using Ptr = std::shared_ptr<OMPLExperienceCache>;
+  using ConstPtr = std::shared_ptr<const OMPLExperienceCache>;
+
+  OMPLExperienceCache() = default;
+
+  /**
+   * @brief Constructor
+   * @param directory The directory used to save and load roadmaps
+   */
+  OMPLExperienceCache(tesseract_common::fs::path directory);
+
+  /**
+   * @brief Create the key for an environment, manipulator and profile configuration
+   * @details The configuration is hashed so experience is only shared between problems whose planners, state space
+   * and validators were configured the same way.
+   * @param env_name The environment name
+   * @param manipulator The manipulator (joint group) name
+   * @param config The configuration the problem was setup with, see OMPLProblem::experience_config
+   * @return The key
+   */
+  static std::string createKey(const std::string& env_name, const std::string& manipulator, const std::string& config);
+
+  /**
+   * @brief Remove an experience from the cache for use by a single request
+   * @param key The key
+   * @param revision The current environment revision
+   * @param static_joint_values The current values of the joints which are not part of the manipulator
+   * @return The experience, nullptr if none is stored or it is no longer valid
+   */
+  OMPLExperience::Ptr checkout(const std::string& key,
+                               int revision,
+                               const std::unordered_map<std::string, double>& static_joint_values);
+
+  /**
+   * @brief Return an experience to the cache
+   * @details If an entry already exists for the key with the same revision the provided experience is discarded
+   * @param key The key
+   * @param experience The experience
+   */
+  void checkin(const std::string& key, OMPLExperience::Ptr experience);
+
+  /** @brief Remove all entries */
+  void clear();
+
+  /** @brief The number of entries currently stored (not checked out) */
+  std::size_t size() const;
+
+  /** @brief The storage directory, empty if roadmaps are not saved */
+  const tesseract_common::fs::path& getDirectory() const;
+
+  /**
+   * @brief Save the roadmaps of the multi-query planners of all stored entries to the storage directory
+   * @return True if successful, false if no directory was provided or writing failed
+   */
+  bool save() const;
+
+  /**
+   * @brief Create a planner from a roadmap previously saved to the storage directory
+   * @param key The key
+   * @param revision The current environment revision
+   * @param index The index of the planner in the profile
+   * @param config The planner configurator
+   * @param si The space information the planner is bound to
+   * @return The planner, nullptr if no roadmap is stored or the planner type does not support roadmaps
+   */
+  ompl::base::PlannerPtr loadPlanner(const std::string& key,
+                                     int revision,
+                                     std::size_t index,
+                                     const OMPLPlannerConfigurator& config,
+                                     const ompl::base::SpaceInformationPtr& si) const;
+
+  /**
+   * @brief Create a multi-query planner from a roadmap
+   * @param data The roadmap, the planner is bound to its space information
+   * @param config The planner configurator
+   * @return The planner, nullptr if the planner type does not support roadmaps
+   */
+  static ompl::base::PlannerPtr createPlanner(const ompl::base::PlannerData& data,
+                                              const OMPLPlannerConfigurator& config);
+
+  /** @brief Check if the planner type keeps its roadmap between queries */
+  static bool isMultiQuery(OMPLPlannerType type);
+
+protected:
+  /** @brief The storage directory */
+  tesseract_common::fs::path directory_;
+
+  /** @brief The mutex protecting the entries */
+  mutable std::mutex mutex_;
+
+  /** @brief The stored experience */
+  std::map<std::string, OMPLExperience::Ptr> entries_;
+
+  /** @brief Get the roadmap file path */
+  tesseract_common::fs::path getFilePath(const std::string& key, int revision, std::size_t index) const;
+};
+
+}  // namespace tesseract_planning
+#endif  // TESSERACT_MOTION_PLANNERS_OMPL_OMPL_EXPERIENCE_CACHE_H
@@ -56,7 +56,9 @@ enum class OMPLPlannerType
   PRM = 10,
   PRMstar = 11,
   LazyPRMstar = 12,
-  SPARS = 13
+  SPARS = 13,
+  LazyPRM = 14,
+  LazyRRT = 15
 };
 
 struct OMPLPlannerConfigurator
@@ -462,6 +464,56 @@ struct SPARSConfigurator : public OMPLPlannerConfigurator
   tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const override;
 };
 
+struct LazyPRMConfigurator : public OMPLPlannerConfigurator
+{
+  LazyPRMConfigurator() = default;
+  ~LazyPRMConfigurator() override = default;
+  LazyPRMConfigurator(const LazyPRMConfigurator&) = default;
+  LazyPRMConfigurator& operator=(const LazyPRMConfigurator&) = default;
+  LazyPRMConfigurator(LazyPRMConfigurator&&) = default;
+  LazyPRMConfigurator& operator=(LazyPRMConfigurator&&) = default;
+  LazyPRMConfigurator(const tinyxml2::XMLElement& xml_element);
+
+  /** @brief Max distance between connected states */
+  double range = 0;
+
+  /** @brief Use k nearest neighbors. */
+  int max_nearest_neighbors = 10;
+
+  /** @brief Create the planner */
+  ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const override;
+
+  OMPLPlannerType getType() const override;
+
+  /** @brief Serialize planner to xml */
+  tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const override;
+};
+
+struct LazyRRTConfigurator : public OMPLPlannerConfigurator
+{
+  LazyRRTConfigurator() = default;
+  ~LazyRRTConfigurator() override = default;
+  LazyRRTConfigurator(const LazyRRTConfigurator&) = default;
+  LazyRRTConfigurator& operator=(const LazyRRTConfigurator&) = default;
+  LazyRRTConfigurator(LazyRRTConfigurator&&) = default;
+  LazyRRTConfigurator& operator=(LazyRRTConfigurator&&) = default;
+  LazyRRTConfigurator(const tinyxml2::XMLElement& xml_element);
+
+  /** @brief Max motion added to tree */
+  double range = 0;
+
+  /** @brief When close to goal select goal, with this probability. */
+  double goal_bias = 0.05;
+
+  /** @brief Create the planner */
+  ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const override;
+
+  OMPLPlannerType getType() const override;
+
+  /** @brief Serialize planner to xml */
+  tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const override;
+};
+
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_MOTION_PLANNERS_OMPL_PLANNER_CONFIGURATOR_H
@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/ompl_experience_cache.h>
 #include <tesseract_environment/environment.h>
 #include <tesseract_kinematics/core/kinematic_group.h>
 #include <tesseract_motion_planners/ompl/types.h>
@@ -136,6 +137,24 @@ struct OMPLProblem
    */
   OMPLStateExtractor extractor{};
 
+  /**
+   * @brief The experience cache used to reuse planners across requests
+   * If nullptr the planners are created for every request and discarded afterwards.
+   */
+  OMPLExperienceCache::Ptr experience_cache;
+
+  /**
+   * @brief The allocator of the optimization objective, if empty the problem has no optimization objective
+   * This is used to create the objective for the space information of reused experience.
+   */
+  OptimizationObjectiveAllocator optimization_objective_allocator;
+
+  /**
+   * @brief The configuration the planners, state space and validators were setup with
+   * This is part of the experience key so experience is never reused by a problem configured differently.
+   */
+  std::string experience_config;
+
   /**
    * @brief Convert the path stored in simple_setup to tesseract trajectory
    * This is required because the motion planner is not aware of the state space type.
@@ -28,6 +28,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <mutex>
 #include <vector>
 #include <Eigen/Geometry>
 #include <Eigen/Core>
@@ -35,6 +36,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_profile.h>
 
 namespace tesseract_planning
@@ -99,6 +101,46 @@ public:
   /** @brief The collision check configuration */
   tesseract_collision::CollisionCheckConfig collision_check_config;
 
+  /**
+   * @brief The order in which interpolated states are checked by the default discrete motion validator
+   *
+   * BISECTION checks coarse-to-fine which rejects motions colliding near their middle with fewer checks.
+   */
+  OMPLMotionValidationOrder motion_validation_order{ OMPLMotionValidationOrder::LINEAR };
+
+  /**
+   * @brief The number of forward kinematics results cached per thread by the default collision validators
+   *
+   * Endpoint states are checked repeatedly while planning so a small cache avoids recomputing their link transforms.
+   * If zero no caching is performed.
+   */
+  std::size_t fwd_kin_cache_size{ 0 };
+
+  /**
+   * @brief Defer full motion validation until a path is found
+   *
+   * While searching only the end state (and every lazy_check_stride interpolated state) of each motion is checked. The
+   * solution is then validated with the full motion validator, its invalid motions are removed from the planners and
+   * the search is repeated until a valid solution is found. This is most effective in sparse environments where most
+   * motions are collision free.
+   *
+   * This is ignored when using continuous collision checking since the state validator does not check collision.
+   */
+  bool lazy_collision_check{ false };
+
+  /** @brief The interval of interpolated states checked while lazy, if zero only the end state of a motion is checked */
+  int lazy_check_stride{ 0 };
+
+  /**
+   * @brief The experience cache used to keep the planners (and their roadmaps) between requests
+   *
+   * This is keyed on the environment, manipulator and the configuration returned by getExperienceConfig() and
+   * invalidated when the environment changes. Only multi-query
+   * planners (PRM, PRMstar, LazyPRM, LazyPRMstar) benefit since all other planners clear their data for every new query.
+   * If nullptr the planners are recreated for every request.
+   */
+  OMPLExperienceCache::Ptr experience_cache;
+
   /** @brief The state sampler allocator. This can be null and it will use Tesseract default state sampler allocator. */
   StateSamplerAllocator state_sampler_allocator;
 
@@ -145,7 +187,35 @@ public:
 
   tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const override;
 
+  /**
+   * @brief Get the configuration the planners, state space and validators are setup with
+   * @details This is used as part of the experience key. The allocators can not be compared so if any is provided
+   * experience is only shared between problems setup by this profile instance. The configuration is computed once per
+   * profile instance, so the profile must not be modified after it was used. Copies compute their own configuration.
+   * @return The configuration
+   */
+  const std::string& getExperienceConfig() const;
+
 protected:
+  /** @brief The experience configuration computed on first use, which is not copied with the profile */
+  struct ExperienceConfigCache
+  {
+    ExperienceConfigCache() = default;
+    ~ExperienceConfigCache() = default;
+    ExperienceConfigCache(const ExperienceConfigCache& /*other*/) {}
+    ExperienceConfigCache& operator=(const ExperienceConfigCache& /*other*/) { return *this; }
+    ExperienceConfigCache(ExperienceConfigCache&& /*other*/) noexcept {}
+    ExperienceConfigCache& operator=(ExperienceConfigCache&& /*other*/) noexcept { return *this; }
+
+    std::once_flag once;
+    std::string config;
+  };
+
+  mutable ExperienceConfigCache experience_config_cache_;
+
+  /** @brief Create the configuration returned by getExperienceConfig() */
+  std::string createExperienceConfig() const;
+
   ompl::base::StateValidityCheckerPtr processStateValidator(OMPLProblem& prob) const;
   void processMotionValidator(OMPLProblem& prob,
                               const ompl::base::StateValidityCheckerPtr& svc_without_collision) const;
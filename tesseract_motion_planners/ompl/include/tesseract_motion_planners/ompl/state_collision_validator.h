@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
+#include <tesseract_motion_planners/ompl/fwd_kin_cache.h>
 #include <tesseract_environment/environment.h>
 #include <tesseract_kinematics/core/forward_kinematics.h>
 
@@ -46,7 +47,8 @@ public:
                           const tesseract_environment::Environment& env,
                           tesseract_kinematics::JointGroup::ConstPtr manip,
                           const tesseract_collision::CollisionCheckConfig& collision_check_config,
-                          OMPLStateExtractor extractor);
+                          OMPLStateExtractor extractor,
+                          std::size_t fwd_kin_cache_size = 0);
 
   bool isValid(const ompl::base::State* state) const override;
 
@@ -63,6 +65,9 @@ private:
   /** @brief This will extract an Eigen::VectorXd from the OMPL State */
   OMPLStateExtractor extractor_;
 
+  /** @brief The number of forward kinematics results cached per thread */
+  std::size_t fwd_kin_cache_size_;
+
   // The items below are to cache the contact manager based on thread ID. Currently ompl is multi
   // threaded but the methods used to implement collision checking are not thread safe. To prevent
   // reconstructing the collision environment for every check this will cache a contact manager
@@ -73,6 +78,9 @@ private:
 
   /** @brief The continuous contact manager cache */
   mutable std::map<unsigned long int, tesseract_collision::DiscreteContactManager::Ptr> contact_managers_;
+
+  /** @brief The forward kinematics cache */
+  mutable std::map<unsigned long int, FwdKinCache> fwd_kin_caches_;
 };
 
 }  // namespace tesseract_planning
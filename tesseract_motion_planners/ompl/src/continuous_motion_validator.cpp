@@ -39,12 +39,14 @@ ContinuousMotionValidator::ContinuousMotionValidator(
     const tesseract_environment::Environment& env,
     tesseract_kinematics::JointGroup::ConstPtr manip,
     const tesseract_collision::CollisionCheckConfig& collision_check_config,
-    OMPLStateExtractor extractor)
+    OMPLStateExtractor extractor,
+    std::size_t fwd_kin_cache_size)
   : MotionValidator(space_info)
   , state_validator_(std::move(state_validator))
   , manip_(std::move(manip))
   , continuous_contact_manager_(env.getContinuousContactManager())
   , extractor_(std::move(extractor))
+  , fwd_kin_cache_size_(fwd_kin_cache_size)
 {
   links_ = manip_->getActiveLinkNames();
 
@@ -120,27 +122,31 @@ bool ContinuousMotionValidator::continuousCollisionCheck(const ompl::base::State
   // It was time using chronos time elapsed and it was faster to cache the contact manager
   unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
   tesseract_collision::ContinuousContactManager::Ptr cm;
+  FwdKinCache* fwd_kin_cache{ nullptr };
   mutex_.lock();
   auto it = continuous_contact_managers_.find(hash);
   if (it == continuous_contact_managers_.end())
   {
     cm = continuous_contact_manager_->clone();
     continuous_contact_managers_[hash] = cm;
+    fwd_kin_cache = &fwd_kin_caches_.emplace(hash, FwdKinCache(fwd_kin_cache_size_)).first->second;
   }
   else
   {
     cm = it->second;
+    fwd_kin_cache = &fwd_kin_caches_.at(hash);
   }
   mutex_.unlock();
 
   Eigen::Map<Eigen::VectorXd> start_joints = extractor_(s1);
   Eigen::Map<Eigen::VectorXd> finish_joints = extractor_(s2);
 
-  tesseract_common::TransformMap state0 = manip_->calcFwdKin(start_joints);
-  tesseract_common::TransformMap state1 = manip_->calcFwdKin(finish_joints);
+  // A copy is required because the next lookup may replace the cached entry
+  tesseract_common::TransformMap state0 = fwd_kin_cache->calcFwdKin(*manip_, start_joints);
+  const tesseract_common::TransformMap& state1 = fwd_kin_cache->calcFwdKin(*manip_, finish_joints);
 
   for (const auto& link_name : links_)
-    cm->setCollisionObjectsTransform(link_name, state0[link_name], state1[link_name]);
+    cm->setCollisionObjectsTransform(link_name, state0[link_name], state1.at(link_name));
 
   tesseract_collision::ContactResultMap contact_map;
   cm->contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
@@ -26,19 +26,24 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/SpaceInformation.h>
+#include <queue>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
 
 namespace tesseract_planning
 {
-DiscreteMotionValidator::DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info)
-  : MotionValidator(space_info)
+DiscreteMotionValidator::DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info,
+                                                 OMPLMotionValidationOrder order)
+  : MotionValidator(space_info), order_(order)
 {
 }
 
 bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const
 {
+  if (order_ == OMPLMotionValidationOrder::BISECTION)
+    return checkMotionBisection(s1, s2);
+
   std::pair<ompl::base::State*, double> dummy = { nullptr, 0.0 };
   return checkMotion(s1, s2, dummy);
 }
@@ -86,4 +91,49 @@ bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1,
 
   return is_valid;
 }
+
+OMPLMotionValidationOrder DiscreteMotionValidator::getValidationOrder() const { return order_; }
+
+bool DiscreteMotionValidator::checkMotionBisection(const ompl::base::State* s1, const ompl::base::State* s2) const
+{
+  // Check the end state first since it is not shared with other motions starting from s1
+  if (!si_->isValid(s2))
+    return false;
+
+  const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+
+  unsigned n_steps = state_space.validSegmentCount(s1, s2);
+  if (n_steps < 2)
+    return true;
+
+  bool is_valid = true;
+
+  // Each entry is an inclusive range of interpolation indices still to be checked
+  std::queue<std::pair<unsigned, unsigned>> ranges;
+  ranges.emplace(1, n_steps - 1);
+
+  ompl::base::State* interp = si_->allocState();
+  while (!ranges.empty())
+  {
+    const std::pair<unsigned, unsigned> range = ranges.front();
+    ranges.pop();
+
+    const unsigned mid = range.first + ((range.second - range.first) / 2);
+    state_space.interpolate(s1, s2, static_cast<double>(mid) / static_cast<double>(n_steps), interp);
+    if (!si_->isValid(interp))
+    {
+      is_valid = false;
+      break;
+    }
+
+    if (range.first < mid)
+      ranges.emplace(range.first, mid - 1);
+
+    if (mid < range.second)
+      ranges.emplace(mid + 1, range.second);
+  }
+  si_->freeState(interp);
+
+  return is_valid;
+}
 }  // namespace tesseract_planning
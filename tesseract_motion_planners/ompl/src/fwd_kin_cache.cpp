@@ -0,0 +1,79 @@
+/**
+ * @file fwd_kin_cache.cpp
+ * @brief Tesseract OMPL planner small forward kinematics cache
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_motion_planners/ompl/fwd_kin_cache.h>
+
+namespace tesseract_planning
+{
+FwdKinCache::FwdKinCache(std::size_t capacity) : capacity_(capacity) { entries_.reserve(capacity_); }
+
+const tesseract_common::TransformMap& FwdKinCache::calcFwdKin(const tesseract_kinematics::JointGroup& manip,
+                                                              const Eigen::Ref<const Eigen::VectorXd>& joint_values)
+{
+  if (capacity_ == 0)
+  {
+    ++misses_;
+    uncached_ = manip.calcFwdKin(joint_values);
+    return uncached_;
+  }
+
+  for (const auto& entry : entries_)
+  {
+    if (entry.first.size() == joint_values.size() && entry.first == joint_values)
+    {
+      ++hits_;
+      return entry.second;
+    }
+  }
+
+  ++misses_;
+  if (entries_.size() < capacity_)
+  {
+    entries_.emplace_back(joint_values, manip.calcFwdKin(joint_values));
+    return entries_.back().second;
+  }
+
+  auto& entry = entries_[next_];
+  entry.first = joint_values;
+  entry.second = manip.calcFwdKin(joint_values);
+  next_ = (next_ + 1) % capacity_;
+  return entry.second;
+}
+
+std::size_t FwdKinCache::capacity() const { return capacity_; }
+
+std::size_t FwdKinCache::getHitCount() const { return hits_; }
+
+std::size_t FwdKinCache::getMissCount() const { return misses_; }
+
+void FwdKinCache::clear()
+{
+  entries_.clear();
+  next_ = 0;
+  hits_ = 0;
+  misses_ = 0;
+}
+
+}  // namespace tesseract_planning
@@ -0,0 +1,117 @@
+/**
+ * @file lazy_motion_validator.cpp
+ * @brief Tesseract OMPL planner motion validator which defers full motion checks until a path is found
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <ompl/base/SpaceInformation.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/ompl/lazy_motion_validator.h>
+
+namespace tesseract_planning
+{
+LazyMotionValidator::LazyMotionValidator(const ompl::base::SpaceInformationPtr& space_info,
+                                         ompl::base::MotionValidatorPtr motion_validator,
+                                         int check_stride)
+  : MotionValidator(space_info), motion_validator_(std::move(motion_validator)), check_stride_(check_stride)
+{
+  if (motion_validator_ == nullptr)
+    throw std::runtime_error("LazyMotionValidator: The motion validator must not be a nullptr.");
+
+  if (check_stride_ < 0)
+    throw std::runtime_error("LazyMotionValidator: The check stride must be non-negative.");
+}
+
+bool LazyMotionValidator::checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const
+{
+  if (lazy_.load())
+    return checkMotionLazy(s1, s2, nullptr);
+
+  return motion_validator_->checkMotion(s1, s2);
+}
+
+bool LazyMotionValidator::checkMotion(const ompl::base::State* s1,
+                                      const ompl::base::State* s2,
+                                      std::pair<ompl::base::State*, double>& lastValid) const
+{
+  if (lazy_.load())
+    return checkMotionLazy(s1, s2, &lastValid);
+
+  return motion_validator_->checkMotion(s1, s2, lastValid);
+}
+
+void LazyMotionValidator::setLazy(bool lazy) { lazy_.store(lazy); }
+
+bool LazyMotionValidator::isLazy() const { return lazy_.load(); }
+
+int LazyMotionValidator::getCheckStride() const { return check_stride_; }
+
+const ompl::base::MotionValidatorPtr& LazyMotionValidator::getMotionValidator() const { return motion_validator_; }
+
+bool LazyMotionValidator::checkMotionLazy(const ompl::base::State* s1,
+                                          const ompl::base::State* s2,
+                                          std::pair<ompl::base::State*, double>* lastValid) const
+{
+  const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+  unsigned n_steps = state_space.validSegmentCount(s1, s2);
+
+  if (check_stride_ > 0 && n_steps > 1)
+  {
+    const auto stride = static_cast<unsigned>(check_stride_);
+    ompl::base::State* interp = si_->allocState();
+    for (unsigned i = stride; i < n_steps; i += stride)
+    {
+      state_space.interpolate(s1, s2, static_cast<double>(i) / static_cast<double>(n_steps), interp);
+      if (!si_->isValid(interp))
+      {
+        if (lastValid != nullptr)
+        {
+          // Only the checked states are known to be valid
+          lastValid->second = static_cast<double>(i - stride) / static_cast<double>(n_steps);
+          if (lastValid->first != nullptr)
+            state_space.interpolate(s1, s2, lastValid->second, lastValid->first);
+        }
+
+        si_->freeState(interp);
+        return false;
+      }
+    }
+    si_->freeState(interp);
+  }
+
+  if (!si_->isValid(s2))
+  {
+    if (lastValid != nullptr)
+    {
+      lastValid->second = 0;
+      if (lastValid->first != nullptr)
+        si_->copyState(lastValid->first, s1);
+    }
+    return false;
+  }
+
+  return true;
+}
+}  // namespace tesseract_planning
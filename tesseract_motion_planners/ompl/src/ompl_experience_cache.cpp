@@ -0,0 +1,261 @@
+/**
+ * @file ompl_experience_cache.cpp
+ * @brief Tesseract OMPL planner experience cache used to reuse planner roadmaps across requests
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <ompl/base/PlannerDataStorage.h>
+#include <ompl/base/goals/GoalState.h>
+#include <ompl/base/goals/GoalStates.h>
+#include <ompl/geometric/planners/prm/PRM.h>
+#include <ompl/geometric/planners/prm/LazyPRM.h>
+#include <cctype>
+#include <functional>
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/ompl/ompl_experience_cache.h>
+
+namespace tesseract_planning
+{
+void OMPLExperience::setQuery(const ompl::base::ProblemDefinition& pdef,
+                              const ompl::base::OptimizationObjectivePtr& objective) const
+{
+  const ompl::base::SpaceInformationPtr& si = simple_setup->getSpaceInformation();
+  const ompl::base::ProblemDefinitionPtr& exp_pdef = simple_setup->getProblemDefinition();
+
+  // The problem was already solved using this experience so only the previous solutions need to be cleared
+  if (&pdef == exp_pdef.get())
+  {
+    exp_pdef->clearSolutionPaths();
+    for (const auto& planner : planners)
+      planner->clearQuery();
+
+    return;
+  }
+
+  exp_pdef->clearSolutionPaths();
+  exp_pdef->clearStartStates();
+  exp_pdef->clearGoal();
+
+  // The objective (and its cost threshold) may depend on the query so it is replaced
+  exp_pdef->setOptimizationObjective(objective);
+
+  // The states are copied by the problem definition and goals using the experience space information
+  for (unsigned i = 0; i < pdef.getStartStateCount(); ++i)
+    exp_pdef->addStartState(pdef.getStartState(i));
+
+  const ompl::base::GoalPtr& goal = pdef.getGoal();
+  if (goal->getType() == ompl::base::GoalType::GOAL_STATE)
+  {
+    auto goal_state = std::make_shared<ompl::base::GoalState>(si);
+    goal_state->setState(goal->as<ompl::base::GoalState>()->getState());
+    exp_pdef->setGoal(goal_state);
+  }
+  else if (goal->getType() == ompl::base::GoalType::GOAL_STATES)
+  {
+    const auto* goal_states = goal->as<ompl::base::GoalStates>();
+    auto exp_goal_states = std::make_shared<ompl::base::GoalStates>(si);
+    for (unsigned i = 0; i < goal_states->getStateCount(); ++i)
+      exp_goal_states->addState(goal_states->getState(i));
+
+    exp_pdef->setGoal(exp_goal_states);
+  }
+  else
+  {
+    throw std::runtime_error("OMPLExperience: Unsupported goal type!");
+  }
+
+  for (const auto& planner : planners)
+  {
+    planner->clearQuery();
+    planner->setProblemDefinition(exp_pdef);
+  }
+}
+
+OMPLExperienceCache::OMPLExperienceCache(tesseract_common::fs::path directory) : directory_(std::move(directory)) {}
+
+std::string OMPLExperienceCache::createKey(const std::string& env_name,
+                                           const std::string& manipulator,
+                                           const std::string& config)
+{
+  std::stringstream key;
+  key << env_name << "::" << manipulator << "::" << std::hex << std::hash<std::string>{}(config);
+  return key.str();
+}
+
+OMPLExperience::Ptr OMPLExperienceCache::checkout(const std::string& key,
+                                                  int revision,
+                                                  const std::unordered_map<std::string, double>& static_joint_values)
+{
+  std::scoped_lock lock(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end())
+    return nullptr;
+
+  OMPLExperience::Ptr experience = it->second;
+  entries_.erase(it);
+
+  if (experience->revision != revision || experience->static_joint_values != static_joint_values)
+  {
+    CONSOLE_BRIDGE_logDebug("OMPLExperienceCache: Discarding experience for '%s', environment changed", key.c_str());
+    return nullptr;
+  }
+
+  return experience;
+}
+
+void OMPLExperienceCache::checkin(const std::string& key, OMPLExperience::Ptr experience)
+{
+  if (experience == nullptr)
+    return;
+
+  std::scoped_lock lock(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end() || it->second->revision != experience->revision)
+    entries_[key] = std::move(experience);
+}
+
+void OMPLExperienceCache::clear()
+{
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+}
+
+std::size_t OMPLExperienceCache::size() const
+{
+  std::scoped_lock lock(mutex_);
+  return entries_.size();
+}
+
+const tesseract_common::fs::path& OMPLExperienceCache::getDirectory() const { return directory_; }
+
+bool OMPLExperienceCache::save() const
+{
+  if (directory_.empty())
+    return false;
+
+  std::scoped_lock lock(mutex_);
+  ompl::base::PlannerDataStorage storage;
+  for (const auto& entry : entries_)
+  {
+    const OMPLExperience& experience = *entry.second;
+    for (std::size_t i = 0; i < experience.planners.size(); ++i)
+    {
+      if (!isMultiQuery(experience.planner_types[i]))
+        continue;
+
+      ompl::base::PlannerData data(experience.simple_setup->getSpaceInformation());
+      experience.planners[i]->getPlannerData(data);
+
+      std::string file_path = getFilePath(entry.first, experience.revision, i).string();
+      if (!storage.store(data, file_path.c_str()))
+      {
+        CONSOLE_BRIDGE_logError("OMPLExperienceCache: Failed to save roadmap '%s'", file_path.c_str());
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+ompl::base::PlannerPtr OMPLExperienceCache::loadPlanner(const std::string& key,
+                                                        int revision,
+                                                        std::size_t index,
+                                                        const OMPLPlannerConfigurator& config,
+                                                        const ompl::base::SpaceInformationPtr& si) const
+{
+  if (directory_.empty() || !isMultiQuery(config.getType()))
+    return nullptr;
+
+  tesseract_common::fs::path file_path = getFilePath(key, revision, index);
+  if (!tesseract_common::fs::exists(file_path))
+    return nullptr;
+
+  ompl::base::PlannerData data(si);
+  ompl::base::PlannerDataStorage storage;
+  if (!storage.load(file_path.string().c_str(), data))
+  {
+    CONSOLE_BRIDGE_logError("OMPLExperienceCache: Failed to load roadmap '%s'", file_path.string().c_str());
+    return nullptr;
+  }
+
+  return createPlanner(data, config);
+}
+
+ompl::base::PlannerPtr OMPLExperienceCache::createPlanner(const ompl::base::PlannerData& data,
+                                                          const OMPLPlannerConfigurator& config)
+{
+  switch (config.getType())
+  {
+    case OMPLPlannerType::PRM:
+    {
+      auto planner = std::make_shared<ompl::geometric::PRM>(data, false);
+      if (const auto* prm_config = dynamic_cast<const PRMConfigurator*>(&config))
+        planner->setMaxNearestNeighbors(static_cast<unsigned>(prm_config->max_nearest_neighbors));
+
+      return planner;
+    }
+    case OMPLPlannerType::PRMstar:
+      return std::make_shared<ompl::geometric::PRM>(data, true);
+    case OMPLPlannerType::LazyPRMstar:
+      return std::make_shared<ompl::geometric::LazyPRM>(data, true);
+    case OMPLPlannerType::LazyPRM:
+    {
+      auto planner = std::make_shared<ompl::geometric::LazyPRM>(data, false);
+      if (const auto* lazy_prm_config = dynamic_cast<const LazyPRMConfigurator*>(&config))
+      {
+        planner->setRange(lazy_prm_config->range);
+        planner->setMaxNearestNeighbors(static_cast<unsigned>(lazy_prm_config->max_nearest_neighbors));
+      }
+
+      return planner;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+bool OMPLExperienceCache::isMultiQuery(OMPLPlannerType type)
+{
+  return (type == OMPLPlannerType::PRM || type == OMPLPlannerType::PRMstar || type == OMPLPlannerType::LazyPRMstar ||
+          type == OMPLPlannerType::LazyPRM);
+}
+
+tesseract_common::fs::path OMPLExperienceCache::getFilePath(const std::string& key, int revision, std::size_t index) const
+{
+  std::string file_name = key;
+  for (auto& c : file_name)
+  {
+    if (std::isalnum(static_cast<unsigned char>(c)) == 0 && c != '_' && c != '-')
+      c = '_';
+  }
+
+  file_name += "_r" + std::to_string(revision) + "_" + std::to_string(index) + ".graph";
+  return directory_ / file_name;
+}
+
+}  // namespace tesseract_planning
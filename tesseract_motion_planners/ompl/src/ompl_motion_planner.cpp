@@ -30,6 +30,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/goals/GoalState.h>
 #include <ompl/base/goals/GoalStates.h>
 #include <ompl/tools/multiplan/ParallelPlan.h>
+#include <ompl/base/PlannerData.h>
+#include <tuple>
+#include <utility>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/utils.h>
@@ -37,6 +40,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/planner_utils.h>
 
 #include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
+#include <tesseract_motion_planners/ompl/lazy_motion_validator.h>
+#include <tesseract_motion_planners/ompl/ompl_experience_cache.h>
+#include <tesseract_motion_planners/ompl/utils.h>
 #include <tesseract_motion_planners/ompl/continuous_motion_validator.h>
 #include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
@@ -88,6 +94,175 @@ bool checkGoalState(const ompl::base::ProblemDefinitionPtr& prob_def,
   return false;
 }
 
+/** @brief Get the values of the joints in the environment state which are not part of the problem manipulator */
+std::unordered_map<std::string, double> getStaticJointValues(const OMPLProblem& prob)
+{
+  std::unordered_map<std::string, double> static_joint_values = prob.env_state.joints;
+  for (const auto& joint_name : prob.manip->getJointNames())
+    static_joint_values.erase(joint_name);
+
+  return static_joint_values;
+}
+
+/** @brief Returns the experience used by a request to its cache when the request completes */
+class ExperienceCheckin
+{
+public:
+  ExperienceCheckin() = default;
+  ~ExperienceCheckin()
+  {
+    for (auto& entry : entries_)
+      std::get<0>(entry)->checkin(std::get<1>(entry), std::get<2>(entry));
+  }
+  ExperienceCheckin(const ExperienceCheckin&) = delete;
+  ExperienceCheckin& operator=(const ExperienceCheckin&) = delete;
+  ExperienceCheckin(ExperienceCheckin&&) = delete;
+  ExperienceCheckin& operator=(ExperienceCheckin&&) = delete;
+
+  void add(OMPLExperienceCache::Ptr cache, std::string key, OMPLExperience::Ptr experience)
+  {
+    entries_.emplace_back(std::move(cache), std::move(key), std::move(experience));
+  }
+
+private:
+  std::vector<std::tuple<OMPLExperienceCache::Ptr, std::string, OMPLExperience::Ptr>> entries_;
+};
+
+/** @brief A motion between two states of a solution path */
+using OMPLMotion = std::pair<const ompl::base::State*, const ompl::base::State*>;
+
+/**
+ * @brief Find the motions of a path which are invalid
+ * @param path The path
+ * @return The invalid motions, the states are owned by the path
+ */
+std::vector<OMPLMotion> findInvalidMotions(const ompl::geometric::PathGeometric& path)
+{
+  const ompl::base::SpaceInformationPtr& si = path.getSpaceInformation();
+  std::vector<OMPLMotion> invalid_motions;
+  for (std::size_t i = 1; i < path.getStateCount(); ++i)
+  {
+    if (!si->checkMotion(path.getState(i - 1), path.getState(i)))
+      invalid_motions.emplace_back(path.getState(i - 1), path.getState(i));
+  }
+
+  return invalid_motions;
+}
+
+/**
+ * @brief Remove invalid motions from a planner so they are not used when searching again
+ * @details The roadmap of a multi-query planner is kept and only the edges of the invalid motions are removed, all
+ * other planners are cleared since their data only applies to the current query.
+ * @param planner The planner
+ * @param config The planner configurator
+ * @param invalid_motions The invalid motions
+ * @return The planner to search with, this is a new planner if edges were removed from the roadmap
+ */
+ompl::base::PlannerPtr removeInvalidMotions(const ompl::base::PlannerPtr& planner,
+                                            const OMPLPlannerConfigurator& config,
+                                            const std::vector<OMPLMotion>& invalid_motions)
+{
+  if (!OMPLExperienceCache::isMultiQuery(config.getType()))
+  {
+    planner->clear();
+    return planner;
+  }
+
+  const ompl::base::SpaceInformationPtr& si = planner->getSpaceInformation();
+  ompl::base::PlannerData data(si);
+  planner->getPlannerData(data);
+
+  // The solution path holds copies of the roadmap states
+  auto findVertex = [&si, &data](const ompl::base::State* state) {
+    for (unsigned i = 0; i < data.numVertices(); ++i)
+    {
+      if (si->equalStates(data.getVertex(i).getState(), state))
+        return i;
+    }
+    return ompl::base::PlannerData::INVALID_INDEX;
+  };
+
+  bool removed{ false };
+  for (const auto& motion : invalid_motions)
+  {
+    const unsigned v1 = findVertex(motion.first);
+    const unsigned v2 = findVertex(motion.second);
+    if (v1 == ompl::base::PlannerData::INVALID_INDEX || v2 == ompl::base::PlannerData::INVALID_INDEX)
+      continue;
+
+    // The roadmap is undirected so the edge is stored in both directions
+    removed = data.removeEdge(v1, v2) || removed;
+    removed = data.removeEdge(v2, v1) || removed;
+  }
+
+  if (!removed)
+    return planner;
+
+  ompl::base::PlannerPtr new_planner = OMPLExperienceCache::createPlanner(data, config);
+  if (new_planner == nullptr)
+  {
+    planner->clear();
+    return planner;
+  }
+
+  return new_planner;
+}
+
+/**
+ * @brief Solve the problem using the planners of the parallel plan
+ * @param parallel_plan The parallel plan
+ * @param pdef The problem definition being solved
+ * @param p The problem
+ * @param planning_time The time available in seconds
+ * @return The planner status
+ */
+ompl::base::PlannerStatus solveParallelPlan(ompl::tools::ParallelPlan& parallel_plan,
+                                            const ompl::base::ProblemDefinitionPtr& pdef,
+                                            const OMPLProblem& p,
+                                            double planning_time)
+{
+  // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
+  // and finishes at the end state.
+  if (!p.optimize)
+    return parallel_plan.solve(planning_time, 1, static_cast<unsigned>(p.max_solutions), false);
+
+  ompl::base::PlannerStatus status;
+  ompl::time::point end = ompl::time::now() + ompl::time::seconds(planning_time);
+  while (ompl::time::now() < end)
+  {
+    ompl::base::PlannerStatus localResult = parallel_plan.solve(
+        std::max(ompl::time::seconds(end - ompl::time::now()), 0.0), 1, static_cast<unsigned>(p.max_solutions), false);
+    if (localResult)
+    {
+      if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
+        status = localResult;
+
+      if (!pdef->hasOptimizationObjective())
+      {
+        CONSOLE_BRIDGE_logDebug("Terminating early since there is no optimization objective specified");
+        break;
+      }
+
+      ompl::base::Cost obj_cost = pdef->getSolutionPath()->cost(pdef->getOptimizationObjective());
+      CONSOLE_BRIDGE_logDebug("Motion Objective Cost: %f", obj_cost.value());
+
+      if (pdef->getOptimizationObjective()->isSatisfied(obj_cost))
+      {
+        CONSOLE_BRIDGE_logDebug("Terminating early since solution path satisfies the optimization objective");
+        break;
+      }
+
+      if (pdef->getSolutionCount() >= static_cast<std::size_t>(p.max_solutions))
+      {
+        CONSOLE_BRIDGE_logDebug("Terminating early since %u solutions were generated", p.max_solutions);
+        break;
+      }
+    }
+  }
+
+  return status;
+}
+
 /** @brief Construct a basic planner */
 OMPLMotionPlanner::OMPLMotionPlanner(std::string name) : MotionPlanner(std::move(name)) {}
 
@@ -132,67 +307,124 @@ PlannerResponse OMPLMotionPlanner::solve(const PlannerRequest& request) const
   if (request.verbose)
     console_bridge::setLogLevel(console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_DEBUG);
 
+  // The experience used by each problem is returned to its cache when this goes out of scope
+  ExperienceCheckin experience_checkin;
+
+  // The simple setup solved for each problem, this differs from the problem's when reusing experience
+  std::vector<ompl::geometric::SimpleSetupPtr> simple_setups;
+  simple_setups.reserve(problems.size());
+
   /// @todo: Need to expand this to support multiple motion plans leveraging taskflow
   for (auto& pc : problems)
   {
     auto& p = pc.problem;
-    p->simple_setup->setup();
-    auto parallel_plan = std::make_shared<ompl::tools::ParallelPlan>(p->simple_setup->getProblemDefinition());
-
-    for (const auto& planner : p->planners)
-      parallel_plan->addPlanner(planner->create(p->simple_setup->getSpaceInformation()));
+    ompl::geometric::SimpleSetupPtr simple_setup = p->simple_setup;
+    std::vector<ompl::base::PlannerPtr> planners;
+    OMPLExperience::Ptr experience;
+    std::string experience_key;
+    if (p->experience_cache != nullptr)
+    {
+      experience_key = OMPLExperienceCache::createKey(p->env->getName(), p->manip->getName(), p->experience_config);
+      experience = p->experience_cache->checkout(experience_key, p->env->getRevision(), getStaticJointValues(*p));
+    }
 
-    ompl::base::PlannerStatus status;
-    if (!p->optimize)
+    if (experience != nullptr)
     {
-      // Solve problem. Results are stored in the response
-      // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
-      // and finishes at the end state.
-      status = parallel_plan->solve(p->planning_time, 1, static_cast<unsigned>(p->max_solutions), false);
+      // Plan using the space information and planners kept from previous requests
+      CONSOLE_BRIDGE_logDebug("OMPLMotionPlanner: Reusing experience for '%s'", experience_key.c_str());
+      simple_setup = experience->simple_setup;
+      ompl::base::OptimizationObjectivePtr objective;
+      if (p->optimization_objective_allocator)
+        objective = p->optimization_objective_allocator(simple_setup->getSpaceInformation(), *p);
+
+      experience->setQuery(*p->simple_setup->getProblemDefinition(), objective);
+      simple_setup->setup();
+      planners = experience->planners;
     }
     else
     {
-      ompl::time::point end = ompl::time::now() + ompl::time::seconds(p->planning_time);
-      const ompl::base::ProblemDefinitionPtr& pdef = p->simple_setup->getProblemDefinition();
-      while (ompl::time::now() < end)
+      simple_setup->setup();
+      const ompl::base::SpaceInformationPtr& si = simple_setup->getSpaceInformation();
+      for (std::size_t i = 0; i < p->planners.size(); ++i)
       {
-        // Solve problem. Results are stored in the response
-        // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
-        // and finishes at the end state.
-        ompl::base::PlannerStatus localResult =
-            parallel_plan->solve(std::max(ompl::time::seconds(end - ompl::time::now()), 0.0),
-                                 1,
-                                 static_cast<unsigned>(p->max_solutions),
-                                 false);
-        if (localResult)
-        {
-          if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
-            status = localResult;
+        ompl::base::PlannerPtr planner;
+        if (p->experience_cache != nullptr)
+          planner = p->experience_cache->loadPlanner(experience_key, p->env->getRevision(), i, *p->planners[i], si);
 
-          if (!pdef->hasOptimizationObjective())
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since there is no optimization objective specified");
-            break;
-          }
+        if (planner == nullptr)
+          planner = p->planners[i]->create(si);
+
+        planners.push_back(planner);
+      }
 
-          ompl::base::Cost obj_cost = pdef->getSolutionPath()->cost(pdef->getOptimizationObjective());
-          CONSOLE_BRIDGE_logDebug("Motion Objective Cost: %f", obj_cost.value());
+      if (p->experience_cache != nullptr)
+      {
+        experience = std::make_shared<OMPLExperience>();
+        experience->revision = p->env->getRevision();
+        experience->static_joint_values = getStaticJointValues(*p);
+        experience->simple_setup = simple_setup;
+        experience->planners = planners;
+        for (const auto& planner : p->planners)
+          experience->planner_types.push_back(planner->getType());
+      }
+    }
 
-          if (pdef->getOptimizationObjective()->isSatisfied(obj_cost))
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since solution path satisfies the optimization objective");
-            break;
-          }
+    if (experience != nullptr)
+      experience_checkin.add(p->experience_cache, experience_key, experience);
 
-          if (pdef->getSolutionCount() >= static_cast<std::size_t>(p->max_solutions))
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since %u solutions were generated", p->max_solutions);
-            break;
-          }
-        }
+    simple_setups.push_back(simple_setup);
+    auto parallel_plan = std::make_shared<ompl::tools::ParallelPlan>(simple_setup->getProblemDefinition());
+    for (const auto& planner : planners)
+      parallel_plan->addPlanner(planner);
+
+    const ompl::base::ProblemDefinitionPtr& pdef = simple_setup->getProblemDefinition();
+    ompl::time::point end = ompl::time::now() + ompl::time::seconds(p->planning_time);
+
+    auto* lazy_mv = dynamic_cast<LazyMotionValidator*>(simple_setup->getSpaceInformation()->getMotionValidator().get());
+    if (lazy_mv != nullptr)
+      lazy_mv->setLazy(true);
+
+    ompl::base::PlannerStatus status = solveParallelPlan(*parallel_plan, pdef, *p, p->planning_time);
+
+    // The motions were only partially checked while searching so validate the solution using full checking. Invalid
+    // motions are removed from the planners and the search is repeated until a valid solution is found.
+    while (lazy_mv != nullptr && status == ompl::base::PlannerStatus::EXACT_SOLUTION)
+    {
+      lazy_mv->setLazy(false);
+      const ompl::geometric::PathGeometric path = simple_setup->getSolutionPath();
+      const std::vector<OMPLMotion> invalid_motions = findInvalidMotions(path);
+      if (invalid_motions.empty())
+        break;
+
+      const double remaining_time = ompl::time::seconds(end - ompl::time::now());
+      if (remaining_time <= 0)
+      {
+        status = ompl::base::PlannerStatus::TIMEOUT;
+        break;
       }
+
+      CONSOLE_BRIDGE_logDebug("OMPLMotionPlanner: Lazy solution has %zu invalid motions, searching again without them",
+                              invalid_motions.size());
+
+      pdef->clearSolutionPaths();
+      parallel_plan->clearHybridizationPaths();
+      parallel_plan->clearPlanners();
+      for (std::size_t i = 0; i < planners.size(); ++i)
+      {
+        planners[i] = removeInvalidMotions(planners[i], *p->planners[i], invalid_motions);
+        parallel_plan->addPlanner(planners[i]);
+      }
+
+      if (experience != nullptr)
+        experience->planners = planners;
+
+      lazy_mv->setLazy(true);
+      status = solveParallelPlan(*parallel_plan, pdef, *p, remaining_time);
     }
 
+    if (lazy_mv != nullptr)
+      lazy_mv->setLazy(false);
+
     if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
     {
       response.successful = false;
@@ -202,23 +434,23 @@ PlannerResponse OMPLMotionPlanner::solve(const PlannerRequest& request) const
 
     if (p->simplify)
     {
-      p->simple_setup->simplifySolution();
+      simple_setup->simplifySolution();
     }
     else
     {
       // Interpolate the path if it shouldn't be simplified and there are currently fewer states than requested
       auto num_output_states = static_cast<unsigned>(p->n_output_states);
-      if (p->simple_setup->getSolutionPath().getStateCount() < num_output_states)
+      if (simple_setup->getSolutionPath().getStateCount() < num_output_states)
       {
-        p->simple_setup->getSolutionPath().interpolate(num_output_states);
+        simple_setup->getSolutionPath().interpolate(num_output_states);
       }
       else
       {
         // Now try to simplify the trajectory to get it under the requested number of output states
         // The interpolate function only executes if the current number of states is less than the requested
-        p->simple_setup->simplifySolution();
-        if (p->simple_setup->getSolutionPath().getStateCount() < num_output_states)
-          p->simple_setup->getSolutionPath().interpolate(num_output_states);
+        simple_setup->simplifySolution();
+        if (simple_setup->getSolutionPath().getStateCount() < num_output_states)
+          simple_setup->getSolutionPath().interpolate(num_output_states);
       }
     }
   }
@@ -229,12 +461,14 @@ PlannerResponse OMPLMotionPlanner::solve(const PlannerRequest& request) const
   response.results = request.instructions;
 
   std::size_t start_index{ 0 };
-  for (auto& pc : problems)
+  for (std::size_t i = 0; i < problems.size(); ++i)
   {
+    auto& pc = problems[i];
     auto& p = pc.problem;
-    tesseract_common::TrajArray traj = p->getTrajectory();
-    assert(checkStartState(p->simple_setup->getProblemDefinition(), traj.row(0), p->extractor));
-    assert(checkGoalState(p->simple_setup->getProblemDefinition(), traj.bottomRows(1).transpose(), p->extractor));
+    const ompl::geometric::SimpleSetupPtr& simple_setup = simple_setups[i];
+    tesseract_common::TrajArray traj = toTrajArray(simple_setup->getSolutionPath(), p->extractor);
+    assert(checkStartState(simple_setup->getProblemDefinition(), traj.row(0), p->extractor));
+    assert(checkGoalState(simple_setup->getProblemDefinition(), traj.bottomRows(1).transpose(), p->extractor));
     assert(traj.rows() >= p->n_output_states);
 
     const std::vector<std::string> joint_names = p->manip->getJointNames();
@@ -40,6 +40,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/geometric/planners/prm/PRMstar.h>
 #include <ompl/geometric/planners/prm/LazyPRMstar.h>
 #include <ompl/geometric/planners/prm/SPARS.h>
+#include <ompl/geometric/planners/prm/LazyPRM.h>
+#include <ompl/geometric/planners/rrt/LazyRRT.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
@@ -1070,4 +1072,125 @@ tinyxml2::XMLElement* SPARSConfigurator::toXML(tinyxml2::XMLDocument& doc) const
 
   return ompl_xml;
 }
+
+LazyPRMConfigurator::LazyPRMConfigurator(const tinyxml2::XMLElement& xml_element)
+{
+  const tinyxml2::XMLElement* lazy_prm_element = xml_element.FirstChildElement("LazyPRM");
+  const tinyxml2::XMLElement* range_element = lazy_prm_element->FirstChildElement("Range");
+  const tinyxml2::XMLElement* nearest_neighbors_element = lazy_prm_element->FirstChildElement("MaxNearestNeighbors");
+
+  tinyxml2::XMLError status{ tinyxml2::XMLError::XML_SUCCESS };
+
+  if (range_element != nullptr)
+  {
+    std::string range_string;
+    status = tesseract_common::QueryStringText(range_element, range_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLConfigurator: LazyPRM: Error parsing Range string");
+
+    if (!tesseract_common::isNumeric(range_string))
+      throw std::runtime_error("OMPLConfigurator: LazyPRM: Range is not a numeric values.");
+
+    tesseract_common::toNumeric<double>(range_string, range);
+  }
+
+  if (nearest_neighbors_element != nullptr)
+  {
+    std::string nearest_neighbors_string;
+    status = tesseract_common::QueryStringText(nearest_neighbors_element, nearest_neighbors_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLConfigurator: LazyPRM: Error parsing MaxNearestNeighbors string");
+
+    if (!tesseract_common::isNumeric(nearest_neighbors_string))
+      throw std::runtime_error("OMPLConfigurator: LazyPRM: MaxNearestNeighbors is not a numeric values.");
+
+    tesseract_common::toNumeric<int>(nearest_neighbors_string, max_nearest_neighbors);
+  }
+}
+
+ompl::base::PlannerPtr LazyPRMConfigurator::create(ompl::base::SpaceInformationPtr si) const
+{
+  auto planner = std::make_shared<ompl::geometric::LazyPRM>(si);
+  planner->setRange(range);
+  planner->setMaxNearestNeighbors(static_cast<unsigned>(max_nearest_neighbors));
+  return planner;
+}
+
+OMPLPlannerType LazyPRMConfigurator::getType() const { return OMPLPlannerType::LazyPRM; }
+
+tinyxml2::XMLElement* LazyPRMConfigurator::toXML(tinyxml2::XMLDocument& doc) const
+{
+  tinyxml2::XMLElement* ompl_xml = doc.NewElement("LazyPRM");
+
+  tinyxml2::XMLElement* range_xml = doc.NewElement("Range");
+  range_xml->SetText(range);
+  ompl_xml->InsertEndChild(range_xml);
+
+  tinyxml2::XMLElement* nearest_neighbors_xml = doc.NewElement("MaxNearestNeighbors");
+  nearest_neighbors_xml->SetText(max_nearest_neighbors);
+  ompl_xml->InsertEndChild(nearest_neighbors_xml);
+
+  return ompl_xml;
+}
+
+LazyRRTConfigurator::LazyRRTConfigurator(const tinyxml2::XMLElement& xml_element)
+{
+  const tinyxml2::XMLElement* lazy_rrt_element = xml_element.FirstChildElement("LazyRRT");
+  const tinyxml2::XMLElement* range_element = lazy_rrt_element->FirstChildElement("Range");
+  const tinyxml2::XMLElement* goal_bias_element = lazy_rrt_element->FirstChildElement("GoalBias");
+
+  tinyxml2::XMLError status{ tinyxml2::XMLError::XML_SUCCESS };
+
+  if (range_element != nullptr)
+  {
+    std::string range_string;
+    status = tesseract_common::QueryStringText(range_element, range_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLConfigurator: LazyRRT: Error parsing Range string");
+
+    if (!tesseract_common::isNumeric(range_string))
+      throw std::runtime_error("OMPLConfigurator: LazyRRT: Range is not a numeric values.");
+
+    tesseract_common::toNumeric<double>(range_string, range);
+  }
+
+  if (goal_bias_element != nullptr)
+  {
+    std::string goal_bias_string;
+    status = tesseract_common::QueryStringText(goal_bias_element, goal_bias_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLConfigurator: LazyRRT: Error parsing GoalBias string");
+
+    if (!tesseract_common::isNumeric(goal_bias_string))
+      throw std::runtime_error("OMPLConfigurator: LazyRRT: GoalBias is not a numeric values.");
+
+    tesseract_common::toNumeric<double>(goal_bias_string, goal_bias);
+  }
+}
+
+ompl::base::PlannerPtr LazyRRTConfigurator::create(ompl::base::SpaceInformationPtr si) const
+{
+  auto planner = std::make_shared<ompl::geometric::LazyRRT>(si);
+  planner->setRange(range);
+  planner->setGoalBias(goal_bias);
+  return planner;
+}
+
+OMPLPlannerType LazyRRTConfigurator::getType() const { return OMPLPlannerType::LazyRRT; }
+
+tinyxml2::XMLElement* LazyRRTConfigurator::toXML(tinyxml2::XMLDocument& doc) const
+{
+  tinyxml2::XMLElement* ompl_xml = doc.NewElement("LazyRRT");
+
+  tinyxml2::XMLElement* range_xml = doc.NewElement("Range");
+  range_xml->SetText(range);
+  ompl_xml->InsertEndChild(range_xml);
+
+  tinyxml2::XMLElement* goal_bias_xml = doc.NewElement("GoalBias");
+  goal_bias_xml->SetText(goal_bias);
+  ompl_xml->InsertEndChild(goal_bias_xml);
+
+  return ompl_xml;
+}
+
 }  // namespace tesseract_planning
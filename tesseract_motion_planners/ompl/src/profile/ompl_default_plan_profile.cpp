@@ -31,6 +31,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/objectives/PathLengthOptimizationObjective.h>
 #include <ompl/base/goals/GoalStates.h>
 #include <boost/algorithm/string.hpp>
+#include <limits>
+#include <sstream>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/poly/move_instruction_poly.h>
@@ -40,10 +42,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/continuous_motion_validator.h>
 #include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
+#include <tesseract_motion_planners/ompl/lazy_motion_validator.h>
 #include <tesseract_motion_planners/ompl/state_collision_validator.h>
 #include <tesseract_motion_planners/ompl/compound_state_validator.h>
 
 #include <tesseract_kinematics/core/utils.h>
+#include <tesseract_common/serialization.h>
 
 namespace tesseract_planning
 {
@@ -55,6 +59,10 @@ OMPLDefaultPlanProfile::OMPLDefaultPlanProfile(const tinyxml2::XMLElement& xml_e
   const tinyxml2::XMLElement* simplify_element = xml_element.FirstChildElement("Simplify");
   const tinyxml2::XMLElement* optimize_element = xml_element.FirstChildElement("Optimize");
   const tinyxml2::XMLElement* planners_element = xml_element.FirstChildElement("Planners");
+  const tinyxml2::XMLElement* motion_validation_order_element =
+      xml_element.FirstChildElement("MotionValidationOrder");
+  const tinyxml2::XMLElement* fwd_kin_cache_size_element = xml_element.FirstChildElement("FwdKinCacheSize");
+  const tinyxml2::XMLElement* lazy_collision_check_element = xml_element.FirstChildElement("LazyCollisionCheck");
   //  const tinyxml2::XMLElement* collision_check_element = xml_element.FirstChildElement("CollisionCheck");
   //  const tinyxml2::XMLElement* collision_continuous_element = xml_element.FirstChildElement("CollisionContinuous");
   //  const tinyxml2::XMLElement* collision_safety_margin_element =
@@ -215,6 +223,18 @@ OMPLDefaultPlanProfile::OMPLDefaultPlanProfile(const tinyxml2::XMLElement& xml_e
           planners.push_back(ompl_planner);
           break;
         }
+        case static_cast<int>(OMPLPlannerType::LazyPRM):
+        {
+          LazyPRMConfigurator::ConstPtr ompl_planner = std::make_shared<const LazyPRMConfigurator>(*e);
+          planners.push_back(ompl_planner);
+          break;
+        }
+        case static_cast<int>(OMPLPlannerType::LazyRRT):
+        {
+          LazyRRTConfigurator::ConstPtr ompl_planner = std::make_shared<const LazyRRTConfigurator>(*e);
+          planners.push_back(ompl_planner);
+          break;
+        }
         default:
         {
           throw std::runtime_error("Unsupported OMPL Planner type");
@@ -223,6 +243,48 @@ OMPLDefaultPlanProfile::OMPLDefaultPlanProfile(const tinyxml2::XMLElement& xml_e
     }
   }
 
+  if (motion_validation_order_element != nullptr)
+  {
+    auto type = static_cast<int>(OMPLMotionValidationOrder::LINEAR);
+    status = motion_validation_order_element->QueryIntAttribute("type", &type);
+    if (status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLPlanProfile: Error parsing MotionValidationOrder type attribute.");
+
+    motion_validation_order = static_cast<OMPLMotionValidationOrder>(type);
+  }
+
+  if (fwd_kin_cache_size_element != nullptr)
+  {
+    std::string fwd_kin_cache_size_string;
+    status = tesseract_common::QueryStringText(fwd_kin_cache_size_element, fwd_kin_cache_size_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLPlanProfile: Error parsing FwdKinCacheSize string");
+
+    if (!tesseract_common::isNumeric(fwd_kin_cache_size_string))
+      throw std::runtime_error("OMPLPlanProfile: FwdKinCacheSize is not a numeric values.");
+
+    int cache_size{ 0 };
+    tesseract_common::toNumeric<int>(fwd_kin_cache_size_string, cache_size);
+    if (cache_size < 0)
+      throw std::runtime_error("OMPLPlanProfile: FwdKinCacheSize must be non-negative.");
+
+    fwd_kin_cache_size = static_cast<std::size_t>(cache_size);
+  }
+
+  if (lazy_collision_check_element != nullptr)
+  {
+    status = lazy_collision_check_element->QueryBoolText(&lazy_collision_check);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLPlanProfile: Error parsing LazyCollisionCheck string");
+
+    status = lazy_collision_check_element->QueryIntAttribute("stride", &lazy_check_stride);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLPlanProfile: Error parsing LazyCollisionCheck stride attribute.");
+
+    if (lazy_check_stride < 0)
+      throw std::runtime_error("OMPLPlanProfile: LazyCollisionCheck stride must be non-negative.");
+  }
+
   /// @todo Update XML
   //  if (collision_check_element)
   //  {
@@ -289,6 +351,9 @@ void OMPLDefaultPlanProfile::setup(OMPLProblem& prob) const
   prob.max_solutions = max_solutions;
   prob.simplify = simplify;
   prob.optimize = optimize;
+  prob.experience_cache = experience_cache;
+  if (experience_cache != nullptr)
+    prob.experience_config = getExperienceConfig();
 
   prob.contact_checker->applyContactManagerConfig(collision_check_config.contact_manager_config);
 
@@ -664,6 +729,20 @@ tinyxml2::XMLElement* OMPLDefaultPlanProfile::toXML(tinyxml2::XMLDocument& doc)
   xml_optimize->SetText(optimize);
   xml_ompl->InsertEndChild(xml_optimize);
 
+  tinyxml2::XMLElement* xml_motion_validation_order = doc.NewElement("MotionValidationOrder");
+  xml_motion_validation_order->SetAttribute("type",
+                                            std::to_string(static_cast<int>(motion_validation_order)).c_str());
+  xml_ompl->InsertEndChild(xml_motion_validation_order);
+
+  tinyxml2::XMLElement* xml_fwd_kin_cache_size = doc.NewElement("FwdKinCacheSize");
+  xml_fwd_kin_cache_size->SetText(std::to_string(fwd_kin_cache_size).c_str());
+  xml_ompl->InsertEndChild(xml_fwd_kin_cache_size);
+
+  tinyxml2::XMLElement* xml_lazy_collision_check = doc.NewElement("LazyCollisionCheck");
+  xml_lazy_collision_check->SetAttribute("stride", lazy_check_stride);
+  xml_lazy_collision_check->SetText(lazy_collision_check);
+  xml_ompl->InsertEndChild(xml_lazy_collision_check);
+
   /// @todo Update XML
   //  tinyxml2::XMLElement* xml_collision_check = doc.NewElement("CollisionCheck");
   //  xml_collision_check->SetText(collision_check);
@@ -693,6 +772,41 @@ tinyxml2::XMLElement* OMPLDefaultPlanProfile::toXML(tinyxml2::XMLDocument& doc)
   return xml_planner;
 }
 
+const std::string& OMPLDefaultPlanProfile::getExperienceConfig() const
+{
+  std::call_once(experience_config_cache_.once,
+                 [this] { experience_config_cache_.config = createExperienceConfig(); });
+  return experience_config_cache_.config;
+}
+
+std::string OMPLDefaultPlanProfile::createExperienceConfig() const
+{
+  tinyxml2::XMLDocument doc;
+  doc.InsertEndChild(toXML(doc));
+  tinyxml2::XMLPrinter printer;
+  doc.Print(&printer);
+
+  std::stringstream config;
+  config.precision(std::numeric_limits<double>::max_digits10);
+  config << printer.CStr();
+
+  // The collision check configuration is not part of the xml
+  const auto& contact_manager_config = collision_check_config.contact_manager_config;
+  config << "CollisionCheckType:" << static_cast<int>(collision_check_config.type) << ";";
+  config << "LongestValidSegmentLength:" << collision_check_config.longest_valid_segment_length << ";";
+  config << "ContactTestType:" << static_cast<int>(collision_check_config.contact_request.type) << ";";
+  config << "MarginDataOverrideType:" << static_cast<int>(contact_manager_config.margin_data_override_type) << ";";
+  config << "MarginData:"
+         << tesseract_common::Serialization::toArchiveStringXML<tesseract_common::CollisionMarginData>(
+                contact_manager_config.margin_data)
+         << ";";
+
+  if (state_sampler_allocator || optimization_objective_allocator || svc_allocator || mv_allocator)
+    config << "Profile:" << this << ";";
+
+  return config.str();
+}
+
 ompl::base::StateValidityCheckerPtr OMPLDefaultPlanProfile::processStateValidator(OMPLProblem& prob) const
 {
   ompl::base::StateValidityCheckerPtr svc_without_collision;
@@ -706,8 +820,12 @@ ompl::base::StateValidityCheckerPtr OMPLDefaultPlanProfile::processStateValidato
   if (collision_check_config.type == tesseract_collision::CollisionEvaluatorType::DISCRETE ||
       collision_check_config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
   {
-    auto svc = std::make_shared<StateCollisionValidator>(
-        prob.simple_setup->getSpaceInformation(), *prob.env, prob.manip, collision_check_config, prob.extractor);
+    auto svc = std::make_shared<StateCollisionValidator>(prob.simple_setup->getSpaceInformation(),
+                                                         *prob.env,
+                                                         prob.manip,
+                                                         collision_check_config,
+                                                         prob.extractor,
+                                                         fwd_kin_cache_size);
     csvc->addStateValidator(svc);
   }
   prob.simple_setup->setStateValidityChecker(csvc);
@@ -719,16 +837,15 @@ void OMPLDefaultPlanProfile::processMotionValidator(
     OMPLProblem& prob,
     const ompl::base::StateValidityCheckerPtr& svc_without_collision) const
 {
+  ompl::base::MotionValidatorPtr mv;
   if (mv_allocator != nullptr)
   {
-    auto mv = mv_allocator(prob.simple_setup->getSpaceInformation(), prob);
-    prob.simple_setup->getSpaceInformation()->setMotionValidator(mv);
+    mv = mv_allocator(prob.simple_setup->getSpaceInformation(), prob);
   }
   else
   {
     if (collision_check_config.type != tesseract_collision::CollisionEvaluatorType::NONE)
     {
-      ompl::base::MotionValidatorPtr mv;
       if (collision_check_config.type == tesseract_collision::CollisionEvaluatorType::CONTINUOUS ||
           collision_check_config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
       {
@@ -737,31 +854,56 @@ void OMPLDefaultPlanProfile::processMotionValidator(
                                                          *prob.env,
                                                          prob.manip,
                                                          collision_check_config,
-                                                         prob.extractor);
+                                                         prob.extractor,
+                                                         fwd_kin_cache_size);
       }
       else
       {
         // Collision checking is preformed using the state validator which this calls.
-        mv = std::make_shared<DiscreteMotionValidator>(prob.simple_setup->getSpaceInformation());
+        mv = std::make_shared<DiscreteMotionValidator>(prob.simple_setup->getSpaceInformation(),
+                                                       motion_validation_order);
       }
-      prob.simple_setup->getSpaceInformation()->setMotionValidator(mv);
     }
   }
+
+  if (mv == nullptr)
+    return;
+
+  // The planner enables lazy checking while searching and validates the solution with the wrapped motion validator.
+  // With continuous collision checking the state validator does not check collision so the lazy search would accept
+  // every motion which satisfies the other constraints.
+  const bool continuous = (collision_check_config.type == tesseract_collision::CollisionEvaluatorType::CONTINUOUS ||
+                           collision_check_config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS);
+  if (lazy_collision_check && continuous)
+  {
+    CONSOLE_BRIDGE_logWarn("OMPLDefaultPlanProfile: Lazy collision checking is not supported with continuous collision "
+                           "checking, it is disabled");
+  }
+  else if (lazy_collision_check)
+  {
+    mv = std::make_shared<LazyMotionValidator>(prob.simple_setup->getSpaceInformation(), mv, lazy_check_stride);
+  }
+
+  prob.simple_setup->getSpaceInformation()->setMotionValidator(mv);
 }
 
 void OMPLDefaultPlanProfile::processOptimizationObjective(OMPLProblem& prob) const
 {
   if (optimization_objective_allocator)
   {
-    prob.simple_setup->getProblemDefinition()->setOptimizationObjective(
-        optimization_objective_allocator(prob.simple_setup->getSpaceInformation(), prob));
+    prob.optimization_objective_allocator = optimization_objective_allocator;
   }
   else if (prob.optimize)
   {
     // Add default optimization function to minimize path length
-    prob.simple_setup->getProblemDefinition()->setOptimizationObjective(
-        std::make_shared<ompl::base::PathLengthOptimizationObjective>(prob.simple_setup->getSpaceInformation()));
+    prob.optimization_objective_allocator = [](const ompl::base::SpaceInformationPtr& si, const OMPLProblem&) {
+      return std::make_shared<ompl::base::PathLengthOptimizationObjective>(si);
+    };
   }
+
+  if (prob.optimization_objective_allocator)
+    prob.simple_setup->getProblemDefinition()->setOptimizationObjective(
+        prob.optimization_objective_allocator(prob.simple_setup->getSpaceInformation(), prob));
 }
 
 }  // namespace tesseract_planning
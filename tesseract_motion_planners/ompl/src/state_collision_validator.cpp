@@ -39,11 +39,13 @@ StateCollisionValidator::StateCollisionValidator(
     const tesseract_environment::Environment& env,
     tesseract_kinematics::JointGroup::ConstPtr manip,
     const tesseract_collision::CollisionCheckConfig& collision_check_config,
-    OMPLStateExtractor extractor)
+    OMPLStateExtractor extractor,
+    std::size_t fwd_kin_cache_size)
   : StateValidityChecker(space_info)
   , manip_(std::move(manip))
   , contact_manager_(env.getDiscreteContactManager())
   , extractor_(std::move(extractor))
+  , fwd_kin_cache_size_(fwd_kin_cache_size)
 {
   links_ = manip_->getActiveLinkNames();
 
@@ -56,24 +58,27 @@ bool StateCollisionValidator::isValid(const ompl::base::State* state) const
   // It was time using chronos time elapsed and it was faster to cache the contact manager
   unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
   tesseract_collision::DiscreteContactManager::Ptr cm;
+  FwdKinCache* fwd_kin_cache{ nullptr };
   mutex_.lock();
   auto it = contact_managers_.find(hash);
   if (it == contact_managers_.end())
   {
     cm = contact_manager_->clone();
     contact_managers_[hash] = cm;
+    fwd_kin_cache = &fwd_kin_caches_.emplace(hash, FwdKinCache(fwd_kin_cache_size_)).first->second;
   }
   else
   {
     cm = it->second;
+    fwd_kin_cache = &fwd_kin_caches_.at(hash);
   }
   mutex_.unlock();
 
   Eigen::Map<Eigen::VectorXd> finish_joints = extractor_(state);
-  tesseract_common::TransformMap state1 = manip_->calcFwdKin(finish_joints);
+  const tesseract_common::TransformMap& state1 = fwd_kin_cache->calcFwdKin(*manip_, finish_joints);
 
   for (const auto& link_name : links_)
-    cm->setCollisionObjectsTransform(link_name, state1[link_name]);
+    cm->setCollisionObjectsTransform(link_name, state1.at(link_name));
 
   tesseract_collision::ContactResultMap contact_map;
   cm->contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
@@ -0,0 +1,262 @@
+/**
+ * @file interpolation_benchmark.cpp
+ * @brief Benchmark the interpolation, appending interpolated instructions and seeding cartesian waypoints
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_command_language/cartesian_waypoint.h>
+#include <tesseract_motion_planners/core/interpolation.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+
+/** @brief The number of segments interpolated per iteration, similar to a raster program */
+const long NUM_SEGMENTS = 100;
+
+/** @brief Interpolate each segment into a newly allocated matrix */
+static void BM_InterpolateJoint(benchmark::State& state)
+{
+  const long steps = state.range(0);
+  const Eigen::VectorXd start = Eigen::VectorXd::Zero(6);
+  const Eigen::VectorXd stop = Eigen::VectorXd::Ones(6);
+
+  for (auto _ : state)
+  {
+    for (long i = 0; i < NUM_SEGMENTS; ++i)
+    {
+      Eigen::MatrixXd states = interpolate(start, stop, steps);
+      benchmark::DoNotOptimize(states.data());
+    }
+  }
+}
+
+BENCHMARK(BM_InterpolateJoint)->Arg(10)->Arg(100)->Arg(1000);
+
+/** @brief Interpolate each segment into a block of a single preallocated matrix */
+static void BM_InterpolateJointBuffer(benchmark::State& state)
+{
+  const long steps = state.range(0);
+  const Eigen::VectorXd start = Eigen::VectorXd::Zero(6);
+  const Eigen::VectorXd stop = Eigen::VectorXd::Ones(6);
+  Eigen::MatrixXd states(6, NUM_SEGMENTS * (steps + 1));
+
+  for (auto _ : state)
+  {
+    for (long i = 0; i < NUM_SEGMENTS; ++i)
+      interpolate(start, stop, steps, states.middleCols(i * (steps + 1), steps + 1));
+
+    benchmark::DoNotOptimize(states.data());
+  }
+}
+
+BENCHMARK(BM_InterpolateJointBuffer)->Arg(10)->Arg(100)->Arg(1000);
+
+/** @brief Interpolate each segment into a newly allocated vector */
+static void BM_InterpolateCartesian(benchmark::State& state)
+{
+  const long steps = state.range(0);
+  const Eigen::Isometry3d start = Eigen::Isometry3d::Identity();
+  const Eigen::Isometry3d stop =
+      Eigen::Translation3d(1, 0.5, 0.2) * Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ());
+
+  for (auto _ : state)
+  {
+    for (long i = 0; i < NUM_SEGMENTS; ++i)
+    {
+      tesseract_common::VectorIsometry3d poses = interpolate(start, stop, steps);
+      benchmark::DoNotOptimize(poses.data());
+    }
+  }
+}
+
+BENCHMARK(BM_InterpolateCartesian)->Arg(10)->Arg(100)->Arg(1000);
+
+/** @brief Interpolate each segment into a reused vector */
+static void BM_InterpolateCartesianBuffer(benchmark::State& state)
+{
+  const long steps = state.range(0);
+  const Eigen::Isometry3d start = Eigen::Isometry3d::Identity();
+  const Eigen::Isometry3d stop =
+      Eigen::Translation3d(1, 0.5, 0.2) * Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ());
+  tesseract_common::VectorIsometry3d poses;
+
+  for (auto _ : state)
+  {
+    for (long i = 0; i < NUM_SEGMENTS; ++i)
+    {
+      interpolate(start, stop, steps, poses);
+      benchmark::DoNotOptimize(poses.data());
+    }
+  }
+}
+
+BENCHMARK(BM_InterpolateCartesianBuffer)->Arg(10)->Arg(100)->Arg(1000);
+
+/** @brief Create the interpolated instructions of a single segment */
+std::vector<MoveInstructionPoly> createSegment(long steps)
+{
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  JointWaypointPoly wp{ JointWaypoint(joint_names, Eigen::VectorXd::Ones(6)) };
+  MoveInstructionPoly base_instruction{ MoveInstruction(wp, MoveInstructionType::FREESPACE, "DEFAULT") };
+  const Eigen::MatrixXd states = interpolate(Eigen::VectorXd::Zero(6), Eigen::VectorXd::Ones(6), steps);
+  return getInterpolatedInstructions(joint_names, states, base_instruction);
+}
+
+/** @brief Create the interpolated instructions of each segment */
+static void BM_GetInterpolatedInstructions(benchmark::State& state)
+{
+  const long steps = state.range(0);
+  for (auto _ : state)
+  {
+    for (long i = 0; i < NUM_SEGMENTS; ++i)
+    {
+      std::vector<MoveInstructionPoly> segment = createSegment(steps);
+      benchmark::DoNotOptimize(segment.data());
+    }
+  }
+}
+
+BENCHMARK(BM_GetInterpolatedInstructions)->Arg(10)->Arg(100);
+
+/** @brief Append the interpolated instructions of each segment one at a time */
+static void BM_AppendMoveInstruction(benchmark::State& state)
+{
+  const long steps = state.range(0);
+  const std::vector<MoveInstructionPoly> segment = createSegment(steps);
+  for (auto _ : state)
+  {
+    CompositeInstruction program;
+    for (long i = 0; i < NUM_SEGMENTS; ++i)
+    {
+      for (const auto& instruction : segment)
+        program.push_back(instruction);
+    }
+    benchmark::DoNotOptimize(program.size());
+  }
+}
+
+BENCHMARK(BM_AppendMoveInstruction)->Arg(10)->Arg(100);
+
+/** @brief Append the interpolated instructions of each segment in bulk */
+static void BM_AppendMoveInstructions(benchmark::State& state)
+{
+  const long steps = state.range(0);
+  const std::vector<MoveInstructionPoly> segment = createSegment(steps);
+  for (auto _ : state)
+  {
+    CompositeInstruction program;
+    for (long i = 0; i < NUM_SEGMENTS; ++i)
+      program.appendMoveInstructions(segment);
+
+    benchmark::DoNotOptimize(program.size());
+  }
+}
+
+BENCHMARK(BM_AppendMoveInstructions)->Arg(10)->Arg(100);
+
+/** @brief Create an environment with a robot which has an analytical inverse kinematics solver */
+tesseract_environment::Environment::Ptr createEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<tesseract_environment::Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/abb_irb2400.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/abb_irb2400.srdf");
+  env->init(urdf_path, srdf_path, locator);
+  return env;
+}
+
+/** @brief Create the cartesian poses of a raster relative to the base link */
+tesseract_common::VectorIsometry3d createRasterPoses(long num_poses)
+{
+  Eigen::Isometry3d start = Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, -0.3, 0.8) *
+                            Eigen::Quaterniond(0, 0, -1.0, 0);
+  Eigen::Isometry3d stop = Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, 0.3, 0.8) *
+                           Eigen::Quaterniond(0, 0, -1.0, 0);
+  return interpolate(start, stop, num_poses - 1);
+}
+
+/** @brief Seed each cartesian waypoint of a raster individually, creating the instruction info per waypoint */
+static void BM_GetClosestJointSolution(benchmark::State& state)
+{
+  auto env = createEnvironment();
+  const tesseract_common::VectorIsometry3d poses = createRasterPoses(state.range(0));
+
+  tesseract_common::ManipulatorInfo manip_info("manipulator", "base_link", "tool0");
+  manip_info.manipulator_ik_solver = "OPWInvKin";
+
+  PlannerRequest request;
+  request.env = env;
+  request.env_state = env->getState();
+
+  std::vector<MoveInstructionPoly> instructions;
+  instructions.reserve(poses.size());
+  for (const auto& pose : poses)
+  {
+    CartesianWaypointPoly wp{ CartesianWaypoint(pose) };
+    instructions.emplace_back(MoveInstruction(wp, MoveInstructionType::LINEAR, "DEFAULT", manip_info));
+  }
+
+  const Eigen::VectorXd initial_seed = Eigen::VectorXd::Zero(6);
+  for (auto _ : state)
+  {
+    Eigen::VectorXd seed = initial_seed;
+    for (const auto& instruction : instructions)
+    {
+      KinematicGroupInstructionInfo info(instruction, request, manip_info);
+      Eigen::VectorXd solution = getClosestJointSolution(info, seed);
+      if (solution.size() != 0)
+        seed = solution;
+    }
+    benchmark::DoNotOptimize(seed.data());
+  }
+}
+
+BENCHMARK(BM_GetClosestJointSolution)->Arg(100)->Arg(1000);
+
+/** @brief Seed all cartesian waypoints of a raster in a single batch */
+static void BM_GetClosestJointSolutions(benchmark::State& state)
+{
+  auto env = createEnvironment();
+  const tesseract_common::VectorIsometry3d poses = createRasterPoses(state.range(0));
+  tesseract_kinematics::KinematicGroup::UPtr manip = env->getKinematicGroup("manipulator", "OPWInvKin");
+
+  const Eigen::VectorXd initial_seed = Eigen::VectorXd::Zero(6);
+  for (auto _ : state)
+  {
+    std::vector<Eigen::VectorXd> solutions =
+        getClosestJointSolutions(*manip, poses, "base_link", "tool0", initial_seed);
+    benchmark::DoNotOptimize(solutions.data());
+  }
+}
+
+BENCHMARK(BM_GetClosestJointSolutions)->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
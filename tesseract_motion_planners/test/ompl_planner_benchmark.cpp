@@ -0,0 +1,220 @@
+/**
+ * @file ompl_planner_benchmark.cpp
+ * @brief Benchmark the OMPL motion planner on the freespace example scene
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <array>
+#include <atomic>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands/add_link_command.h>
+#include <tesseract_geometry/impl/sphere.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
+#include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/ompl_experience_cache.h>
+#include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
+#include <tesseract_motion_planners/interface_utils.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+
+static const std::string OMPL_DEFAULT_NAMESPACE = "OMPLMotionPlannerTask";
+
+/** @brief Create the environment of the freespace OMPL example, a sphere in front of the robot */
+Environment::Ptr createEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  env->init(urdf_path, srdf_path, locator);
+
+  tesseract_scene_graph::Link link_sphere("sphere_attached");
+  auto visual = std::make_shared<tesseract_scene_graph::Visual>();
+  visual->origin = Eigen::Isometry3d::Identity();
+  visual->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  visual->geometry = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  link_sphere.visual.push_back(visual);
+
+  auto collision = std::make_shared<tesseract_scene_graph::Collision>();
+  collision->origin = visual->origin;
+  collision->geometry = visual->geometry;
+  link_sphere.collision.push_back(collision);
+
+  tesseract_scene_graph::Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = tesseract_scene_graph::JointType::FIXED;
+
+  env->applyCommand(std::make_shared<AddLinkCommand>(link_sphere, joint_sphere));
+  return env;
+}
+
+/** @brief Create the request of the freespace OMPL example, moving from one side of the sphere to the other */
+PlannerRequest createRequest(const Environment::Ptr& env, const ProfileDictionary::Ptr& profiles, bool reverse)
+{
+  tesseract_common::ManipulatorInfo manip;
+  manip.tcp_frame = "tool0";
+  manip.working_frame = "base_link";
+  manip.manipulator = "manipulator";
+
+  std::vector<std::string> joint_names = env->getJointGroup(manip.manipulator)->getJointNames();
+  JointWaypointPoly start{ JointWaypoint(joint_names, Eigen::VectorXd::Zero(7)) };
+  start.getPosition() << -0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  JointWaypointPoly goal{ JointWaypoint(joint_names, Eigen::VectorXd::Zero(7)) };
+  goal.getPosition() << 0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  if (reverse)
+    std::swap(start, goal);
+
+  CompositeInstruction program("TEST_PROFILE");
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(start, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(goal, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  PlannerRequest request;
+  request.instructions = generateInterpolatedProgram(program, env->getState(), env, 3.14, 1.0, 3.14, 10);
+  request.env = env;
+  request.env_state = env->getState();
+  request.profiles = profiles;
+  return request;
+}
+
+/**
+ * @brief Solve alternating queries in the same environment with a multi-query planner
+ * @details If the first argument is non zero the planners are kept between requests using an experience cache
+ */
+static void BM_OMPLRepeatedQueries(benchmark::State& state)
+{
+  Environment::Ptr env = createEnvironment();
+
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->planning_time = 10;
+  plan_profile->optimize = false;
+  plan_profile->max_solutions = 1;
+  plan_profile->planners = { std::make_shared<PRMConfigurator>() };
+  if (state.range(0) != 0)
+    plan_profile->experience_cache = std::make_shared<OMPLExperienceCache>();
+
+  state.SetLabel((state.range(0) != 0) ? "experience" : "no_experience");
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  const std::array<PlannerRequest, 2> requests{ createRequest(env, profiles, false),
+                                                createRequest(env, profiles, true) };
+
+  OMPLMotionPlanner planner(OMPL_DEFAULT_NAMESPACE);
+  std::size_t queries{ 0 };
+  std::size_t failures{ 0 };
+  for (auto _ : state)
+  {
+    PlannerResponse response = planner.solve(requests[queries++ % requests.size()]);
+    if (!response.successful)
+      ++failures;
+
+    benchmark::DoNotOptimize(response);
+  }
+
+  state.counters["failures"] = static_cast<double>(failures);
+}
+
+BENCHMARK(BM_OMPLRepeatedQueries)->Arg(0)->Arg(1)->Iterations(50)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/** @brief State validity checker which accepts every state and counts the number of checks */
+class CountingStateValidator : public ompl::base::StateValidityChecker
+{
+public:
+  CountingStateValidator(const ompl::base::SpaceInformationPtr& si, std::shared_ptr<std::atomic<std::size_t>> count)
+    : ompl::base::StateValidityChecker(si), count_(std::move(count))
+  {
+  }
+
+  bool isValid(const ompl::base::State* /*state*/) const override
+  {
+    ++(*count_);
+    return true;
+  }
+
+private:
+  std::shared_ptr<std::atomic<std::size_t>> count_;
+};
+
+/**
+ * @brief Solve the freespace example with the planners of the example counting the state validity checks
+ * @details The first argument is the motion validation order and the second argument the forward kinematics cache size
+ */
+static void BM_OMPLFreespaceChecks(benchmark::State& state)
+{
+  Environment::Ptr env = createEnvironment();
+
+  const auto order = static_cast<OMPLMotionValidationOrder>(state.range(0));
+  auto count = std::make_shared<std::atomic<std::size_t>>(0);
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_check_config.type = tesseract_collision::CollisionEvaluatorType::DISCRETE;
+  plan_profile->motion_validation_order = order;
+  plan_profile->fwd_kin_cache_size = static_cast<std::size_t>(state.range(1));
+  plan_profile->planning_time = 10;
+  plan_profile->planners = { std::make_shared<RRTConnectConfigurator>(), std::make_shared<RRTConnectConfigurator>() };
+  plan_profile->svc_allocator = [count](const ompl::base::SpaceInformationPtr& si, const OMPLProblem& /*prob*/) {
+    return std::make_shared<CountingStateValidator>(si, count);
+  };
+
+  state.SetLabel((order == OMPLMotionValidationOrder::BISECTION) ? "bisection" : "linear");
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+  const PlannerRequest request = createRequest(env, profiles, false);
+
+  OMPLMotionPlanner planner(OMPL_DEFAULT_NAMESPACE);
+  std::size_t failures{ 0 };
+  for (auto _ : state)
+  {
+    PlannerResponse response = planner.solve(request);
+    if (!response.successful)
+      ++failures;
+
+    benchmark::DoNotOptimize(response);
+  }
+
+  state.counters["checks_per_solve"] =
+      benchmark::Counter(static_cast<double>(count->load()), benchmark::Counter::kAvgIterations);
+  state.counters["failures"] = static_cast<double>(failures);
+}
+
+BENCHMARK(BM_OMPLFreespaceChecks)
+    ->ArgsProduct({ { static_cast<std::int64_t>(OMPLMotionValidationOrder::LINEAR),
+                      static_cast<std::int64_t>(OMPLMotionValidationOrder::BISECTION) },
+                    { 0, 8 } })
+    ->Iterations(50)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
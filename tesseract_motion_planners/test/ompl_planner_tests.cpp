@@ -38,9 +38,13 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/geometric/planners/prm/PRM.h>
 #include <ompl/geometric/planners/prm/PRMstar.h>
 #include <ompl/geometric/planners/prm/LazyPRMstar.h>
+#include <ompl/geometric/planners/prm/LazyPRM.h>
+#include <ompl/geometric/planners/rrt/LazyRRT.h>
 #include <ompl/geometric/planners/prm/SPARS.h>
 
 #include <ompl/util/RandomNumbers.h>
+#include <ompl/base/spaces/RealVectorStateSpace.h>
+#include <ompl/base/SpaceInformation.h>
 
 #include <functional>
 #include <cmath>
@@ -48,12 +52,17 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
+#include <tesseract_common/utils.h>
 
 #include <tesseract_environment/environment.h>
 #include <tesseract_environment/utils.h>
 #include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
+#include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
+#include <tesseract_motion_planners/ompl/lazy_motion_validator.h>
+#include <tesseract_motion_planners/ompl/fwd_kin_cache.h>
+#include <tesseract_motion_planners/ompl/ompl_experience_cache.h>
 
 #include <tesseract_motion_planners/core/types.h>
 #include <tesseract_motion_planners/core/utils.h>
@@ -116,6 +125,8 @@ using Implementations = ::testing::Types<tesseract_planning::SBLConfigurator,
                                          tesseract_planning::PRMConfigurator,
                                          tesseract_planning::PRMstarConfigurator,
                                          tesseract_planning::LazyPRMstarConfigurator,
+                                         tesseract_planning::LazyPRMConfigurator,
+                                         tesseract_planning::LazyRRTConfigurator,
                                          tesseract_planning::ESTConfigurator,
                                          tesseract_planning::BKPIECE1Configurator,
                                          tesseract_planning::KPIECE1Configurator,
@@ -478,6 +489,396 @@ TYPED_TEST(OMPLTestFixture, OMPLFreespaceCartesianStartPlannerUnit)  // NOLINT
   EXPECT_TRUE(wp1.getTransform().isApprox(check_start, 1e-3));
 }
 
+TEST(OMPLExperienceCache, PRMExperienceReuseUnit)  // NOLINT
+{
+  // Step 1: Load scene and srdf
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  Environment::Ptr env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+
+  tesseract_common::ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+  manip.working_frame = "base_link";
+  manip.tcp_frame = "tool0";
+
+  // Step 2: Add box to environment
+  addBox(*env);
+
+  auto joint_group = env->getJointGroup(manip.manipulator);
+  auto cur_state = env->getState();
+
+  JointWaypointPoly wp1{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size()))) };
+  JointWaypointPoly wp2{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size()))) };
+
+  MoveInstruction start_instruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+  MoveInstruction plan_f1(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+
+  CompositeInstruction program;
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(start_instruction);
+  program.appendMoveInstruction(plan_f1);
+
+  CompositeInstruction interpolated_program = generateInterpolatedProgram(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+
+  // Create Profiles
+  tesseract_common::fs::path cache_dir(tesseract_common::getTempPath());
+  auto experience_cache = std::make_shared<OMPLExperienceCache>(cache_dir);
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_check_config.contact_manager_config.margin_data_override_type =
+      tesseract_collision::CollisionMarginOverrideType::OVERRIDE_DEFAULT_MARGIN;
+  plan_profile->collision_check_config.contact_manager_config.margin_data.setDefaultCollisionMargin(0.025);
+  plan_profile->collision_check_config.longest_valid_segment_length = 0.1;
+  plan_profile->collision_check_config.type = tesseract_collision::CollisionEvaluatorType::DISCRETE;
+  plan_profile->planning_time = 10;
+  plan_profile->optimize = false;
+  plan_profile->max_solutions = 2;
+  plan_profile->planners = { std::make_shared<PRMConfigurator>() };
+  plan_profile->experience_cache = experience_cache;
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  PlannerRequest request;
+  request.instructions = interpolated_program;
+  request.env = env;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  OMPLMotionPlanner ompl_planner(OMPL_DEFAULT_NAMESPACE);
+  PlannerResponse planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(&planner_response);
+  EXPECT_EQ(experience_cache->size(), 1);
+
+  // The roadmap is kept between requests
+  const std::string key =
+      OMPLExperienceCache::createKey(env->getName(), manip.manipulator, plan_profile->getExperienceConfig());
+  std::unordered_map<std::string, double> static_joint_values = cur_state.joints;
+  for (const auto& joint_name : joint_group->getJointNames())
+    static_joint_values.erase(joint_name);
+
+  OMPLExperience::Ptr experience = experience_cache->checkout(key, env->getRevision(), static_joint_values);
+  ASSERT_TRUE(experience != nullptr);
+  EXPECT_EQ(experience_cache->size(), 0);
+  ompl::base::PlannerData data(experience->simple_setup->getSpaceInformation());
+  experience->planners.front()->getPlannerData(data);
+  const unsigned num_vertices = data.numVertices();
+  EXPECT_GT(num_vertices, 0);
+  experience_cache->checkin(key, experience);
+  EXPECT_EQ(experience_cache->size(), 1);
+
+  // A profile configured differently does not reuse the experience
+  auto other_plan_profile = std::make_shared<OMPLDefaultPlanProfile>(*plan_profile);
+  other_plan_profile->collision_check_config.contact_manager_config.margin_data.setDefaultCollisionMargin(0.05);
+  const std::string other_key =
+      OMPLExperienceCache::createKey(env->getName(), manip.manipulator, other_plan_profile->getExperienceConfig());
+  EXPECT_NE(other_key, key);
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", other_plan_profile);
+  planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(&planner_response);
+  EXPECT_EQ(experience_cache->size(), 2);
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  // Solve the reverse query reusing the roadmap
+  program = CompositeInstruction();
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  request.instructions = generateInterpolatedProgram(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+  planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(&planner_response);
+  EXPECT_TRUE(wp1.getPosition().isApprox(
+      getJointPosition(planner_response.results.getLastMoveInstruction()->getWaypoint()), 1e-5));
+
+  experience = experience_cache->checkout(key, env->getRevision(), static_joint_values);
+  ASSERT_TRUE(experience != nullptr);
+  ompl::base::PlannerData data2(experience->simple_setup->getSpaceInformation());
+  experience->planners.front()->getPlannerData(data2);
+  EXPECT_GE(data2.numVertices(), num_vertices);
+  experience_cache->checkin(key, experience);
+
+  // Save and load the roadmap
+  EXPECT_TRUE(experience_cache->save());
+  ompl::base::PlannerPtr loaded_planner = experience_cache->loadPlanner(
+      key, env->getRevision(), 0, *plan_profile->planners.front(), experience->simple_setup->getSpaceInformation());
+  ASSERT_TRUE(loaded_planner != nullptr);
+  ompl::base::PlannerData data3(experience->simple_setup->getSpaceInformation());
+  loaded_planner->getPlannerData(data3);
+  EXPECT_EQ(data3.numVertices(), data2.numVertices());
+  EXPECT_TRUE(experience_cache->loadPlanner(key,
+                                            env->getRevision(),
+                                            0,
+                                            RRTConnectConfigurator(),
+                                            experience->simple_setup->getSpaceInformation()) == nullptr);
+
+  // The experience is invalidated when the environment changes
+  const int revision = env->getRevision();
+  env->applyCommand(std::make_shared<RemoveLinkCommand>("box_attached"));
+  EXPECT_NE(env->getRevision(), revision);
+  EXPECT_TRUE(experience_cache->checkout(key, env->getRevision(), static_joint_values) == nullptr);
+  EXPECT_EQ(experience_cache->size(), 1);
+
+  experience_cache->clear();
+  EXPECT_EQ(experience_cache->size(), 0);
+}
+
+TEST(OMPLLazyMotionValidator, LazyPRMPlannerUnit)  // NOLINT
+{
+  // Step 1: Load scene and srdf
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  Environment::Ptr env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+
+  tesseract_common::ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+  manip.working_frame = "base_link";
+  manip.tcp_frame = "tool0";
+
+  // Step 2: Add box to environment
+  addBox(*env);
+
+  auto joint_group = env->getJointGroup(manip.manipulator);
+  auto cur_state = env->getState();
+
+  JointWaypointPoly wp1{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size()))) };
+  JointWaypointPoly wp2{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size()))) };
+
+  CompositeInstruction program;
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  // Create Profiles, the experience cache provides access to the planners after solving
+  auto experience_cache = std::make_shared<OMPLExperienceCache>();
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_check_config.contact_manager_config.margin_data_override_type =
+      tesseract_collision::CollisionMarginOverrideType::OVERRIDE_DEFAULT_MARGIN;
+  plan_profile->collision_check_config.contact_manager_config.margin_data.setDefaultCollisionMargin(0.025);
+  plan_profile->collision_check_config.longest_valid_segment_length = 0.1;
+  plan_profile->collision_check_config.type = tesseract_collision::CollisionEvaluatorType::DISCRETE;
+  plan_profile->planning_time = 10;
+  plan_profile->optimize = false;
+  plan_profile->max_solutions = 2;
+  plan_profile->planners = { std::make_shared<PRMConfigurator>() };
+  plan_profile->lazy_collision_check = true;
+  plan_profile->experience_cache = experience_cache;
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  PlannerRequest request;
+  request.instructions = generateInterpolatedProgram(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+  request.env = env;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  std::unordered_map<std::string, double> static_joint_values = cur_state.joints;
+  for (const auto& joint_name : joint_group->getJointNames())
+    static_joint_values.erase(joint_name);
+
+  // Only the end state of each motion is checked while searching, the solution is fully checked
+  OMPLMotionPlanner ompl_planner(OMPL_DEFAULT_NAMESPACE);
+  PlannerResponse planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(&planner_response);
+  EXPECT_TRUE(wp2.getPosition().isApprox(
+      getJointPosition(planner_response.results.getLastMoveInstruction()->getWaypoint()), 1e-5));
+
+  std::string key =
+      OMPLExperienceCache::createKey(env->getName(), manip.manipulator, plan_profile->getExperienceConfig());
+  OMPLExperience::Ptr experience = experience_cache->checkout(key, env->getRevision(), static_joint_values);
+  ASSERT_TRUE(experience != nullptr);
+  const ompl::base::SpaceInformationPtr& si = experience->simple_setup->getSpaceInformation();
+  auto* lazy_mv = dynamic_cast<LazyMotionValidator*>(si->getMotionValidator().get());
+  ASSERT_TRUE(lazy_mv != nullptr);
+  EXPECT_FALSE(lazy_mv->isLazy());
+  EXPECT_TRUE(experience->simple_setup->getSolutionPath().check());
+
+  // Invalid motions are removed from the roadmap instead of clearing it
+  ompl::base::PlannerData data(si);
+  experience->planners.front()->getPlannerData(data);
+  EXPECT_GT(data.numVertices(), 0);
+
+  // Lazy checking is disabled with continuous collision checking since states are not checked for collision
+  auto continuous_plan_profile = std::make_shared<OMPLDefaultPlanProfile>(*plan_profile);
+  continuous_plan_profile->collision_check_config.type = tesseract_collision::CollisionEvaluatorType::CONTINUOUS;
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", continuous_plan_profile);
+  planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(&planner_response);
+
+  key = OMPLExperienceCache::createKey(
+      env->getName(), manip.manipulator, continuous_plan_profile->getExperienceConfig());
+  experience = experience_cache->checkout(key, env->getRevision(), static_joint_values);
+  ASSERT_TRUE(experience != nullptr);
+  EXPECT_TRUE(dynamic_cast<LazyMotionValidator*>(
+                  experience->simple_setup->getSpaceInformation()->getMotionValidator().get()) == nullptr);
+}
+
+/** @brief State validity checker which counts the number of checks and is invalid for x within [0.45, 0.55] */
+class CountingStateValidator : public ompl::base::StateValidityChecker
+{
+public:
+  using ompl::base::StateValidityChecker::StateValidityChecker;
+
+  bool isValid(const ompl::base::State* state) const override
+  {
+    ++count;
+    double x = state->as<ompl::base::RealVectorStateSpace::StateType>()->values[0];
+    return (x < 0.45 || x > 0.55);
+  }
+
+  mutable int count{ 0 };
+};
+
+TEST(OMPLDiscreteMotionValidator, ValidationOrderUnit)  // NOLINT
+{
+  auto state_space = std::make_shared<ompl::base::RealVectorStateSpace>(1);
+  state_space->setBounds(0, 1);
+  state_space->setLongestValidSegmentFraction(0.01);
+
+  auto si = std::make_shared<ompl::base::SpaceInformation>(state_space);
+  auto svc = std::make_shared<CountingStateValidator>(si);
+  si->setStateValidityChecker(svc);
+  si->setup();
+
+  ompl::base::ScopedState<> s1(state_space);
+  ompl::base::ScopedState<> s2(state_space);
+  ompl::base::ScopedState<> s3(state_space);
+  s1[0] = 0.0;
+  s2[0] = 1.0;
+  s3[0] = 0.4;
+
+  DiscreteMotionValidator linear(si, OMPLMotionValidationOrder::LINEAR);
+  DiscreteMotionValidator bisection(si, OMPLMotionValidationOrder::BISECTION);
+  EXPECT_EQ(linear.getValidationOrder(), OMPLMotionValidationOrder::LINEAR);
+  EXPECT_EQ(bisection.getValidationOrder(), OMPLMotionValidationOrder::BISECTION);
+
+  // Invalid motion colliding in the middle
+  svc->count = 0;
+  EXPECT_FALSE(linear.checkMotion(s1.get(), s2.get()));
+  int linear_count = svc->count;
+
+  svc->count = 0;
+  EXPECT_FALSE(bisection.checkMotion(s1.get(), s2.get()));
+  int bisection_count = svc->count;
+  EXPECT_LT(bisection_count, linear_count);
+  EXPECT_EQ(bisection_count, 2);
+
+  // Valid motions check every interpolated state in both orders
+  svc->count = 0;
+  EXPECT_TRUE(linear.checkMotion(s1.get(), s3.get()));
+  linear_count = svc->count;
+
+  svc->count = 0;
+  EXPECT_TRUE(bisection.checkMotion(s1.get(), s3.get()));
+  bisection_count = svc->count;
+  EXPECT_EQ(bisection_count, linear_count);
+
+  // The last valid state is always found using linear order
+  std::pair<ompl::base::State*, double> last_valid = { nullptr, 0.0 };
+  EXPECT_FALSE(bisection.checkMotion(s1.get(), s2.get(), last_valid));
+  EXPECT_NEAR(last_valid.second, 0.44, 1e-6);
+}
+
+TEST(OMPLLazyMotionValidator, LazyMotionValidatorUnit)  // NOLINT
+{
+  auto state_space = std::make_shared<ompl::base::RealVectorStateSpace>(1);
+  state_space->setBounds(0, 1);
+  state_space->setLongestValidSegmentFraction(0.01);
+
+  auto si = std::make_shared<ompl::base::SpaceInformation>(state_space);
+  auto svc = std::make_shared<CountingStateValidator>(si);
+  si->setStateValidityChecker(svc);
+  si->setup();
+
+  ompl::base::ScopedState<> s1(state_space);
+  ompl::base::ScopedState<> s2(state_space);
+  s1[0] = 0.0;
+  s2[0] = 1.0;
+
+  auto mv = std::make_shared<DiscreteMotionValidator>(si);
+  LazyMotionValidator end_state_only(si, mv);
+  LazyMotionValidator strided(si, mv, 10);
+  EXPECT_FALSE(end_state_only.isLazy());
+  EXPECT_EQ(strided.getCheckStride(), 10);
+  EXPECT_EQ(strided.getMotionValidator(), mv);
+  EXPECT_ANY_THROW(LazyMotionValidator(si, nullptr));  // NOLINT
+  EXPECT_ANY_THROW(LazyMotionValidator(si, mv, -1));   // NOLINT
+
+  // When not lazy the wrapped motion validator is used
+  EXPECT_FALSE(end_state_only.checkMotion(s1.get(), s2.get()));
+
+  // Only the end state is checked so the collision in the middle is missed
+  end_state_only.setLazy(true);
+  EXPECT_TRUE(end_state_only.isLazy());
+  svc->count = 0;
+  EXPECT_TRUE(end_state_only.checkMotion(s1.get(), s2.get()));
+  EXPECT_EQ(svc->count, 1);
+
+  // Checking every 10th state finds the collision at 0.5
+  strided.setLazy(true);
+  svc->count = 0;
+  EXPECT_FALSE(strided.checkMotion(s1.get(), s2.get()));
+  EXPECT_EQ(svc->count, 5);
+
+  std::pair<ompl::base::State*, double> last_valid = { nullptr, 0.0 };
+  EXPECT_FALSE(strided.checkMotion(s1.get(), s2.get(), last_valid));
+  EXPECT_NEAR(last_valid.second, 0.4, 1e-6);
+
+  end_state_only.setLazy(false);
+  EXPECT_FALSE(end_state_only.checkMotion(s1.get(), s2.get()));
+}
+
+TEST(OMPLFwdKinCache, FwdKinCacheUnit)  // NOLINT
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  Environment::Ptr env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+
+  auto joint_group = env->getJointGroup("manipulator");
+  Eigen::VectorXd q1 = Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size()));
+  Eigen::VectorXd q2 = Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size()));
+  Eigen::VectorXd q3 = Eigen::VectorXd::Zero(static_cast<long>(start_state.size()));
+
+  FwdKinCache cache(2);
+  EXPECT_EQ(cache.capacity(), 2U);
+
+  tesseract_common::TransformMap expected = joint_group->calcFwdKin(q1);
+  EXPECT_TRUE(cache.calcFwdKin(*joint_group, q1).at("tool0").isApprox(expected.at("tool0")));
+  EXPECT_TRUE(cache.calcFwdKin(*joint_group, q1).at("tool0").isApprox(expected.at("tool0")));
+  EXPECT_EQ(cache.getHitCount(), 1);
+  EXPECT_EQ(cache.getMissCount(), 1);
+
+  cache.calcFwdKin(*joint_group, q2);
+  cache.calcFwdKin(*joint_group, q3);  // Replaces q1
+  expected = joint_group->calcFwdKin(q1);
+  EXPECT_TRUE(cache.calcFwdKin(*joint_group, q1).at("tool0").isApprox(expected.at("tool0")));
+  EXPECT_EQ(cache.getHitCount(), 1);
+  EXPECT_EQ(cache.getMissCount(), 4);
+
+  FwdKinCache disabled(0);
+  EXPECT_TRUE(disabled.calcFwdKin(*joint_group, q1).at("tool0").isApprox(expected.at("tool0")));
+  EXPECT_TRUE(disabled.calcFwdKin(*joint_group, q1).at("tool0").isApprox(expected.at("tool0")));
+  EXPECT_EQ(disabled.getHitCount(), 0);
+  EXPECT_EQ(disabled.getMissCount(), 2);
+
+  cache.clear();
+  EXPECT_EQ(cache.getHitCount(), 0);
+  EXPECT_EQ(cache.getMissCount(), 0);
+}
+
 // TEST(OMPLMultiPlanner, OMPLMultiPlannerUnit)  // NOLINT
 //{
 //  EXPECT_EQ(ompl::RNG::getSeed(), SEED) << "Randomization seed does not match expected: " << ompl::RNG::getSeed()
@@ -26,9 +26,16 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <map>
+#include <tuple>
+#include <typeindex>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_motion_planners/planner_utils.h>
 
 struct ProfileBase
 {
@@ -125,6 +132,135 @@ TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionaryTest)  // NOLINT
   EXPECT_EQ(profile_check4->a, 20);
 }
 
+TEST(TesseractPlanningProfileDictionaryUnit, FindProfileTest)  // NOLINT
+{
+  ProfileDictionary profiles;
+  EXPECT_TRUE(profiles.findProfile<ProfileBase>("ns", "key") == nullptr);
+
+  profiles.addProfile<ProfileBase>("ns", "key", std::make_shared<ProfileTest>(10));
+  auto profile = profiles.findProfile<ProfileBase>("ns", "key");
+  EXPECT_TRUE(profile != nullptr);
+  EXPECT_EQ(profile->a, 10);
+
+  EXPECT_TRUE(profiles.findProfile<ProfileBase>("ns", "DoesNotExist") == nullptr);
+  EXPECT_TRUE(profiles.findProfile<ProfileBase>("DoesNotExist", "key") == nullptr);
+  EXPECT_TRUE(profiles.findProfile<ProfileBase2>("ns", "key") == nullptr);
+}
+
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionarySnapshotTest)  // NOLINT
+{
+  ProfileDictionary profiles;
+  profiles.addProfile<ProfileBase>("ns", "key", std::make_shared<ProfileTest>(1));
+
+  ProfileDictionary::Snapshot::ConstPtr snapshot = profiles.getSnapshot();
+  EXPECT_TRUE(snapshot->hasProfileEntry<ProfileBase>("ns"));
+  EXPECT_TRUE(snapshot->hasProfile<ProfileBase>("ns", "key"));
+  EXPECT_EQ(snapshot->getProfile<ProfileBase>("ns", "key")->a, 1);
+  EXPECT_EQ(snapshot->getProfileEntry<ProfileBase>("ns").size(), 1U);
+  EXPECT_ANY_THROW(snapshot->getProfileEntry<ProfileBase2>("ns"));  // NOLINT
+
+  // Changes to the dictionary are not visible in a previously taken snapshot
+  profiles.addProfile<ProfileBase>("ns", "key", std::make_shared<ProfileTest>(2));
+  profiles.addProfile<ProfileBase>("ns", "key2", std::make_shared<ProfileTest>(3));
+  profiles.addProfile<ProfileBase2>("ns", "key", std::make_shared<ProfileTest2>(4));
+  EXPECT_EQ(snapshot->getProfile<ProfileBase>("ns", "key")->a, 1);
+  EXPECT_FALSE(snapshot->hasProfile<ProfileBase>("ns", "key2"));
+  EXPECT_FALSE(snapshot->hasProfileEntry<ProfileBase2>("ns"));
+  EXPECT_EQ(profiles.getProfile<ProfileBase>("ns", "key")->a, 2);
+
+  profiles.removeProfile<ProfileBase>("ns", "key");
+  profiles.removeProfileEntry<ProfileBase2>("ns");
+  EXPECT_TRUE(snapshot->hasProfile<ProfileBase>("ns", "key"));
+  EXPECT_FALSE(profiles.hasProfile<ProfileBase>("ns", "key"));
+  EXPECT_TRUE(profiles.hasProfile<ProfileBase>("ns", "key2"));
+  EXPECT_FALSE(profiles.hasProfileEntry<ProfileBase2>("ns"));
+}
+
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionaryForEachProfileTest)  // NOLINT
+{
+  auto profile = std::make_shared<ProfileTest>(1);
+  auto profile2 = std::make_shared<ProfileTest2>(2);
+  ProfileDictionary profiles;
+  profiles.addProfile<ProfileBase>("ns", "key", profile);
+  profiles.addProfile<ProfileBase>("ns2", "key", profile);
+  profiles.addProfile<ProfileBase2>("ns", "key", profile2);
+
+  std::map<std::tuple<std::string, std::type_index, std::string>, const void*> visited;
+  profiles.getSnapshot()->forEachProfile([&visited](const std::string& ns,
+                                                    const std::type_index& type,
+                                                    const std::string& profile_name,
+                                                    const std::shared_ptr<const void>& p) {
+    visited[std::make_tuple(ns, type, profile_name)] = p.get();
+  });
+  EXPECT_EQ(visited.size(), 3U);
+  EXPECT_EQ((visited[std::make_tuple("ns", std::type_index(typeid(ProfileBase)), "key")]),
+            static_cast<const ProfileBase*>(profile.get()));
+  EXPECT_EQ((visited[std::make_tuple("ns2", std::type_index(typeid(ProfileBase)), "key")]),
+            static_cast<const ProfileBase*>(profile.get()));
+  EXPECT_EQ((visited[std::make_tuple("ns", std::type_index(typeid(ProfileBase2)), "key")]),
+            static_cast<const ProfileBase2*>(profile2.get()));
+
+  // Removed profiles are not visited
+  profiles.removeProfile<ProfileBase>("ns", "key");
+  std::size_t count{ 0 };
+  profiles.getSnapshot()->forEachProfile(
+      [&count](const std::string&, const std::type_index&, const std::string&, const std::shared_ptr<const void>&) {
+        ++count;
+      });
+  EXPECT_EQ(count, 2U);
+}
+
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileTableTest)  // NOLINT
+{
+  ProfileDictionary profiles;
+  profiles.addProfile<ProfileBase>("ns", "RASTER", std::make_shared<ProfileTest>(1));
+  profiles.addProfile<ProfileBase>("ns", "REMAPPED", std::make_shared<ProfileTest>(2));
+
+  auto overrides = std::make_shared<ProfileDictionary>();
+  overrides->addProfile<ProfileBase>("ns", "RASTER", std::make_shared<ProfileTest>(3));
+
+  PlannerProfileRemapping remapping;
+  remapping["ns"]["TRANSITION"] = "REMAPPED";
+
+  StateWaypointPoly wp{ StateWaypoint({ "j1" }, Eigen::VectorXd::Zero(1)) };
+  MoveInstruction raster(wp, MoveInstructionType::LINEAR, "RASTER");
+  MoveInstruction transition(wp, MoveInstructionType::FREESPACE, "TRANSITION");
+  MoveInstruction missing(wp, MoveInstructionType::FREESPACE, "DoesNotExist");
+  MoveInstruction path_profile(wp, MoveInstructionType::LINEAR, "DoesNotExist", "RASTER");
+  MoveInstruction overridden(wp, MoveInstructionType::LINEAR, "RASTER");
+  overridden.setProfileOverrides(overrides);
+
+  CompositeInstruction program;
+  program.appendMoveInstruction(raster);
+  program.appendMoveInstruction(transition);
+  program.appendMoveInstruction(missing);
+  program.appendMoveInstruction(missing);
+  program.appendMoveInstruction(path_profile);
+  program.appendMoveInstruction(overridden);
+
+  auto default_profile = std::make_shared<ProfileTest>(0);
+  ProfileResolver<ProfileBase> resolver("ns", profiles, remapping, default_profile);
+  const ProfileTable<ProfileBase> table(program.flatten(&moveFilter), resolver);
+  ASSERT_EQ(table.size(), 6U);
+  EXPECT_EQ(table[0]->a, 1);
+  EXPECT_EQ(table[1]->a, 2);
+  EXPECT_EQ(table[2], default_profile);
+  EXPECT_EQ(table[3], default_profile);
+  EXPECT_EQ(table[4], default_profile);
+  EXPECT_EQ(table[5]->a, 3);
+  EXPECT_ANY_THROW(table.at(6));  // NOLINT
+
+  // The path profile is used if requested and not empty
+  const ProfileTable<ProfileBase> path_table(program.flatten(&moveFilter), resolver, true);
+  EXPECT_EQ(path_table[0], table[0]);
+  EXPECT_EQ(path_table[4], table[0]);
+
+  // Without a default profile missing profiles are nullptr
+  ProfileResolver<ProfileBase> null_resolver("ns", profiles, remapping);
+  EXPECT_TRUE(null_resolver.resolve("DoesNotExist") == nullptr);
+  EXPECT_EQ(null_resolver.resolve("RASTER")->a, 1);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
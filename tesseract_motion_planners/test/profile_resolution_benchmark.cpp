@@ -0,0 +1,175 @@
+/**
+ * @file profile_resolution_benchmark.cpp
+ * @brief Benchmark resolving plan profiles for large programs and from concurrent planner threads
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_motion_planners/planner_utils.h>
+
+using namespace tesseract_planning;
+
+const std::string PLANNER_NAMESPACE = "BenchmarkPlanner";
+
+struct BenchmarkPlanProfile
+{
+  using ConstPtr = std::shared_ptr<const BenchmarkPlanProfile>;
+
+  BenchmarkPlanProfile() = default;
+  BenchmarkPlanProfile(double v) : velocity_scaling(v) {}
+
+  double velocity_scaling{ 1 };
+  std::vector<double> weights = std::vector<double>(6, 1);
+};
+
+/** @brief Create a raster program alternating between a profile that exists and one that falls back to the default */
+CompositeInstruction createProgram(std::size_t num_waypoints)
+{
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  CompositeInstruction program("raster_program");
+
+  const std::size_t raster_size = 100;
+  for (std::size_t r = 0; r < num_waypoints / raster_size; ++r)
+  {
+    CompositeInstruction raster;
+    const std::string profile = (r % 2 == 0) ? "RASTER" : "TRANSITION";
+    for (std::size_t i = 0; i < raster_size; ++i)
+    {
+      JointWaypointPoly wp{ JointWaypoint(joint_names, Eigen::VectorXd::Constant(6, static_cast<double>(i))) };
+      raster.appendMoveInstruction(MoveInstruction(wp, MoveInstructionType::LINEAR, profile));
+    }
+    program.push_back(raster);
+  }
+
+  return program;
+}
+
+ProfileDictionary createProfileDictionary()
+{
+  ProfileDictionary profiles;
+  profiles.addProfile<BenchmarkPlanProfile>(PLANNER_NAMESPACE, "RASTER", std::make_shared<BenchmarkPlanProfile>(0.5));
+  profiles.addProfile<BenchmarkPlanProfile>(PLANNER_NAMESPACE, "FREESPACE", std::make_shared<BenchmarkPlanProfile>());
+  return profiles;
+}
+
+/** @brief Resolve the profile per waypoint, allocating a default profile for every lookup */
+static void BM_GetProfilePerWaypoint(benchmark::State& state)
+{
+  const CompositeInstruction program = createProgram(static_cast<std::size_t>(state.range(0)));
+  const ProfileDictionary profiles = createProfileDictionary();
+  const PlannerProfileRemapping remapping;
+  const auto move_instructions = program.flatten(&moveFilter);
+
+  for (auto _ : state)
+  {
+    double sum{ 0 };
+    for (const auto& instruction : move_instructions)
+    {
+      const auto& mi = instruction.get().as<MoveInstructionPoly>();
+      std::string profile = getProfileString(PLANNER_NAMESPACE, mi.getProfile(), remapping);
+      BenchmarkPlanProfile::ConstPtr cur_profile = getProfile<BenchmarkPlanProfile>(
+          PLANNER_NAMESPACE, profile, profiles, std::make_shared<BenchmarkPlanProfile>());
+      cur_profile = applyProfileOverrides(PLANNER_NAMESPACE, profile, cur_profile, mi.getProfileOverrides());
+      sum += cur_profile->velocity_scaling;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(BM_GetProfilePerWaypoint)->Arg(10000);
+
+/** @brief Resolve all profiles once into a profile table */
+static void BM_ProfileTable(benchmark::State& state)
+{
+  const CompositeInstruction program = createProgram(static_cast<std::size_t>(state.range(0)));
+  const ProfileDictionary profiles = createProfileDictionary();
+  const PlannerProfileRemapping remapping;
+  const auto move_instructions = program.flatten(&moveFilter);
+
+  for (auto _ : state)
+  {
+    ProfileResolver<BenchmarkPlanProfile> resolver(
+        PLANNER_NAMESPACE, profiles, remapping, std::make_shared<BenchmarkPlanProfile>());
+    const ProfileTable<BenchmarkPlanProfile> table(move_instructions, resolver);
+
+    double sum{ 0 };
+    for (std::size_t i = 0; i < table.size(); ++i)
+      sum += table[i]->velocity_scaling;
+
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(BM_ProfileTable)->Arg(10000);
+
+/** @brief The dictionary shared by all reader threads of the concurrent benchmarks */
+const ProfileDictionary& getSharedProfileDictionary()
+{
+  static const ProfileDictionary profiles = createProfileDictionary();
+  return profiles;
+}
+
+/** @brief Every lookup of a request goes through the dictionary */
+static void BM_ProfileDictionaryConcurrentLookup(benchmark::State& state)
+{
+  const ProfileDictionary& profiles = getSharedProfileDictionary();
+  for (auto _ : state)
+  {
+    double sum{ 0 };
+    for (int i = 0; i < 100; ++i)
+    {
+      if (profiles.hasProfile<BenchmarkPlanProfile>(PLANNER_NAMESPACE, "RASTER"))
+        sum += profiles.getProfile<BenchmarkPlanProfile>(PLANNER_NAMESPACE, "RASTER")->velocity_scaling;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(BM_ProfileDictionaryConcurrentLookup)->ThreadRange(1, 16)->UseRealTime();
+
+/** @brief A snapshot is taken once per request and all lookups are performed on it */
+static void BM_ProfileDictionarySnapshotConcurrentLookup(benchmark::State& state)
+{
+  const ProfileDictionary& profiles = getSharedProfileDictionary();
+  for (auto _ : state)
+  {
+    ProfileDictionary::Snapshot::ConstPtr snapshot = profiles.getSnapshot();
+    double sum{ 0 };
+    for (int i = 0; i < 100; ++i)
+    {
+      if (auto profile = snapshot->findProfile<BenchmarkPlanProfile>(PLANNER_NAMESPACE, "RASTER"))
+        sum += profile->velocity_scaling;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(BM_ProfileDictionarySnapshotConcurrentLookup)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -81,6 +81,10 @@ OMPLDefaultPlanProfile getOMPLPlanProfile()
   OMPLDefaultPlanProfile ompl_profile;
 
   ompl_profile.simplify = true;
+  ompl_profile.motion_validation_order = OMPLMotionValidationOrder::BISECTION;
+  ompl_profile.fwd_kin_cache_size = 4;
+  ompl_profile.lazy_collision_check = true;
+  ompl_profile.lazy_check_stride = 5;
 
   ompl_profile.planners.push_back(std::make_shared<const SBLConfigurator>());
 
@@ -96,6 +100,10 @@ OMPLDefaultPlanProfile getOMPLPlanProfile()
 
   ompl_profile.planners.push_back(std::make_shared<const RRTConfigurator>());
 
+  ompl_profile.planners.push_back(std::make_shared<const LazyPRMConfigurator>());
+
+  ompl_profile.planners.push_back(std::make_shared<const LazyRRTConfigurator>());
+
   ompl_profile.planners.push_back(std::make_shared<const RRTConnectConfigurator>());
 
   ompl_profile.planners.push_back(std::make_shared<const RRTstarConfigurator>());
@@ -173,6 +181,10 @@ TEST(TesseractMotionPlannersOMPLSerializeUnit, SerializeOMPLDefaultPlanToXml)  /
   EXPECT_TRUE(
       toXMLFile(imported_plan_profile, tesseract_common::getTempPath() + "ompl_default_plan_example_input2.xml"));
   EXPECT_TRUE(plan_profile.simplify == imported_plan_profile.simplify);
+  EXPECT_TRUE(plan_profile.motion_validation_order == imported_plan_profile.motion_validation_order);
+  EXPECT_EQ(plan_profile.fwd_kin_cache_size, imported_plan_profile.fwd_kin_cache_size);
+  EXPECT_EQ(plan_profile.lazy_collision_check, imported_plan_profile.lazy_collision_check);
+  EXPECT_EQ(plan_profile.lazy_check_stride, imported_plan_profile.lazy_check_stride);
 }
 
 TEST(TesseractMotionPlannersDescartesSerializeUnit, SerializeDescartesDefaultPlanToXml)  // NOLINT
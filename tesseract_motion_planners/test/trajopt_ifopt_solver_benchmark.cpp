@@ -0,0 +1,186 @@
+/**
+ * @file trajopt_ifopt_solver_benchmark.cpp
+ * @brief Benchmark the TrajOpt IFOPT planner over a matrix of solver profiles and problems
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_command_language/cartesian_waypoint.h>
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_motion_planner.h>
+#include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_plan_profile.h>
+#include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_composite_profile.h>
+#include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_solver_profile.h>
+#include <tesseract_motion_planners/interface_utils.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+
+static const std::string TRAJOPT_IFOPT_DEFAULT_NAMESPACE = "TrajOptIfoptMotionPlannerTask";
+
+/** @brief The solver settings compared by the benchmarks */
+enum class SolverSettings : std::int64_t
+{
+  DEFAULT = 0,
+  NO_POLISH = 1,
+  ADAPTIVE_RHO = 2,
+  LOOSE_TOLERANCE = 3,
+  NO_WARM_START = 4
+};
+
+/** @brief The problems solved by the benchmarks */
+enum class Problem : std::int64_t
+{
+  FREESPACE = 0,
+  CARTESIAN_LINE = 1
+};
+
+TrajOptIfoptDefaultSolverProfile::Ptr createSolverProfile(SolverSettings settings, std::string& label)
+{
+  auto profile = std::make_shared<TrajOptIfoptDefaultSolverProfile>();
+  switch (settings)
+  {
+    case SolverSettings::DEFAULT:
+      label = "default";
+      break;
+    case SolverSettings::NO_POLISH:
+      label = "no_polish";
+      profile->qp_settings.polish = false;
+      break;
+    case SolverSettings::ADAPTIVE_RHO:
+      label = "adaptive_rho";
+      profile->qp_settings.adaptive_rho = true;
+      break;
+    case SolverSettings::LOOSE_TOLERANCE:
+      label = "loose_tolerance";
+      profile->qp_settings.absolute_tolerance = 1e-3;
+      profile->qp_settings.relative_tolerance = 1e-4;
+      profile->qp_settings.max_iteration = 4000;
+      break;
+    case SolverSettings::NO_WARM_START:
+      label = "no_warm_start";
+      profile->qp_settings.warm_start = false;
+      break;
+  }
+  return profile;
+}
+
+Environment::Ptr createEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  env->init(urdf_path, srdf_path, locator);
+  return env;
+}
+
+CompositeInstruction createProgram(const Environment::Ptr& env, Problem problem)
+{
+  tesseract_common::ManipulatorInfo manip;
+  manip.tcp_frame = "tool0";
+  manip.working_frame = "base_link";
+  manip.manipulator = "manipulator";
+  manip.manipulator_ik_solver = "KDLInvKinChainLMA";
+
+  auto joint_group = env->getJointGroup(manip.manipulator);
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+
+  JointWaypointPoly start{ JointWaypoint(joint_names, Eigen::VectorXd::Zero(7)) };
+  start.getPosition() << 0, 0, 0, -1.57, 0, 0, 0;
+
+  CompositeInstruction program("TEST_PROFILE");
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(start, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  if (problem == Problem::FREESPACE)
+  {
+    JointWaypointPoly goal{ JointWaypoint(joint_names, Eigen::VectorXd::Zero(7)) };
+    goal.getPosition() << 0, 0, 0, 1.57, 0, 0, 0;
+    program.appendMoveInstruction(MoveInstruction(goal, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+    return generateInterpolatedProgram(program, env->getState(), env, 3.14, 1.0, 3.14, 10);
+  }
+
+  // Move the tool along a line starting at the start state
+  Eigen::Isometry3d pose = joint_group->calcFwdKin(start.getPosition()).at(manip.tcp_frame);
+  for (int i = 0; i < 20; ++i)
+  {
+    pose.translation() += Eigen::Vector3d(0, 0.01, 0);
+    CartesianWaypointPoly wp{ CartesianWaypoint(pose) };
+    program.appendMoveInstruction(MoveInstruction(wp, MoveInstructionType::LINEAR, "TEST_PROFILE"));
+  }
+
+  return generateInterpolatedProgram(program, env->getState(), env, 3.14, 1.0, 3.14, 1);
+}
+
+/** @brief Solve a problem using the solver settings provided as the first argument and problem as the second */
+static void BM_TrajOptIfoptSolve(benchmark::State& state)
+{
+  Environment::Ptr env = createEnvironment();
+
+  std::string label;
+  auto solver_profile = createSolverProfile(static_cast<SolverSettings>(state.range(0)), label);
+  const auto problem = static_cast<Problem>(state.range(1));
+  label += (problem == Problem::FREESPACE) ? "/freespace" : "/cartesian_line";
+  state.SetLabel(label);
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<TrajOptIfoptPlanProfile>(
+      TRAJOPT_IFOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptIfoptDefaultPlanProfile>());
+  profiles->addProfile<TrajOptIfoptCompositeProfile>(
+      TRAJOPT_IFOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptIfoptDefaultCompositeProfile>());
+  profiles->addProfile<TrajOptIfoptSolverProfile>(TRAJOPT_IFOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", solver_profile);
+
+  PlannerRequest request;
+  request.instructions = createProgram(env, problem);
+  request.env = env;
+  request.env_state = env->getState();
+  request.profiles = profiles;
+
+  TrajOptIfoptMotionPlanner planner(TRAJOPT_IFOPT_DEFAULT_NAMESPACE);
+  std::size_t failures{ 0 };
+  for (auto _ : state)
+  {
+    PlannerResponse response = planner.solve(request);
+    if (!response.successful)
+      ++failures;
+
+    benchmark::DoNotOptimize(response);
+  }
+
+  state.counters["failures"] = static_cast<double>(failures);
+}
+
+BENCHMARK(BM_TrajOptIfoptSolve)
+    ->ArgsProduct({ { 0, 1, 2, 3, 4 }, { 0, 1 } })
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -21,6 +21,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <console_bridge/console.h>
 
 // These contain the definitions of the cost types
 #include <trajopt/trajectory_costs.hpp>
@@ -40,6 +41,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
 #include <tesseract_motion_planners/trajopt/profile/trajopt_default_plan_profile.h>
 #include <tesseract_motion_planners/trajopt/profile/trajopt_default_composite_profile.h>
+#include <tesseract_motion_planners/trajopt/profile/trajopt_default_solver_profile.h>
 #include <tesseract_motion_planners/core/utils.h>
 #include <tesseract_motion_planners/interface_utils.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
@@ -716,6 +718,96 @@ TEST_F(TesseractPlanningTrajoptUnit, TrajoptArrayJointCost)  // NOLINT
       (tesseract_tests::vectorContainsType<sco::Cost::Ptr, trajopt::TrajOptCostFromErrFunc>(problem->getCosts())));
 }
 
+// This test checks that a solved problem can be updated with new waypoint targets and is warm started
+TEST_F(TesseractPlanningTrajoptUnit, TrajoptUpdateProblem)  // NOLINT
+{
+  auto joint_group = env_->getJointGroup(manip.manipulator);
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+  auto cur_state = env_->getState();
+
+  // Specify a JointWaypoint as the start
+  JointWaypointPoly wp1{ JointWaypoint(joint_names, Eigen::VectorXd::Zero(7)) };
+  wp1.getPosition() << 0, 0, 0, -1.57, 0, 0, 0;
+
+  // Specify a CartesianWaypoint as the finish
+  CartesianWaypointPoly wp2{ CartesianWaypoint(Eigen::Isometry3d::Identity() * Eigen::Translation3d(-.20, .4, 0.2) *
+                                               Eigen::Quaterniond(0, 0, 1.0, 0)) };
+
+  // Create a program
+  CompositeInstruction program("TEST_PROFILE");
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  // Create a seed
+  CompositeInstruction interpolated_program =
+      generateInterpolatedProgram(program, cur_state, env_, 3.14, 1.0, 3.14, 10);
+
+  // Count the iterations to converge
+  int iterations{ 0 };
+  auto solver_profile = std::make_shared<TrajOptDefaultSolverProfile>();
+  solver_profile->callbacks.emplace_back([&iterations](sco::OptProb*, sco::OptResults&) { ++iterations; });
+
+  // Profile Dictionary
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<TrajOptPlanProfile>(
+      TRAJOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptDefaultPlanProfile>());
+  profiles->addProfile<TrajOptCompositeProfile>(
+      TRAJOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptDefaultCompositeProfile>());
+  profiles->addProfile<TrajOptSolverProfile>(TRAJOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", solver_profile);
+
+  // Create Planner
+  TrajOptMotionPlanner test_planner(TRAJOPT_DEFAULT_NAMESPACE);
+
+  // Create Planning Request
+  PlannerRequest request;
+  request.instructions = interpolated_program;
+  request.env = env_;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  PlannerResponse response = test_planner.solve(request);
+  EXPECT_TRUE(response.successful);
+  ASSERT_TRUE(response.data != nullptr);
+  const int cold_iterations = iterations;
+
+  // Move the cartesian target and update the solved problem
+  auto& last_waypoint = request.instructions.getLastMoveInstruction()->getWaypoint().as<CartesianWaypointPoly>();
+  last_waypoint.getTransform().translation() += Eigen::Vector3d(0, 0.01, 0);
+  request.data = response.data;
+  request.update_data = true;
+
+  auto target_updated = [&last_waypoint](const std::shared_ptr<void>& data) {
+    auto pci = std::static_pointer_cast<trajopt::ProblemConstructionInfo>(data);
+    bool updated{ false };
+    for (const auto& ti : pci->cnt_infos)
+    {
+      if (auto pose_info = std::dynamic_pointer_cast<trajopt::CartPoseTermInfo>(ti))
+        updated |= pose_info->target_frame_offset.isApprox(last_waypoint.getTransform());
+    }
+    return updated;
+  };
+
+  iterations = 0;
+  PlannerResponse warm_response = test_planner.solve(request);
+  EXPECT_TRUE(warm_response.successful);
+
+  // The problem in the request is not modified, a copy is updated and returned
+  ASSERT_TRUE(warm_response.data != nullptr);
+  EXPECT_NE(warm_response.data, response.data);
+  EXPECT_FALSE(target_updated(response.data));
+  EXPECT_TRUE(target_updated(warm_response.data));
+  const int warm_iterations = iterations;
+  CONSOLE_BRIDGE_logInform("Iterations to converge, cold start: %d, warm start: %d", cold_iterations, warm_iterations);
+  EXPECT_LE(warm_iterations, cold_iterations);
+
+  // A change in structure creates a new problem
+  request.instructions = program;
+  PlannerResponse new_response = test_planner.solve(request);
+  EXPECT_TRUE(new_response.successful);
+  EXPECT_NE(new_response.data, response.data);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -29,9 +29,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
+#include <tesseract_common/utils.h>
 #include <tesseract_environment/environment.h>
 #include <tesseract_environment/commands/add_link_command.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/interpolation.h>
 #include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_command_language/move_instruction.h>
@@ -1699,6 +1701,85 @@ TEST_F(TesseractPlanningUtilsUnit, checkProgramUnit)  // NOLINT
         contacts, *continuous_manager, *state_solver, tesseract_planning::CompositeInstruction(), config));
   }
 }
+
+TEST_F(TesseractPlanningUtilsUnit, InterpolateBufferUnit)  // NOLINT
+{
+  const long steps = 7;
+  Eigen::VectorXd start(3);
+  Eigen::VectorXd stop(3);
+  start << -1, 0, 0.5;
+  stop << 1, 2, -0.25;
+
+  // Joint interpolation into a block of a larger buffer
+  Eigen::MatrixXd buffer = Eigen::MatrixXd::Zero(3, 2 * (steps + 1));
+  tesseract_planning::interpolate(start, stop, steps, buffer.rightCols(steps + 1));
+  EXPECT_TRUE(buffer.leftCols(steps + 1).isZero());
+  EXPECT_TRUE(buffer.col(steps + 1) == start);
+  EXPECT_TRUE(buffer.col(buffer.cols() - 1) == stop);
+
+  Eigen::MatrixXd states = tesseract_planning::interpolate(start, stop, steps);
+  EXPECT_TRUE(states.isApprox(buffer.rightCols(steps + 1), 1e-12));
+  for (long i = 0; i <= steps; ++i)
+  {
+    Eigen::VectorXd expected = start + (stop - start) * (static_cast<double>(i) / static_cast<double>(steps));
+    EXPECT_TRUE(states.col(i).isApprox(expected, 1e-12));
+  }
+
+  // Cartesian interpolation into a reused buffer
+  Eigen::Isometry3d start_pose = Eigen::Isometry3d::Identity();
+  Eigen::Isometry3d stop_pose = Eigen::Translation3d(1, 0.5, 0.2) * Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ());
+  tesseract_common::VectorIsometry3d poses(20, Eigen::Isometry3d::Identity());
+  tesseract_planning::interpolate(start_pose, stop_pose, steps, poses);
+  ASSERT_EQ(poses.size(), static_cast<std::size_t>(steps + 1));
+  EXPECT_TRUE(poses.front().isApprox(start_pose, 1e-12));
+  EXPECT_TRUE(poses.back().isApprox(stop_pose, 1e-12));
+
+  tesseract_common::VectorIsometry3d expected_poses = tesseract_planning::interpolate(start_pose, stop_pose, steps);
+  ASSERT_EQ(poses.size(), expected_poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i)
+    EXPECT_TRUE(poses[i].isApprox(expected_poses[i], 1e-12));
+}
+
+TEST_F(TesseractPlanningUtilsUnit, GetClosestJointSolutionsUnit)  // NOLINT
+{
+  tesseract_kinematics::KinematicGroup::UPtr manip = env_->getKinematicGroup("manipulator");
+  const std::vector<std::string> joint_names = manip->getJointNames();
+
+  // Create a raster of poses from known joint states
+  Eigen::VectorXd start = Eigen::VectorXd::Zero(7);
+  start << 0, 0.5, 0, -1.2, 0, 0.6, 0;
+  Eigen::VectorXd stop = start;
+  stop(0) = 0.6;
+  stop(2) = 0.2;
+  const Eigen::MatrixXd states = tesseract_planning::interpolate(start, stop, 9);
+
+  tesseract_common::VectorIsometry3d poses;
+  for (long i = 0; i < states.cols(); ++i)
+  {
+    tesseract_scene_graph::SceneState state = env_->getState(joint_names, states.col(i));
+    poses.push_back(state.link_transforms.at("base_link").inverse() * state.link_transforms.at("tool0"));
+  }
+
+  std::vector<Eigen::VectorXd> solutions = getClosestJointSolutions(*manip, poses, "base_link", "tool0", start);
+  ASSERT_EQ(solutions.size(), poses.size());
+  for (std::size_t i = 0; i < solutions.size(); ++i)
+  {
+    ASSERT_EQ(solutions[i].size(), 7);
+    EXPECT_TRUE(tesseract_common::satisfiesPositionLimits<double>(solutions[i], manip->getLimits().joint_limits));
+
+    tesseract_scene_graph::SceneState state = env_->getState(joint_names, solutions[i]);
+    Eigen::Isometry3d pose = state.link_transforms.at("base_link").inverse() * state.link_transforms.at("tool0");
+    EXPECT_TRUE(pose.isApprox(poses[i], 1e-3));
+  }
+
+  // An unreachable pose results in an empty solution but does not stop the remaining poses from being solved
+  poses[4].translation() = Eigen::Vector3d(10, 0, 0);
+  solutions = getClosestJointSolutions(*manip, poses, "base_link", "tool0", start);
+  ASSERT_EQ(solutions.size(), poses.size());
+  EXPECT_EQ(solutions[4].size(), 0);
+  EXPECT_EQ(solutions[5].size(), 7);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
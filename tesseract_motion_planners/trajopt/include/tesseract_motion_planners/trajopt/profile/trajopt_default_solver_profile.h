@@ -57,8 +57,17 @@ public:
   /** @brief Optimization callbacks */
   std::vector<sco::Optimizer::Callback> callbacks;
 
+  /**
+   * @brief Solve trajectories longer than the window size as overlapping windows
+   * @details The blended window solutions seed the full problem, which reduces the solve time of long cartesian
+   * segments (i.e. rasters).
+   */
+  TrajOptWindowSettings window;
+
   void apply(trajopt::ProblemConstructionInfo& pci) const override;
 
+  TrajOptWindowSettings getWindowSettings() const override;
+
   tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const override;
 };
 }  // namespace tesseract_planning
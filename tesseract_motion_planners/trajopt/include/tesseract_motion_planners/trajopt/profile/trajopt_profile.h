@@ -92,6 +92,21 @@ public:
   virtual tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const = 0;
 };
 
+/**
+ * @brief Settings for solving a long trajectory as overlapping windows
+ * @details The windows are solved in order, each seeded with the solution of the previous window over the steps they
+ * share. The solutions of consecutive windows are linearly blended over the shared steps and used as the seed of the
+ * full problem, which converges in fewer iterations than from the default seed.
+ */
+struct TrajOptWindowSettings
+{
+  /** @brief The max number of steps in a window, if zero the trajectory is solved as a single problem */
+  int window_size{ 0 };
+
+  /** @brief The number of steps shared by consecutive windows, this is limited to half of the window size */
+  int overlap{ 4 };
+};
+
 class TrajOptSolverProfile
 {
 public:
@@ -107,6 +122,9 @@ public:
 
   virtual void apply(trajopt::ProblemConstructionInfo& pci) const = 0;
 
+  /** @brief Get the settings for solving long trajectories as overlapping windows, by default windowing is disabled */
+  virtual TrajOptWindowSettings getWindowSettings() const { return {}; }
+
   virtual tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const = 0;
 };
 
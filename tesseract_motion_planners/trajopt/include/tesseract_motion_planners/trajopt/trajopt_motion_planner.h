@@ -57,6 +57,33 @@ public:
   MotionPlanner::Ptr clone() const override;
 
   virtual std::shared_ptr<trajopt::ProblemConstructionInfo> createProblem(const PlannerRequest& request) const;
+
+  /**
+   * @brief Update the waypoint targets of a previously created problem from the request instructions
+   * @details The seed is left as is, which after a successful solve is the previous solution. Fixed joint waypoints
+   * also update the seed. The problem is left unchanged if it can not be updated, and the updated terms are replaced by
+   * copies so a problem it was copied from is not affected. solve() updates a copy of the problem in the request.
+   * @param pci The problem to update
+   * @param request The planning request with the same structure as the request used to create the problem
+   * @return True if the problem was updated, false if the structure changed and the problem must be recreated
+   */
+  virtual bool updateProblem(trajopt::ProblemConstructionInfo& pci, const PlannerRequest& request) const;
+
+protected:
+  /** @brief Get the solver profile for the request */
+  TrajOptSolverProfile::ConstPtr getSolverProfile(const PlannerRequest& request) const;
+
+  /**
+   * @brief Create the problem seeded by solving the request as overlapping windows
+   * @details The windows are solved in order and each window is seeded with the solution of the previous window over
+   * the shared steps. The blended window solutions are the seed of the full problem, so the final solve validates the
+   * blended steps. If a window fails the full problem is returned with its default seed.
+   * @param request The planning request
+   * @param settings The window settings
+   * @return The full problem seeded with the blended window solutions
+   */
+  std::shared_ptr<trajopt::ProblemConstructionInfo> createWindowedProblem(const PlannerRequest& request,
+                                                                          const TrajOptWindowSettings& settings) const;
 };
 
 }  // namespace tesseract_planning
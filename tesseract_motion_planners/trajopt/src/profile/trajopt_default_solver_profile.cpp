@@ -36,6 +36,8 @@ void TrajOptDefaultSolverProfile::apply(trajopt::ProblemConstructionInfo& pci) c
   pci.callbacks = callbacks;
 }
 
+TrajOptWindowSettings TrajOptDefaultSolverProfile::getWindowSettings() const { return window; }
+
 tinyxml2::XMLElement* TrajOptDefaultSolverProfile::toXML(tinyxml2::XMLDocument& /*doc*/) const { return nullptr; }
 
 }  // namespace tesseract_planning
@@ -33,6 +33,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <trajopt_sco/optimizers.hpp>
 #include <trajopt_sco/sco_common.hpp>
 #include <tesseract_environment/utils.h>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
@@ -50,6 +53,55 @@ constexpr auto ERROR_FAILED_TO_FIND_VALID_SOLUTION{ "Failed to find valid soluti
 
 using namespace trajopt;
 
+namespace
+{
+/**
+ * @brief Optimize the problem
+ * @param pci The problem construction info
+ * @return The solution within the joint limits, if it failed to converge an empty trajectory is returned
+ */
+tesseract_common::TrajArray optimize(const trajopt::ProblemConstructionInfo& pci)
+{
+  // Construct Problem
+  trajopt::TrajOptProb::Ptr problem = trajopt::ConstructProblem(pci);
+
+  // Create optimizer
+  sco::BasicTrustRegionSQP::Ptr opt;
+  if (pci.opt_info.num_threads > 1)
+    opt = std::make_shared<sco::BasicTrustRegionSQPMultiThreaded>(problem);
+  else
+    opt = std::make_shared<sco::BasicTrustRegionSQP>(problem);
+
+  opt->setParameters(pci.opt_info);
+
+  // Add all callbacks
+  for (const sco::Optimizer::Callback& callback : pci.callbacks)
+    opt->addCallback(callback);
+
+  // Initialize
+  opt->initialize(trajToDblVec(problem->GetInitTraj()));
+
+  // Optimize
+  opt->optimize();
+  if (opt->results().status != sco::OptStatus::OPT_CONVERGED)
+    return {};
+
+  const Eigen::MatrixX2d joint_limits = problem->GetKin()->getLimits().joint_limits;
+
+  // Get the results
+  tesseract_common::TrajArray traj = getTraj(opt->x(), problem->GetVars());
+
+  // Enforce limits
+  for (Eigen::Index i = 0; i < traj.rows(); i++)
+  {
+    assert(tesseract_common::satisfiesPositionLimits<double>(traj.row(i), joint_limits, 1e-4));
+    tesseract_common::enforcePositionLimits<double>(traj.row(i), joint_limits);
+  }
+
+  return traj;
+}
+}  // namespace
+
 namespace tesseract_planning
 {
 TrajOptMotionPlanner::TrajOptMotionPlanner(std::string name) : MotionPlanner(std::move(name)) {}
@@ -78,12 +130,27 @@ PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
   if (request.data)
   {
     pci = std::static_pointer_cast<trajopt::ProblemConstructionInfo>(request.data);
+
+    // The problem in the request may be shared with other solves, so a copy is updated and returned
+    if (request.update_data)
+    {
+      auto updated_pci = std::make_shared<trajopt::ProblemConstructionInfo>(*pci);
+      pci = updateProblem(*updated_pci, request) ? updated_pci : nullptr;
+      if (pci == nullptr)
+        CONSOLE_BRIDGE_logDebug("TrajOptPlanner failed to update problem, creating a new problem");
+    }
   }
-  else
+
+  if (pci == nullptr)
   {
     try
     {
-      pci = createProblem(request);
+      TrajOptWindowSettings window_settings = getSolverProfile(request)->getWindowSettings();
+      if (window_settings.window_size > 0 &&
+          request.instructions.getMoveInstructionCount() > static_cast<long>(window_settings.window_size))
+        pci = createWindowedProblem(request, window_settings);
+      else
+        pci = createProblem(request);
     }
     catch (std::exception& e)
     {
@@ -92,12 +159,8 @@ PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
       response.message = ERROR_INVALID_INPUT;
       return response;
     }
-
-    response.data = pci;
   }
-
-  // Construct Problem
-  trajopt::TrajOptProb::Ptr problem = trajopt::ConstructProblem(*pci);
+  response.data = pci;
 
   // Set Log Level
   if (request.verbose)
@@ -105,44 +168,25 @@ PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
   else
     trajopt_common::gLogLevel = trajopt_common::LevelWarn;
 
-  // Create optimizer
-  sco::BasicTrustRegionSQP::Ptr opt;
-  if (pci->opt_info.num_threads > 1)
-    opt = std::make_shared<sco::BasicTrustRegionSQPMultiThreaded>(problem);
-  else
-    opt = std::make_shared<sco::BasicTrustRegionSQP>(problem);
-
-  opt->setParameters(pci->opt_info);
-
-  // Add all callbacks
-  for (const sco::Optimizer::Callback& callback : pci->callbacks)
-    opt->addCallback(callback);
-
-  // Initialize
-  opt->initialize(trajToDblVec(problem->GetInitTraj()));
-
   // Optimize
-  opt->optimize();
-  if (opt->results().status != sco::OptStatus::OPT_CONVERGED)
+  tesseract_common::TrajArray traj = optimize(*pci);
+  if (traj.rows() == 0)
   {
     response.successful = false;
     response.message = ERROR_FAILED_TO_FIND_VALID_SOLUTION;
     return response;
   }
 
-  const std::vector<std::string> joint_names = problem->GetKin()->getJointNames();
-  const Eigen::MatrixX2d joint_limits = problem->GetKin()->getLimits().joint_limits;
-
-  // Get the results
-  tesseract_common::TrajArray traj = getTraj(opt->x(), problem->GetVars());
-
-  // Enforce limits
-  for (Eigen::Index i = 0; i < traj.rows(); i++)
+  // Keep the solution as the seed so an update of this problem is warm started, the problem is only modified if it
+  // was created or copied by this solve
+  if (request.data == nullptr || request.update_data)
   {
-    assert(tesseract_common::satisfiesPositionLimits<double>(traj.row(i), joint_limits, 1e-4));
-    tesseract_common::enforcePositionLimits<double>(traj.row(i), joint_limits);
+    pci->init_info.type = trajopt::InitInfo::GIVEN_TRAJ;
+    pci->init_info.data = traj;
   }
 
+  const std::vector<std::string> joint_names = pci->kin->getJointNames();
+
   // Flatten the results to make them easier to process
   response.results = request.instructions;
   auto results_instructions = response.results.flatten(&moveFilter);
@@ -159,6 +203,101 @@ PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
   return response;
 }
 
+std::shared_ptr<trajopt::ProblemConstructionInfo>
+TrajOptMotionPlanner::createWindowedProblem(const PlannerRequest& request, const TrajOptWindowSettings& settings) const
+{
+  std::shared_ptr<trajopt::ProblemConstructionInfo> pci = createProblem(request);
+
+  const auto move_instructions = request.instructions.flatten(&moveFilter);
+  const auto num_steps = static_cast<long>(move_instructions.size());
+  const long window_size = std::max(settings.window_size, 2);
+  const long overlap = std::clamp(static_cast<long>(settings.overlap), 1L, window_size / 2);
+
+  // Split the steps into windows [first, last] where consecutive windows share overlap steps
+  std::vector<std::pair<long, long>> windows;
+  for (long first = 0;; first += window_size - overlap)
+  {
+    const long last = std::min(first + window_size - 1, num_steps - 1);
+    windows.emplace_back(first, last);
+    if (last == num_steps - 1)
+      break;
+  }
+
+  // Set Log Level
+  if (request.verbose)
+    trajopt_common::gLogLevel = trajopt_common::LevelInfo;
+  else
+    trajopt_common::gLogLevel = trajopt_common::LevelWarn;
+
+  // Solve the windows in order, each window is planned as its own composite with the same profiles and manipulator
+  // info. The steps shared with the previous window are seeded with its solution so consecutive windows stay on the
+  // same solution branch, and the overlap is blended weighting the next window more the further into the overlap.
+  tesseract_common::TrajArray seed = pci->init_info.data;
+  tesseract_common::TrajArray prev_window_traj;
+  for (std::size_t w = 0; w < windows.size(); ++w)
+  {
+    const long first = windows[w].first;
+    const long shared_last = (w > 0) ? windows[w - 1].second : first - 1;
+
+    PlannerRequest window_request = request;
+    CompositeInstruction window_instructions(
+        request.instructions.getProfile(), request.instructions.getOrder(), request.instructions.getManipulatorInfo());
+    window_instructions.setProfileOverrides(request.instructions.getProfileOverrides());
+    window_instructions.reserve(static_cast<std::size_t>(windows[w].second - first + 1));
+    for (long i = first; i <= windows[w].second; ++i)
+      window_instructions.push_back(move_instructions[static_cast<std::size_t>(i)].get());
+
+    window_request.instructions = std::move(window_instructions);
+    window_request.data = nullptr;
+
+    std::shared_ptr<trajopt::ProblemConstructionInfo> window_pci = createProblem(window_request);
+    for (long i = first; i <= shared_last; ++i)
+      window_pci->init_info.data.row(i - first) = prev_window_traj.row(i - windows[w - 1].first);
+
+    tesseract_common::TrajArray window_traj = optimize(*window_pci);
+    if (window_traj.rows() == 0)
+    {
+      // The full problem is still solved, only without the seed from the windows
+      CONSOLE_BRIDGE_logDebug("TrajOptPlanner failed to find a solution for window %zu, using the default seed.", w);
+      return pci;
+    }
+
+    const auto num_shared = static_cast<double>(shared_last - first + 1);
+    for (long i = first; i <= windows[w].second; ++i)
+    {
+      if (i <= shared_last)
+      {
+        const double weight = static_cast<double>(i - first + 1) / (num_shared + 1);
+        seed.row(i) = (1 - weight) * seed.row(i) + weight * window_traj.row(i - first);
+      }
+      else
+      {
+        seed.row(i) = window_traj.row(i - first);
+      }
+    }
+
+    prev_window_traj = std::move(window_traj);
+  }
+
+  // The blended solution of the windows is only a seed, the full problem is solved from it so the blended steps are
+  // validated against all the costs and constraints before a solution is reported
+  pci->init_info.type = trajopt::InitInfo::GIVEN_TRAJ;
+  pci->init_info.data = seed;
+  return pci;
+}
+
+TrajOptSolverProfile::ConstPtr TrajOptMotionPlanner::getSolverProfile(const PlannerRequest& request) const
+{
+  std::string profile = getProfileString(name_, request.instructions.getProfile(), request.plan_profile_remapping);
+  TrajOptSolverProfile::ConstPtr solver_profile = getProfile<TrajOptSolverProfile>(
+      name_, profile, *request.profiles, std::make_shared<TrajOptDefaultSolverProfile>());
+  solver_profile = applyProfileOverrides(name_, profile, solver_profile, request.instructions.getProfileOverrides());
+  if (!solver_profile)
+    throw std::runtime_error("TrajOptMotionPlanner: Invalid profile");
+
+  return solver_profile;
+}
+
 std::shared_ptr<trajopt::ProblemConstructionInfo>
 TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
 {
@@ -210,16 +349,7 @@ TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
   }
 
   // Apply Solver parameters
-  std::string profile = request.instructions.getProfile();
-  ProfileDictionary::ConstPtr profile_overrides = request.instructions.getProfileOverrides();
-  profile = getProfileString(name_, profile, request.plan_profile_remapping);
-  TrajOptSolverProfile::ConstPtr solver_profile = getProfile<TrajOptSolverProfile>(
-      name_, profile, *request.profiles, std::make_shared<TrajOptDefaultSolverProfile>());
-  solver_profile = applyProfileOverrides(name_, profile, solver_profile, profile_overrides);
-  if (!solver_profile)
-    throw std::runtime_error("TrajOptMotionPlanner: Invalid profile");
-
-  solver_profile->apply(*pci);
+  getSolverProfile(request)->apply(*pci);
 
   // Get kinematics information
   tesseract_environment::Environment::ConstPtr env = request.env;
@@ -229,6 +359,11 @@ TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
   // Flatten the input for planning
   auto move_instructions = request.instructions.flatten(&moveFilter);
 
+  // Resolve the plan profiles once for all move instructions
+  ProfileResolver<TrajOptPlanProfile> plan_profile_resolver(
+      name_, *request.profiles, request.plan_profile_remapping, std::make_shared<TrajOptDefaultPlanProfile>());
+  const ProfileTable<TrajOptPlanProfile> plan_profiles(move_instructions, plan_profile_resolver);
+
   // Create a temp seed storage.
   std::vector<Eigen::VectorXd> seed_states;
   seed_states.reserve(move_instructions.size());
@@ -250,10 +385,7 @@ TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
       throw std::runtime_error("TrajOpt, working_frame is empty!");
 
     // Get Plan Profile
-    std::string profile = getProfileString(name_, move_instruction.getProfile(), request.plan_profile_remapping);
-    TrajOptPlanProfile::ConstPtr cur_plan_profile = getProfile<TrajOptPlanProfile>(
-        name_, profile, *request.profiles, std::make_shared<TrajOptDefaultPlanProfile>());
-    cur_plan_profile = applyProfileOverrides(name_, profile, cur_plan_profile, move_instruction.getProfileOverrides());
+    const TrajOptPlanProfile::ConstPtr& cur_plan_profile = plan_profiles[static_cast<std::size_t>(i)];
     if (!cur_plan_profile)
       throw std::runtime_error("TrajOptMotionPlanner: Invalid profile");
 
@@ -333,7 +465,8 @@ TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
   for (long i = 0; i < pci->basic_info.n_steps; ++i)
     pci->init_info.data.row(i) = seed_states[static_cast<std::size_t>(i)];
 
-  profile = getProfileString(name_, request.instructions.getProfile(), request.composite_profile_remapping);
+  std::string profile =
+      getProfileString(name_, request.instructions.getProfile(), request.composite_profile_remapping);
   TrajOptCompositeProfile::ConstPtr cur_composite_profile = getProfile<TrajOptCompositeProfile>(
       name_, profile, *request.profiles, std::make_shared<TrajOptDefaultCompositeProfile>());
   cur_composite_profile =
@@ -345,4 +478,109 @@ TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
 
   return pci;
 }
+
+bool TrajOptMotionPlanner::updateProblem(trajopt::ProblemConstructionInfo& pci, const PlannerRequest& request) const
+{
+  if (pci.env != request.env || pci.kin == nullptr)
+    return false;
+
+  auto move_instructions = request.instructions.flatten(&moveFilter);
+  if (static_cast<int>(move_instructions.size()) != pci.basic_info.n_steps ||
+      pci.init_info.data.rows() != pci.basic_info.n_steps)
+    return false;
+
+  // The waypoint terms are identified by the names assigned when they were created
+  std::unordered_map<std::string, trajopt::TermInfo::Ptr*> terms;
+  for (auto& ti : pci.cost_infos)
+    terms[ti->name] = &ti;
+
+  for (auto& ti : pci.cnt_infos)
+    terms[ti->name] = &ti;
+
+  auto findTerm = [&terms](const std::string& name) -> trajopt::TermInfo::Ptr* {
+    auto it = terms.find(name);
+    return (it == terms.end()) ? nullptr : it->second;
+  };
+
+  // All waypoints are checked before the problem is changed, so it is left as is if it can not be updated. The terms
+  // may be shared with the problem this one was copied from, so they are replaced by updated copies.
+  std::vector<std::function<void()>> updates;
+  const std::vector<int>& fixed_steps = pci.basic_info.fixed_timesteps;
+  for (int i = 0; i < pci.basic_info.n_steps; ++i)
+  {
+    const auto& move_instruction = move_instructions[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>();
+    const std::string index = std::to_string(i);
+    trajopt::TermInfo::Ptr* joint_ti = findTerm("joint_waypoint_" + index);
+    trajopt::TermInfo::Ptr* cart_ti = findTerm("cartesian_waypoint_" + index);
+    trajopt::TermInfo::Ptr* dyn_cart_ti = findTerm("dyn_cartesian_waypoint_" + index);
+
+    if (move_instruction.getWaypoint().isCartesianWaypoint())
+    {
+      if (joint_ti != nullptr)
+        return false;
+
+      const Eigen::Isometry3d transform = move_instruction.getWaypoint().as<CartesianWaypointPoly>().getTransform();
+      if (cart_ti != nullptr && std::dynamic_pointer_cast<trajopt::CartPoseTermInfo>(*cart_ti))
+      {
+        updates.emplace_back([cart_ti, transform] {
+          auto term = std::make_shared<trajopt::CartPoseTermInfo>(static_cast<trajopt::CartPoseTermInfo&>(**cart_ti));
+          term->target_frame_offset = transform;
+          *cart_ti = term;
+        });
+      }
+      else if (dyn_cart_ti != nullptr && std::dynamic_pointer_cast<trajopt::DynamicCartPoseTermInfo>(*dyn_cart_ti))
+      {
+        updates.emplace_back([dyn_cart_ti, transform] {
+          auto term = std::make_shared<trajopt::DynamicCartPoseTermInfo>(
+              static_cast<trajopt::DynamicCartPoseTermInfo&>(**dyn_cart_ti));
+          term->target_frame_offset = transform;
+          *dyn_cart_ti = term;
+        });
+      }
+    }
+    else if (move_instruction.getWaypoint().isJointWaypoint() || move_instruction.getWaypoint().isStateWaypoint())
+    {
+      if (cart_ti != nullptr || dyn_cart_ti != nullptr)
+        return false;
+
+      Eigen::VectorXd position;
+      if (move_instruction.getWaypoint().isJointWaypoint())
+      {
+        const auto& jwp = move_instruction.getWaypoint().as<JointWaypointPoly>();
+        if (!jwp.isConstrained())
+          continue;
+
+        position = jwp.getPosition();
+      }
+      else
+      {
+        position = move_instruction.getWaypoint().as<StateWaypointPoly>().getPosition();
+      }
+
+      if (position.size() != pci.init_info.data.cols())
+        return false;
+
+      if (joint_ti != nullptr && std::dynamic_pointer_cast<trajopt::JointPosTermInfo>(*joint_ti))
+      {
+        updates.emplace_back([joint_ti, position] {
+          auto term = std::make_shared<trajopt::JointPosTermInfo>(static_cast<trajopt::JointPosTermInfo&>(**joint_ti));
+          term->targets = std::vector<double>(position.data(), position.data() + position.size());
+          *joint_ti = term;
+        });
+      }
+
+      if (std::find(fixed_steps.begin(), fixed_steps.end(), i) != fixed_steps.end())
+        updates.emplace_back([&pci, i, position] { pci.init_info.data.row(i) = position.transpose(); });
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  for (const auto& update : updates)
+    update();
+
+  return true;
+}
 }  // namespace tesseract_planning
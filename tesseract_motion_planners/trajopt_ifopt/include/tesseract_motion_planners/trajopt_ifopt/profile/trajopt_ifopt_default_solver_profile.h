@@ -0,0 +1,92 @@
+/**
+ * @file trajopt_ifopt_default_solver_profile.h
+ * @brief TrajOpt IFOPT default solver profile
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_TRAJOPT_IFOPT_DEFAULT_SOLVER_PROFILE_H
+#define TESSERACT_MOTION_PLANNERS_TRAJOPT_IFOPT_DEFAULT_SOLVER_PROFILE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+#include <trajopt_sqp/types.h>
+#include <trajopt_sqp/sqp_callback.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_profile.h>
+
+namespace tesseract_planning
+{
+/** @brief The OSQP settings used by the default solver profile */
+struct TrajOptIfoptOSQPSettings
+{
+  /** @brief Warm start each QP with the solution of the previous QP */
+  bool warm_start{ true };
+
+  /** @brief Polish the QP solution, this improves the accuracy at the cost of an additional solve */
+  bool polish{ true };
+
+  /** @brief Adapt the ADMM step size (rho) while solving */
+  bool adaptive_rho{ false };
+
+  /** @brief The max number of ADMM iterations per QP */
+  int max_iteration{ 8192 };
+
+  /** @brief The absolute convergence tolerance */
+  double absolute_tolerance{ 1e-4 };
+
+  /** @brief The relative convergence tolerance */
+  double relative_tolerance{ 1e-6 };
+};
+
+/** @brief The contains the default solver parameters available for setting up TrajOpt IFOPT */
+class TrajOptIfoptDefaultSolverProfile : public TrajOptIfoptSolverProfile
+{
+public:
+  using Ptr = std::shared_ptr<TrajOptIfoptDefaultSolverProfile>;
+  using ConstPtr = std::shared_ptr<const TrajOptIfoptDefaultSolverProfile>;
+
+  TrajOptIfoptDefaultSolverProfile() = default;
+  ~TrajOptIfoptDefaultSolverProfile() override = default;
+  TrajOptIfoptDefaultSolverProfile(const TrajOptIfoptDefaultSolverProfile&) = default;
+  TrajOptIfoptDefaultSolverProfile& operator=(const TrajOptIfoptDefaultSolverProfile&) = default;
+  TrajOptIfoptDefaultSolverProfile(TrajOptIfoptDefaultSolverProfile&&) = default;
+  TrajOptIfoptDefaultSolverProfile& operator=(TrajOptIfoptDefaultSolverProfile&&) = default;
+
+  /** @brief The OSQP settings */
+  TrajOptIfoptOSQPSettings qp_settings;
+
+  /** @brief Optimization paramters */
+  trajopt_sqp::SQPParameters opt_info;
+
+  /** @brief Optimization callbacks, these are called in addition to the callbacks of the planner */
+  std::vector<trajopt_sqp::SQPCallback::Ptr> callbacks;
+
+  trajopt_sqp::QPSolver::Ptr createQPSolver() const override;
+
+  void apply(trajopt_sqp::TrustRegionSQPSolver& solver) const override;
+
+  tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const override;
+};
+}  // namespace tesseract_planning
+#endif  // TESSERACT_MOTION_PLANNERS_TRAJOPT_IFOPT_DEFAULT_SOLVER_PROFILE_H
@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <vector>
 #include <memory>
 #include <ifopt/problem.h>
+#include <trajopt_sqp/trust_region_sqp_solver.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/poly/instruction_poly.h>
@@ -94,6 +95,32 @@ public:
   virtual tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const = 0;
 };
 
+class TrajOptIfoptSolverProfile
+{
+public:
+  using Ptr = std::shared_ptr<TrajOptIfoptSolverProfile>;
+  using ConstPtr = std::shared_ptr<const TrajOptIfoptSolverProfile>;
+
+  TrajOptIfoptSolverProfile() = default;
+  virtual ~TrajOptIfoptSolverProfile() = default;
+  TrajOptIfoptSolverProfile(const TrajOptIfoptSolverProfile&) = default;
+  TrajOptIfoptSolverProfile& operator=(const TrajOptIfoptSolverProfile&) = default;
+  TrajOptIfoptSolverProfile(TrajOptIfoptSolverProfile&&) = default;
+  TrajOptIfoptSolverProfile& operator=(TrajOptIfoptSolverProfile&&) = default;
+
+  /**
+   * @brief Create the QP solver (backend) used to solve the convexified problems
+   * @details This is called once per problem, the QP solver is kept with the problem when it is solved again
+   */
+  virtual trajopt_sqp::QPSolver::Ptr createQPSolver() const = 0;
+
+  /** @brief Apply the SQP parameters and callbacks to the solver */
+  virtual void apply(trajopt_sqp::TrustRegionSQPSolver& solver) const = 0;
+
+  virtual tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const = 0;
+};
+
+using TrajOptIfoptSolverProfileMap = std::unordered_map<std::string, TrajOptIfoptSolverProfile::ConstPtr>;
 using TrajOptIfoptCompositeProfileMap = std::unordered_map<std::string, TrajOptIfoptCompositeProfile::ConstPtr>;
 using TrajOptIfoptPlanProfileMap = std::unordered_map<std::string, TrajOptIfoptPlanProfile::ConstPtr>;
 
@@ -61,6 +61,21 @@ public:
   MotionPlanner::Ptr clone() const override;
 
   virtual std::shared_ptr<TrajOptIfoptProblem> createProblem(const PlannerRequest& request) const;
+
+  /**
+   * @brief Create a problem for the request instructions seeded with the variables of a previously solved problem
+   * @details The variables of a solved problem are the previous solution, so the new problem is warm started. The
+   * previous problem is not modified.
+   * @param problem The previously solved problem
+   * @param request The planning request with the same structure as the request used to create the problem
+   * @return The updated problem, nullptr if the request does not have the same structure
+   */
+  virtual std::shared_ptr<TrajOptIfoptProblem> updateProblem(const TrajOptIfoptProblem& problem,
+                                                             const PlannerRequest& request) const;
+
+protected:
+  /** @brief Get the solver profile for the request */
+  TrajOptIfoptSolverProfile::ConstPtr getSolverProfile(const PlannerRequest& request) const;
 };
 
 }  // namespace tesseract_planning
@@ -29,15 +29,20 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <trajopt_sqp/qp_problem.h>
+#include <trajopt_sqp/qp_solver.h>
 #include <vector>
+#include <map>
 #include <memory>
 #include <trajopt_ifopt/variable_sets/joint_position_variable.h>
+#include <trajopt_ifopt/constraints/cartesian_position_constraint.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/environment.h>
 
 namespace tesseract_planning
 {
+class TrajOptIfoptSolverProfile;
+
 enum class TrajOptIfoptTermType
 {
   CONSTRAINT,
@@ -60,6 +65,19 @@ struct TrajOptIfoptProblem
 
   trajopt_sqp::QPProblem::Ptr nlp;
   std::vector<trajopt_ifopt::JointPosition::ConstPtr> vars;
+
+  /** @brief The cartesian waypoint terms by step index, used to check the structure when the problem is reused */
+  std::map<int, trajopt_ifopt::CartPosConstraint::Ptr> cartesian_terms;
+
+  /**
+   * @brief The QP solver created by the solver profile the first time the problem is solved
+   * @details This is kept with the problem so the solver warm start is kept between solves, it is recreated if the
+   * problem is solved with a different solver profile
+   */
+  trajopt_sqp::QPSolver::Ptr qp_solver;
+
+  /** @brief The solver profile the QP solver was created by */
+  std::shared_ptr<const TrajOptIfoptSolverProfile> qp_solver_profile;
 };
 
 }  // namespace tesseract_planning
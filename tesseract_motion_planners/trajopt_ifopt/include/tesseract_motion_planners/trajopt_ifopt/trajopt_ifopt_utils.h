@@ -49,32 +49,35 @@ createCartesianPositionConstraint(const trajopt_ifopt::JointPosition::ConstPtr&
                                   const Eigen::Isometry3d& target_frame_offset = Eigen::Isometry3d::Identity(),
                                   const Eigen::Ref<const Eigen::VectorXd>& coeffs = Eigen::VectorXd::Ones(6));
 
-bool addCartesianPositionConstraint(trajopt_sqp::QPProblem& nlp,
-                                    const trajopt_ifopt::JointPosition::ConstPtr& var,
-                                    const tesseract_kinematics::JointGroup::ConstPtr& manip,
-                                    const std::string& source_frame,
-                                    const std::string& target_frame,
-                                    const Eigen::Isometry3d& source_frame_offset = Eigen::Isometry3d::Identity(),
-                                    const Eigen::Isometry3d& target_frame_offset = Eigen::Isometry3d::Identity(),
-                                    const Eigen::Ref<const Eigen::VectorXd>& coeffs = Eigen::VectorXd::Ones(6));
-
-bool addCartesianPositionSquaredCost(trajopt_sqp::QPProblem& nlp,
-                                     const trajopt_ifopt::JointPosition::ConstPtr& var,
-                                     const tesseract_kinematics::JointGroup::ConstPtr& manip,
-                                     const std::string& source_frame,
-                                     const std::string& target_frame,
-                                     const Eigen::Isometry3d& source_frame_offset = Eigen::Isometry3d::Identity(),
-                                     const Eigen::Isometry3d& target_frame_offset = Eigen::Isometry3d::Identity(),
-                                     const Eigen::Ref<const Eigen::VectorXd>& coeffs = Eigen::VectorXd::Ones(6));
-
-bool addCartesianPositionAbsoluteCost(trajopt_sqp::QPProblem& nlp,
-                                      const trajopt_ifopt::JointPosition::ConstPtr& var,
-                                      const tesseract_kinematics::JointGroup::ConstPtr& manip,
-                                      const std::string& source_frame,
-                                      const std::string& target_frame,
-                                      const Eigen::Isometry3d& source_frame_offset = Eigen::Isometry3d::Identity(),
-                                      const Eigen::Isometry3d& target_frame_offset = Eigen::Isometry3d::Identity(),
-                                      const Eigen::Ref<const Eigen::VectorXd>& coeffs = Eigen::VectorXd::Ones(6));
+ifopt::ConstraintSet::Ptr
+addCartesianPositionConstraint(trajopt_sqp::QPProblem& nlp,
+                               const trajopt_ifopt::JointPosition::ConstPtr& var,
+                               const tesseract_kinematics::JointGroup::ConstPtr& manip,
+                               const std::string& source_frame,
+                               const std::string& target_frame,
+                               const Eigen::Isometry3d& source_frame_offset = Eigen::Isometry3d::Identity(),
+                               const Eigen::Isometry3d& target_frame_offset = Eigen::Isometry3d::Identity(),
+                               const Eigen::Ref<const Eigen::VectorXd>& coeffs = Eigen::VectorXd::Ones(6));
+
+ifopt::ConstraintSet::Ptr
+addCartesianPositionSquaredCost(trajopt_sqp::QPProblem& nlp,
+                                const trajopt_ifopt::JointPosition::ConstPtr& var,
+                                const tesseract_kinematics::JointGroup::ConstPtr& manip,
+                                const std::string& source_frame,
+                                const std::string& target_frame,
+                                const Eigen::Isometry3d& source_frame_offset = Eigen::Isometry3d::Identity(),
+                                const Eigen::Isometry3d& target_frame_offset = Eigen::Isometry3d::Identity(),
+                                const Eigen::Ref<const Eigen::VectorXd>& coeffs = Eigen::VectorXd::Ones(6));
+
+ifopt::ConstraintSet::Ptr
+addCartesianPositionAbsoluteCost(trajopt_sqp::QPProblem& nlp,
+                                 const trajopt_ifopt::JointPosition::ConstPtr& var,
+                                 const tesseract_kinematics::JointGroup::ConstPtr& manip,
+                                 const std::string& source_frame,
+                                 const std::string& target_frame,
+                                 const Eigen::Isometry3d& source_frame_offset = Eigen::Isometry3d::Identity(),
+                                 const Eigen::Isometry3d& target_frame_offset = Eigen::Isometry3d::Identity(),
+                                 const Eigen::Ref<const Eigen::VectorXd>& coeffs = Eigen::VectorXd::Ones(6));
 
 ifopt::ConstraintSet::Ptr createJointPositionConstraint(const JointWaypointPoly& joint_waypoint,
                                                         const trajopt_ifopt::JointPosition::ConstPtr& var,
@@ -71,39 +71,42 @@ void TrajOptIfoptDefaultPlanProfile::apply(TrajOptIfoptProblem& problem,
 
   if ((is_static_working_frame && is_active_tcp_frame) || (!is_active_tcp_frame && !is_static_working_frame))
   {
+    ifopt::ConstraintSet::Ptr term;
     switch (term_type)
     {
       case TrajOptIfoptTermType::CONSTRAINT:
-        addCartesianPositionConstraint(*problem.nlp,
-                                       var,
-                                       problem.manip,
-                                       mi.tcp_frame,
-                                       mi.working_frame,
-                                       tcp_offset,
-                                       cartesian_waypoint.getTransform(),
-                                       cartesian_coeff);
+        term = addCartesianPositionConstraint(*problem.nlp,
+                                              var,
+                                              problem.manip,
+                                              mi.tcp_frame,
+                                              mi.working_frame,
+                                              tcp_offset,
+                                              cartesian_waypoint.getTransform(),
+                                              cartesian_coeff);
         break;
       case TrajOptIfoptTermType::SQUARED_COST:
-        addCartesianPositionSquaredCost(*problem.nlp,
-                                        var,
-                                        problem.manip,
-                                        mi.tcp_frame,
-                                        mi.working_frame,
-                                        tcp_offset,
-                                        cartesian_waypoint.getTransform(),
-                                        cartesian_coeff);
+        term = addCartesianPositionSquaredCost(*problem.nlp,
+                                               var,
+                                               problem.manip,
+                                               mi.tcp_frame,
+                                               mi.working_frame,
+                                               tcp_offset,
+                                               cartesian_waypoint.getTransform(),
+                                               cartesian_coeff);
         break;
       case TrajOptIfoptTermType::ABSOLUTE_COST:
-        addCartesianPositionAbsoluteCost(*problem.nlp,
-                                         var,
-                                         problem.manip,
-                                         mi.tcp_frame,
-                                         mi.working_frame,
-                                         tcp_offset,
-                                         cartesian_waypoint.getTransform(),
-                                         cartesian_coeff);
+        term = addCartesianPositionAbsoluteCost(*problem.nlp,
+                                                var,
+                                                problem.manip,
+                                                mi.tcp_frame,
+                                                mi.working_frame,
+                                                tcp_offset,
+                                                cartesian_waypoint.getTransform(),
+                                                cartesian_coeff);
         break;
     }
+
+    problem.cartesian_terms[index] = std::dynamic_pointer_cast<trajopt_ifopt::CartPosConstraint>(term);
   }
   else if (!is_static_working_frame && is_active_tcp_frame)
   {
@@ -0,0 +1,56 @@
+/**
+ * @file trajopt_ifopt_default_solver_profile.cpp
+ * @brief TrajOpt IFOPT default solver profile
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <trajopt_sqp/osqp_eigen_solver.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_solver_profile.h>
+
+namespace tesseract_planning
+{
+trajopt_sqp::QPSolver::Ptr TrajOptIfoptDefaultSolverProfile::createQPSolver() const
+{
+  auto qp_solver = std::make_shared<trajopt_sqp::OSQPEigenSolver>();
+  qp_solver->solver_.settings()->setWarmStart(qp_settings.warm_start);
+  qp_solver->solver_.settings()->setPolish(qp_settings.polish);
+  qp_solver->solver_.settings()->setAdaptiveRho(qp_settings.adaptive_rho);
+  qp_solver->solver_.settings()->setMaxIteration(qp_settings.max_iteration);
+  qp_solver->solver_.settings()->setAbsoluteTolerance(qp_settings.absolute_tolerance);
+  qp_solver->solver_.settings()->setRelativeTolerance(qp_settings.relative_tolerance);
+  return qp_solver;
+}
+
+void TrajOptIfoptDefaultSolverProfile::apply(trajopt_sqp::TrustRegionSQPSolver& solver) const
+{
+  solver.params = opt_info;
+  for (const trajopt_sqp::SQPCallback::Ptr& callback : callbacks)
+    solver.registerCallback(callback);
+}
+
+tinyxml2::XMLElement* TrajOptIfoptDefaultSolverProfile::toXML(tinyxml2::XMLDocument& /*doc*/) const { return nullptr; }
+
+}  // namespace tesseract_planning
@@ -36,10 +36,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_motion_planner.h>
 #include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_plan_profile.h>
 #include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_composite_profile.h>
+#include <tesseract_motion_planners/trajopt_ifopt/profile/trajopt_ifopt_default_solver_profile.h>
 #include <tesseract_motion_planners/core/utils.h>
 #include <tesseract_motion_planners/planner_utils.h>
 
 #include <tesseract_command_language/utils.h>
+#include <tesseract_common/utils.h>
 
 constexpr auto SOLUTION_FOUND{ "Found valid solution" };
 constexpr auto ERROR_INVALID_INPUT{ "Failed invalid input" };
@@ -78,8 +80,26 @@ PlannerResponse TrajOptIfoptMotionPlanner::solve(const PlannerRequest& request)
   if (request.data)
   {
     problem = std::static_pointer_cast<TrajOptIfoptProblem>(request.data);
+
+    // The problem in the request may be shared with other solves, so an updated copy is solved and returned
+    if (request.update_data)
+    {
+      try
+      {
+        problem = updateProblem(*problem, request);
+      }
+      catch (std::exception& e)
+      {
+        CONSOLE_BRIDGE_logDebug("TrajOptIfoptPlanner failed to update problem: %s.", e.what());
+        problem = nullptr;
+      }
+
+      if (problem == nullptr)
+        CONSOLE_BRIDGE_logDebug("TrajOptIfoptPlanner failed to update problem, creating a new problem");
+    }
   }
-  else
+
+  if (problem == nullptr)
   {
     try
     {
@@ -92,22 +112,36 @@ PlannerResponse TrajOptIfoptMotionPlanner::solve(const PlannerRequest& request)
       response.message = ERROR_INVALID_INPUT;
       return response;
     }
+  }
+  response.data = problem;
+
+  // Get the solver profile
+  TrajOptIfoptSolverProfile::ConstPtr solver_profile;
+  try
+  {
+    solver_profile = getSolverProfile(request);
+  }
+  catch (std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("TrajOptIfoptPlanner failed to get solver profile: %s.", e.what());
+    response.successful = false;
+    response.message = ERROR_INVALID_INPUT;
+    return response;
+  }
 
-    response.data = problem;
+  // Create optimizer, the QP solver is kept with the problem so it is warm started when the problem is solved again
+  // with the same solver profile. Profiles are immutable so a different solver profile may configure another solver.
+  if (problem->qp_solver == nullptr || problem->qp_solver_profile != solver_profile)
+  {
+    problem->qp_solver = solver_profile->createQPSolver();
+    problem->qp_solver_profile = solver_profile;
   }
 
-  // Create optimizer
-  /** @todo Enable solver selection (e.g. IPOPT) */
-  auto qp_solver = std::make_shared<trajopt_sqp::OSQPEigenSolver>();
-  trajopt_sqp::TrustRegionSQPSolver solver(qp_solver);
-  /** @todo Set these as the defaults in trajopt and allow setting */
-  qp_solver->solver_.settings()->setVerbosity(request.verbose);
-  qp_solver->solver_.settings()->setWarmStart(true);
-  qp_solver->solver_.settings()->setPolish(true);
-  qp_solver->solver_.settings()->setAdaptiveRho(false);
-  qp_solver->solver_.settings()->setMaxIteration(8192);
-  qp_solver->solver_.settings()->setAbsoluteTolerance(1e-4);
-  qp_solver->solver_.settings()->setRelativeTolerance(1e-6);
+  if (auto osqp_solver = std::dynamic_pointer_cast<trajopt_sqp::OSQPEigenSolver>(problem->qp_solver))
+    osqp_solver->solver_.settings()->setVerbosity(request.verbose);
+
+  trajopt_sqp::TrustRegionSQPSolver solver(problem->qp_solver);
+  solver_profile->apply(solver);
 
   // Add all callbacks
   for (const trajopt_sqp::SQPCallback::Ptr& callback : callbacks)
@@ -214,18 +248,6 @@ std::shared_ptr<TrajOptIfoptProblem> TrajOptIfoptMotionPlanner::createProblem(co
     throw std::runtime_error(error_msg);
   }
 
-  // Apply Solver parameters
-  std::string profile = request.instructions.getProfile();
-  ProfileDictionary::ConstPtr profile_overrides = request.instructions.getProfileOverrides();
-  profile = getProfileString(name_, profile, PlannerProfileRemapping());
-  //  TrajOptSolverProfile::ConstPtr solver_profile =
-  //      getProfile<TrajOptSolverProfile>(profile, solver_profiles, std::make_shared<TrajOptDefaultSolverProfile>());
-  //  solver_profile = applyProfileOverrides(name, solver_profile, profile_overrides);
-  //  if (!solver_profile)
-  //    throw std::runtime_error("TrajOptSolverConfig: Invalid profile");
-
-  //  solver_profile->apply(*pci);
-
   // Get kinematics information
   tesseract_environment::Environment::ConstPtr env = request.env;
   std::vector<std::string> active_links = problem->manip->getActiveLinkNames();
@@ -235,6 +257,11 @@ std::shared_ptr<TrajOptIfoptProblem> TrajOptIfoptMotionPlanner::createProblem(co
   // Flatten the input for planning
   auto move_instructions = request.instructions.flatten(&moveFilter);
 
+  // Resolve the plan profiles once for all move instructions
+  ProfileResolver<TrajOptIfoptPlanProfile> plan_profile_resolver(
+      name_, *request.profiles, request.plan_profile_remapping, std::make_shared<TrajOptIfoptDefaultPlanProfile>());
+  const ProfileTable<TrajOptIfoptPlanProfile> plan_profiles(move_instructions, plan_profile_resolver);
+
   // ----------------
   // Translate TCL for MoveInstructions
   // ----------------
@@ -255,10 +282,7 @@ std::shared_ptr<TrajOptIfoptProblem> TrajOptIfoptMotionPlanner::createProblem(co
       throw std::runtime_error("TrajOpt, working_frame is empty!");
 
     // Get Plan Profile
-    std::string profile = getProfileString(name_, move_instruction.getProfile(), request.plan_profile_remapping);
-    TrajOptIfoptPlanProfile::ConstPtr cur_plan_profile = getProfile<TrajOptIfoptPlanProfile>(
-        name_, profile, *request.profiles, std::make_shared<TrajOptIfoptDefaultPlanProfile>());
-    cur_plan_profile = applyProfileOverrides(name_, profile, cur_plan_profile, move_instruction.getProfileOverrides());
+    const TrajOptIfoptPlanProfile::ConstPtr& cur_plan_profile = plan_profiles[static_cast<std::size_t>(i)];
     if (!cur_plan_profile)
       throw std::runtime_error("TrajOptMotionPlanner: Invalid profile");
 
@@ -343,7 +367,8 @@ std::shared_ptr<TrajOptIfoptProblem> TrajOptIfoptMotionPlanner::createProblem(co
   // ----------------
   // Translate TCL for CompositeInstructions
   // ----------------
-  profile = getProfileString(name_, request.instructions.getProfile(), request.composite_profile_remapping);
+  std::string profile =
+      getProfileString(name_, request.instructions.getProfile(), request.composite_profile_remapping);
   TrajOptIfoptCompositeProfile::ConstPtr cur_composite_profile = getProfile<TrajOptIfoptCompositeProfile>(
       name_, profile, *request.profiles, std::make_shared<TrajOptIfoptDefaultCompositeProfile>());
   cur_composite_profile =
@@ -361,4 +386,49 @@ std::shared_ptr<TrajOptIfoptProblem> TrajOptIfoptMotionPlanner::createProblem(co
   return problem;
 }
 
+TrajOptIfoptSolverProfile::ConstPtr TrajOptIfoptMotionPlanner::getSolverProfile(const PlannerRequest& request) const
+{
+  std::string profile = getProfileString(name_, request.instructions.getProfile(), request.plan_profile_remapping);
+  TrajOptIfoptSolverProfile::ConstPtr solver_profile = getProfile<TrajOptIfoptSolverProfile>(
+      name_, profile, *request.profiles, std::make_shared<TrajOptIfoptDefaultSolverProfile>());
+  solver_profile = applyProfileOverrides(name_, profile, solver_profile, request.instructions.getProfileOverrides());
+  if (!solver_profile)
+    throw std::runtime_error("TrajOptIfoptMotionPlanner: Invalid profile");
+
+  return solver_profile;
+}
+
+std::shared_ptr<TrajOptIfoptProblem> TrajOptIfoptMotionPlanner::updateProblem(const TrajOptIfoptProblem& problem,
+                                                                             const PlannerRequest& request) const
+{
+  if (problem.environment != request.env || problem.nlp == nullptr)
+    return nullptr;
+
+  // Check the request has the same structure before anything is created
+  auto move_instructions = request.instructions.flatten(&moveFilter);
+  if (move_instructions.size() != problem.vars.size())
+    return nullptr;
+
+  for (std::size_t i = 0; i < move_instructions.size(); ++i)
+  {
+    const auto& waypoint = move_instructions[i].get().as<MoveInstructionPoly>().getWaypoint();
+    const bool is_cartesian = (problem.cartesian_terms.find(static_cast<int>(i)) != problem.cartesian_terms.end());
+    if (waypoint.isCartesianWaypoint() != is_cartesian)
+      return nullptr;
+
+    if (!waypoint.isCartesianWaypoint() && !waypoint.isJointWaypoint() && !waypoint.isStateWaypoint())
+      return nullptr;
+  }
+
+  // The ifopt problem can not be copied, so a problem is created for the new targets and seeded with the previous
+  // solution. The previous problem and its QP solver are left untouched.
+  std::shared_ptr<TrajOptIfoptProblem> updated_problem = createProblem(request);
+  const Eigen::VectorXd values = problem.nlp->getVariableValues();
+  if (updated_problem->nlp->getNumNLPVars() != values.size())
+    return nullptr;
+
+  updated_problem->nlp->setVariables(values.data());
+  return updated_problem;
+}
+
 }  // namespace tesseract_planning
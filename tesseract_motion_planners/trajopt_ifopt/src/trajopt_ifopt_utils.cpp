@@ -63,29 +63,29 @@ ifopt::ConstraintSet::Ptr createCartesianPositionConstraint(const trajopt_ifopt:
   return constraint;
 }
 
-bool addCartesianPositionConstraint(trajopt_sqp::QPProblem& nlp,
-                                    const trajopt_ifopt::JointPosition::ConstPtr& var,
-                                    const tesseract_kinematics::JointGroup::ConstPtr& manip,
-                                    const std::string& source_frame,
-                                    const std::string& target_frame,
-                                    const Eigen::Isometry3d& source_frame_offset,
-                                    const Eigen::Isometry3d& target_frame_offset,
-                                    const Eigen::Ref<const Eigen::VectorXd>& coeffs)
+ifopt::ConstraintSet::Ptr addCartesianPositionConstraint(trajopt_sqp::QPProblem& nlp,
+                                                         const trajopt_ifopt::JointPosition::ConstPtr& var,
+                                                         const tesseract_kinematics::JointGroup::ConstPtr& manip,
+                                                         const std::string& source_frame,
+                                                         const std::string& target_frame,
+                                                         const Eigen::Isometry3d& source_frame_offset,
+                                                         const Eigen::Isometry3d& target_frame_offset,
+                                                         const Eigen::Ref<const Eigen::VectorXd>& coeffs)
 {
   auto constraint = createCartesianPositionConstraint(
       var, manip, source_frame, target_frame, source_frame_offset, target_frame_offset, coeffs);
   nlp.addConstraintSet(constraint);
-  return true;
+  return constraint;
 }
 
-bool addCartesianPositionSquaredCost(trajopt_sqp::QPProblem& nlp,
-                                     const trajopt_ifopt::JointPosition::ConstPtr& var,
-                                     const tesseract_kinematics::JointGroup::ConstPtr& manip,
-                                     const std::string& source_frame,
-                                     const std::string& target_frame,
-                                     const Eigen::Isometry3d& source_frame_offset,
-                                     const Eigen::Isometry3d& target_frame_offset,
-                                     const Eigen::Ref<const Eigen::VectorXd>& coeffs)
+ifopt::ConstraintSet::Ptr addCartesianPositionSquaredCost(trajopt_sqp::QPProblem& nlp,
+                                                          const trajopt_ifopt::JointPosition::ConstPtr& var,
+                                                          const tesseract_kinematics::JointGroup::ConstPtr& manip,
+                                                          const std::string& source_frame,
+                                                          const std::string& target_frame,
+                                                          const Eigen::Isometry3d& source_frame_offset,
+                                                          const Eigen::Isometry3d& target_frame_offset,
+                                                          const Eigen::Ref<const Eigen::VectorXd>& coeffs)
 {
   std::vector<double> constraint_coeffs;
   std::vector<double> cost_coeffs;
@@ -112,17 +112,17 @@ bool addCartesianPositionSquaredCost(trajopt_sqp::QPProblem& nlp,
       Eigen::Map<Eigen::VectorXd>(constraint_coeffs.data(), static_cast<Eigen::Index>(constraint_coeffs.size())));
 
   nlp.addCostSet(constraint, trajopt_sqp::CostPenaltyType::SQUARED);
-  return true;
+  return constraint;
 }
 
-bool addCartesianPositionAbsoluteCost(trajopt_sqp::QPProblem& nlp,
-                                      const trajopt_ifopt::JointPosition::ConstPtr& var,
-                                      const tesseract_kinematics::JointGroup::ConstPtr& manip,
-                                      const std::string& source_frame,
-                                      const std::string& target_frame,
-                                      const Eigen::Isometry3d& source_frame_offset,
-                                      const Eigen::Isometry3d& target_frame_offset,
-                                      const Eigen::Ref<const Eigen::VectorXd>& coeffs)
+ifopt::ConstraintSet::Ptr addCartesianPositionAbsoluteCost(trajopt_sqp::QPProblem& nlp,
+                                                           const trajopt_ifopt::JointPosition::ConstPtr& var,
+                                                           const tesseract_kinematics::JointGroup::ConstPtr& manip,
+                                                           const std::string& source_frame,
+                                                           const std::string& target_frame,
+                                                           const Eigen::Isometry3d& source_frame_offset,
+                                                           const Eigen::Isometry3d& target_frame_offset,
+                                                           const Eigen::Ref<const Eigen::VectorXd>& coeffs)
 {
   std::vector<double> constraint_coeffs;
   std::vector<double> cost_coeffs;
@@ -149,7 +149,7 @@ bool addCartesianPositionAbsoluteCost(trajopt_sqp::QPProblem& nlp,
       Eigen::Map<Eigen::VectorXd>(constraint_coeffs.data(), static_cast<Eigen::Index>(constraint_coeffs.size())));
 
   nlp.addCostSet(constraint, trajopt_sqp::CostPenaltyType::ABSOLUTE);
-  return true;
+  return constraint;
 }
 
 ifopt::ConstraintSet::Ptr createJointPositionConstraint(const JointWaypointPoly& joint_waypoint,
@@ -48,6 +48,8 @@ public:
   explicit AbortTask(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
   ~AbortTask() override = default;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const AbortTask& rhs) const;
   bool operator!=(const AbortTask& rhs) const;
 
@@ -48,6 +48,8 @@ public:
   explicit ErrorTask(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
   ~ErrorTask() override = default;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const ErrorTask& rhs) const;
   bool operator!=(const ErrorTask& rhs) const;
 
@@ -0,0 +1,151 @@
+/**
+ * @file race_task.h
+ * @brief A task which races several branches and keeps the result of the first to succeed
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_RACE_TASK_H
+#define TESSERACT_TASK_COMPOSER_RACE_TASK_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/access.hpp>
+#include <mutex>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_task.h>
+
+namespace tesseract_planning
+{
+class TaskComposerPluginFactory;
+
+/**
+ * @brief Runs several branches concurrently on the executor and keeps the result of the first one to succeed
+ * @details Each branch runs on a child abort scope of the input, with a clone of the problem and a copy of the input
+ * keys, so aborting a branch does not affect the others while aborting the input aborts all branches. When a branch
+ * succeeds the others are aborted, they stop after the node they are currently running, and the output keys of the
+ * winner are copied to the input. The race does not wait for the aborted branches, they finish in the background and
+ * are cleaned up by the next run or the destructor.
+ *
+ * A branch succeeds if it was not aborted and returned a non zero value, so pipelines must have the error terminal
+ * first and the done terminal second. Branches which are not a task or a pipeline are run as a separate graph on the
+ * executor, blocking the thread running the branch.
+ *
+ * @code{.yaml}
+ * RaceTask:
+ *   class: RaceTaskFactory
+ *   config:
+ *     conditional: true
+ *     inputs: [input_data]
+ *     outputs: [output_data]
+ *     branches: [TrajOptPipeline, OMPLPipeline]
+ * @endcode
+ */
+class RaceTask : public TaskComposerTask
+{
+public:
+  using Ptr = std::shared_ptr<RaceTask>;
+  using ConstPtr = std::shared_ptr<const RaceTask>;
+  using UPtr = std::unique_ptr<RaceTask>;
+  using ConstUPtr = std::unique_ptr<const RaceTask>;
+
+  RaceTask();
+  explicit RaceTask(std::string name,
+                    std::vector<std::string> input_keys,
+                    std::vector<std::string> output_keys,
+                    std::vector<TaskComposerNode::Ptr> branches,
+                    bool is_conditional = true);
+  explicit RaceTask(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
+  ~RaceTask() override;
+  RaceTask(const RaceTask&) = delete;
+  RaceTask& operator=(const RaceTask&) = delete;
+  RaceTask(RaceTask&&) = delete;
+  RaceTask& operator=(RaceTask&&) = delete;
+
+  /** @brief Get the branches */
+  const std::vector<TaskComposerNode::Ptr>& getBranches() const;
+
+  TaskComposerNode::UPtr clone() const override;
+
+  bool operator==(const RaceTask& rhs) const;
+  bool operator!=(const RaceTask& rhs) const;
+
+  /** @brief The state of a single run shared with the running branches, defined in the source */
+  struct State;
+
+protected:
+  std::vector<TaskComposerNode::Ptr> branches_;
+
+  /** @brief The races with aborted branches which are still running */
+  mutable std::mutex pending_mutex_;
+  mutable std::vector<std::shared_ptr<State>> pending_;
+
+  friend struct tesseract_common::Serialization;
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+
+  TaskComposerNodeInfo::UPtr runImpl(TaskComposerInput& input,
+                                     OptionalTaskComposerExecutor executor = std::nullopt) const override final;
+};
+
+class RaceTaskInfo : public TaskComposerNodeInfo
+{
+public:
+  using Ptr = std::shared_ptr<RaceTaskInfo>;
+  using ConstPtr = std::shared_ptr<const RaceTaskInfo>;
+  using UPtr = std::unique_ptr<RaceTaskInfo>;
+  using ConstUPtr = std::unique_ptr<const RaceTaskInfo>;
+
+  RaceTaskInfo() = default;
+  RaceTaskInfo(const RaceTask& task);
+
+  TaskComposerNodeInfo::UPtr clone() const override;
+
+  bool operator==(const RaceTaskInfo& rhs) const;
+  bool operator!=(const RaceTaskInfo& rhs) const;
+
+  /** @brief The index of the branch which won, -1 if all branches failed */
+  int winner{ -1 };
+
+  /** @brief The name of the branch which won, empty if all branches failed */
+  std::string winner_name;
+
+  /**
+   * @brief The time in seconds each branch ran
+   * @details Branches which were still running when the race ended are zero
+   */
+  std::vector<double> branch_elapsed_times;
+
+private:
+  friend class boost::serialization::access;
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version);  // NOLINT
+};
+
+}  // namespace tesseract_planning
+
+#include <boost/serialization/export.hpp>
+BOOST_CLASS_EXPORT_KEY2(tesseract_planning::RaceTask, "RaceTask")
+BOOST_CLASS_EXPORT_KEY2(tesseract_planning::RaceTaskInfo, "RaceTaskInfo")
+#endif  // TESSERACT_TASK_COMPOSER_RACE_TASK_H
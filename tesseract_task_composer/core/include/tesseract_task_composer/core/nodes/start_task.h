@@ -47,6 +47,8 @@ public:
   explicit StartTask(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
   ~StartTask() override = default;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const StartTask& rhs) const;
   bool operator!=(const StartTask& rhs) const;
 
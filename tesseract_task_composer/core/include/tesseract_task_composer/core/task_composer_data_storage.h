@@ -28,16 +28,25 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <shared_mutex>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/any_poly.h>
 
 namespace tesseract_planning
 {
-/** @brief A thread save data storage */
+/**
+ * @brief A thread save data storage
+ * @details Each key is interned to an integer slot the first time it is used. Code accessing the same key several
+ * times, like tasks building a graph at runtime, can resolve the slot once using getSlot() and access the data by slot
+ * which avoids hashing and comparing the key string. Slots remain valid for the lifetime of the storage, even if the
+ * data is removed, and are preserved by copy and move.
+ */
 class TaskComposerDataStorage
 {
 public:
@@ -46,6 +55,9 @@ public:
   using UPtr = std::unique_ptr<TaskComposerDataStorage>;
   using ConstUPtr = std::unique_ptr<const TaskComposerDataStorage>;
 
+  /** @brief The handle of an interned key */
+  using Slot = std::size_t;
+
   TaskComposerDataStorage() = default;
   ~TaskComposerDataStorage() = default;
   TaskComposerDataStorage(const TaskComposerDataStorage&);
@@ -81,6 +93,47 @@ public:
    */
   void removeData(const std::string& key);
 
+  /**
+   * @brief Get the slot of the provided key, creating an empty slot if the key has not been used
+   * @param key The key to get the slot for
+   * @return The slot associated with the key
+   */
+  Slot getSlot(const std::string& key);
+
+  /**
+   * @brief Check if data exists in the provided slot
+   * @param slot The slot to check
+   * @return True if the slot has data, otherwise false
+   */
+  bool hasKey(Slot slot) const;
+
+  /**
+   * @brief Set data for the provided slot
+   * @param slot The slot to set data for
+   * @param data The data to assign to the provided slot
+   */
+  void setData(Slot slot, tesseract_common::AnyPoly data);
+
+  /**
+   * @brief Get the data for the provided slot
+   * @details If the slot does not have data it will be null
+   * @param slot The slot to retreive the data
+   * @return The data associated with the slot
+   */
+  tesseract_common::AnyPoly getData(Slot slot) const;
+
+  /**
+   * @brief Remove data for the provide slot
+   * @param slot The slot to remove data for
+   */
+  void removeData(Slot slot);
+
+  /**
+   * @brief Remove all data
+   * @details The slots remain valid and their memory is kept to be reused
+   */
+  void clear();
+
   /**
    * @brief Get all data stored
    * @return A copy of the data
@@ -95,6 +148,13 @@ public:
    */
   bool remapData(const std::map<std::string, std::string>& remapping, bool copy = false);
 
+  /**
+   * @brief Get the number of data entries copied out of or within any data storage by the calling thread
+   * @details This is a running count used to measure the data copied by a task, take the difference before and after
+   * @return The number of data entries copied by the calling thread
+   */
+  static std::size_t getThreadCopyCount();
+
   bool operator==(const TaskComposerDataStorage& rhs) const;
   bool operator!=(const TaskComposerDataStorage& rhs) const;
 
@@ -105,8 +165,26 @@ protected:
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 
+  struct Entry
+  {
+    std::string key;
+    bool has_data{ false };
+    tesseract_common::AnyPoly data;
+  };
+
   mutable std::shared_mutex mutex_;
-  std::unordered_map<std::string, tesseract_common::AnyPoly> data_;
+  std::unordered_map<std::string, Slot> slots_;
+  std::vector<Entry> data_;
+
+  /** @brief Get the slot of the key, creating it if it does not exist. The caller must hold a unique lock */
+  Slot getSlotImpl(const std::string& key);
+
+  /** @brief Get the entry of a slot, throwing if the slot does not exist. The caller must hold a lock */
+  Entry& getEntry(Slot slot);
+  const Entry& getEntry(Slot slot) const;
+
+  /** @brief Get the stored data keyed by name. The caller must hold a lock */
+  std::unordered_map<std::string, tesseract_common::AnyPoly> getDataImpl() const;
 };
 
 }  // namespace tesseract_planning
@@ -100,6 +100,8 @@ public:
 
   void renameOutputKeys(const std::map<std::string, std::string>& output_keys) override;
 
+  TaskComposerNode::UPtr clone() const override;
+
   std::string dump(std::ostream& os,
                    const TaskComposerNode* parent = nullptr,
                    const std::map<boost::uuids::uuid, TaskComposerNodeInfo::UPtr>& results_map = {}) const override;
@@ -121,6 +123,12 @@ protected:
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 
+  /**
+   * @brief Clone all nodes of this graph into the provided graph, including edges and terminals
+   * @return False if any of the nodes does not support cloning
+   */
+  bool cloneNodes(TaskComposerGraph& graph) const;
+
   std::map<boost::uuids::uuid, TaskComposerNode::Ptr> nodes_;
   std::vector<boost::uuids::uuid> terminals_;
 };
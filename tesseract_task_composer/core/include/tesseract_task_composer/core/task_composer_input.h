@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_metrics.h>
 #include <tesseract_task_composer/core/task_composer_node_info.h>
 #include <tesseract_task_composer/core/task_composer_problem.h>
 
@@ -51,6 +52,16 @@ struct TaskComposerInput
   using ConstUPtr = std::unique_ptr<const TaskComposerInput>;
 
   TaskComposerInput(TaskComposerProblem::UPtr problem);
+
+  /**
+   * @brief Create an input which is a child abort scope of the parent input
+   * @details Aborting the parent aborts the child, but aborting the child does not abort the parent or its other
+   * children. This is used to run a subgraph which may fail without discarding the work of its siblings. The dotgraph
+   * flag, priority and metrics are taken from the parent, and the parent must outlive the child.
+   * @param problem The problem of the child
+   * @param parent The parent input
+   */
+  TaskComposerInput(TaskComposerProblem::UPtr problem, const TaskComposerInput& parent);
   TaskComposerInput(const TaskComposerInput&) = delete;
   TaskComposerInput(TaskComposerInput&&) noexcept = delete;
   TaskComposerInput& operator=(const TaskComposerInput&) = delete;
@@ -72,9 +83,23 @@ struct TaskComposerInput
   /** @brief Indicate if dotgraph should be provided */
   bool dotgraph{ false };
 
+  /**
+   * @brief The scheduling priority of the input
+   * @details Executors with priority partitions run the input on the partition of the highest priority not greater
+   * than this, so interactive requests do not wait behind batch requests. Subgraphs run by the nodes of the input use
+   * the same partition. This is not reset or serialized.
+   */
+  int priority{ 0 };
+
+  /**
+   * @brief The registry the runtime statistics of each node are recorded to, if null nothing is recorded
+   * @details This is shared across inputs and is not reset or serialized
+   */
+  TaskComposerMetrics::Ptr metrics;
+
   /**
    * @brief Check if process has been aborted
-   * @details This accesses the internal process interface class
+   * @details This accesses the internal process interface class, a child scope is also aborted if its parent is
    * @return True if aborted otherwise false;
    */
   bool isAborted() const;
@@ -88,7 +113,8 @@ struct TaskComposerInput
   /**
    * @brief Abort the process input
    * @note If calling within a node you must provide the uuid
-   * @details This accesses the internal process interface class to abort the process
+   * @details This accesses the internal process interface class to abort the process, if this is a child scope the
+   * parent is not aborted
    */
   void abort(const boost::uuids::uuid& calling_node = boost::uuids::uuid());
 
@@ -99,9 +125,19 @@ struct TaskComposerInput
    */
   void abort(const TaskComposerNode& caller);
 
+  /** @brief Get the parent abort scope, nullptr if this is not a child scope */
+  const TaskComposerInput* getParent() const;
+
   /** @brief Reset abort and data storage to constructed state */
   void reset();
 
+  /**
+   * @brief Reset to the constructed state of a new problem
+   * @details The memory of the data storage and task infos is reused, see TaskComposerInputPool
+   * @param problem The new problem
+   */
+  void reset(TaskComposerProblem::UPtr problem);
+
   bool operator==(const TaskComposerInput& rhs) const;
   bool operator!=(const TaskComposerInput& rhs) const;
 
@@ -115,6 +151,9 @@ protected:
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 
   mutable std::atomic<bool> aborted_{ false };
+
+  /** @brief The parent abort scope, this is not serialized */
+  const TaskComposerInput* parent_{ nullptr };
 };
 }  // namespace tesseract_planning
 
@@ -0,0 +1,104 @@
+/**
+ * @file task_composer_input_pool.h
+ * @brief A pool of reusable task composer inputs
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TASK_COMPOSER_INPUT_POOL_H
+#define TESSERACT_TASK_COMPOSER_TASK_COMPOSER_INPUT_POOL_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <mutex>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_input.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A thread safe pool of task composer inputs
+ * @details Submitting a problem allocates an input along with the bookkeeping of its data storage and task infos. When
+ * problems are submitted at a high rate, acquiring the inputs from a pool reuses that memory instead. An acquired
+ * input is returned to the pool when its handle is destroyed, releasing the problem and data it holds.
+ * @note The pool must outlive the inputs acquired from it
+ */
+class TaskComposerInputPool
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerInputPool>;
+  using ConstPtr = std::shared_ptr<const TaskComposerInputPool>;
+  using UPtr = std::unique_ptr<TaskComposerInputPool>;
+  using ConstUPtr = std::unique_ptr<const TaskComposerInputPool>;
+
+  /** @brief Returns an input to the pool it was acquired from */
+  struct Deleter
+  {
+    TaskComposerInputPool* pool{ nullptr };
+    void operator()(TaskComposerInput* input) const;
+  };
+
+  /** @brief An input acquired from the pool */
+  using InputUPtr = std::unique_ptr<TaskComposerInput, Deleter>;
+
+  /**
+   * @brief Constructor
+   * @param max_size The maximum number of idle inputs kept, inputs released to a full pool are deleted
+   */
+  TaskComposerInputPool(std::size_t max_size = 16);
+  ~TaskComposerInputPool() = default;
+  TaskComposerInputPool(const TaskComposerInputPool&) = delete;
+  TaskComposerInputPool& operator=(const TaskComposerInputPool&) = delete;
+  TaskComposerInputPool(TaskComposerInputPool&&) = delete;
+  TaskComposerInputPool& operator=(TaskComposerInputPool&&) = delete;
+
+  /**
+   * @brief Acquire an input for the problem
+   * @details An idle input is reused if available, otherwise a new input is created
+   * @param problem The problem
+   * @return The input in the same state as a newly constructed input
+   */
+  InputUPtr acquire(TaskComposerProblem::UPtr problem);
+
+  /** @brief Get the number of idle inputs */
+  std::size_t size() const;
+
+  /** @brief Get the maximum number of idle inputs */
+  std::size_t getMaxSize() const;
+
+  /** @brief Delete all idle inputs */
+  void clear();
+
+private:
+  std::size_t max_size_;
+  mutable std::mutex mutex_;
+  std::vector<TaskComposerInput::UPtr> inputs_;
+
+  /** @brief Return an input to the pool */
+  void release(TaskComposerInput* input);
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_INPUT_POOL_H
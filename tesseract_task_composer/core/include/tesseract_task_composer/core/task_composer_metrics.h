@@ -0,0 +1,169 @@
+/**
+ * @file task_composer_metrics.h
+ * @brief A task composer runtime metrics registry
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TASK_COMPOSER_METRICS_H
+#define TESSERACT_TASK_COMPOSER_TASK_COMPOSER_METRICS_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+class TaskComposerNodeInfo;
+
+/** @brief The statistics of a node aggregated over all of its runs */
+struct TaskComposerNodeStatistics
+{
+  /** @brief The node name */
+  std::string name;
+
+  /** @brief The number of times the node ran */
+  std::size_t count{ 0 };
+
+  /** @brief The number of runs with a non zero return value */
+  std::size_t successes{ 0 };
+
+  /** @brief The number of runs skipped because the input was aborted */
+  std::size_t aborts{ 0 };
+
+  /** @brief The number of data storage entries copied by the node, including its children if it is a pipeline */
+  std::size_t data_copies{ 0 };
+
+  /** @brief The total time spent in the node in seconds */
+  double total_time{ 0 };
+
+  /** @brief The longest run in seconds */
+  double max_time{ 0 };
+
+  /**
+   * @brief The latency percentiles in seconds
+   * @details These are estimated from a histogram with four buckets per doubling of the latency, so they are within
+   * 19% of the exact value
+   */
+  double p50{ 0 };
+  double p95{ 0 };
+  double p99{ 0 };
+
+  /** @brief The mean time of a run in seconds */
+  double getMeanTime() const;
+};
+
+/**
+ * @brief A thread safe registry of the runtime statistics of task composer nodes
+ * @details Recording holds a shared lock while it updates the node entry using relaxed atomics, the exclusive lock is
+ * only taken the first time a node name is recorded and by clear().
+ */
+class TaskComposerMetrics
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerMetrics>;
+  using ConstPtr = std::shared_ptr<const TaskComposerMetrics>;
+  using UPtr = std::unique_ptr<TaskComposerMetrics>;
+  using ConstUPtr = std::unique_ptr<const TaskComposerMetrics>;
+
+  /** @brief The number of latency histogram buckets, covering one microsecond to about 2 minutes */
+  static constexpr std::size_t HISTOGRAM_SIZE = 110;
+
+  TaskComposerMetrics() = default;
+  ~TaskComposerMetrics() = default;
+  TaskComposerMetrics(const TaskComposerMetrics&) = delete;
+  TaskComposerMetrics& operator=(const TaskComposerMetrics&) = delete;
+  TaskComposerMetrics(TaskComposerMetrics&&) = delete;
+  TaskComposerMetrics& operator=(TaskComposerMetrics&&) = delete;
+
+  /**
+   * @brief Record a run of a node
+   * @param info The info of the node run
+   * @param data_copies The number of data storage entries copied during the run
+   */
+  void record(const TaskComposerNodeInfo& info, std::size_t data_copies = 0);
+
+  /**
+   * @brief Get the statistics of a node
+   * @param name The node name
+   * @return The statistics, if the node has not been recorded the count is zero
+   */
+  TaskComposerNodeStatistics getStatistics(const std::string& name) const;
+
+  /**
+   * @brief Get the statistics of all recorded nodes
+   * @return The statistics sorted by node name
+   */
+  std::vector<TaskComposerNodeStatistics> getStatistics() const;
+
+  /** @brief Remove all recorded statistics */
+  void clear();
+
+  /**
+   * @brief Write a table of the statistics of all recorded nodes
+   * @param os The output stream
+   */
+  void dump(std::ostream& os) const;
+
+  /**
+   * @brief Write the statistics of all recorded nodes as JSON
+   * @param os The output stream
+   */
+  void dumpJSON(std::ostream& os) const;
+
+private:
+  struct Entry
+  {
+    std::atomic<std::size_t> count{ 0 };
+    std::atomic<std::size_t> successes{ 0 };
+    std::atomic<std::size_t> aborts{ 0 };
+    std::atomic<std::size_t> data_copies{ 0 };
+    std::atomic<std::uint64_t> total_time_ns{ 0 };
+    std::atomic<std::uint64_t> max_time_ns{ 0 };
+    std::array<std::atomic<std::size_t>, HISTOGRAM_SIZE> histogram{};
+  };
+
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<Entry>> entries_;
+
+  /**
+   * @brief Get the entry for the name, creating it if it does not exist
+   * @param name The node name
+   * @param lock The shared lock held by the caller, the entry is valid while it is held
+   */
+  Entry& getEntry(const std::string& name, std::shared_lock<std::shared_mutex>& lock);
+
+  /** @brief Compute the statistics of an entry */
+  static TaskComposerNodeStatistics getStatistics(const std::string& name, const Entry& entry);
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_METRICS_H
@@ -127,6 +127,14 @@ public:
                            const TaskComposerNode* parent = nullptr,
                            const std::map<boost::uuids::uuid, TaskComposerNodeInfo::UPtr>& results_map = {}) const;
 
+  /**
+   * @brief Create a copy of this node with a new uuid
+   * @details The copy has the same name, keys and configuration but is not part of a graph. This allows creating many
+   * instances of the same node (i.e. a segment pipeline per raster) without reconstructing it from its config.
+   * @return The copy of the node, or nullptr if the node does not support cloning
+   */
+  virtual TaskComposerNode::UPtr clone() const;
+
   bool operator==(const TaskComposerNode& rhs) const;
   bool operator!=(const TaskComposerNode& rhs) const;
 
@@ -174,6 +182,21 @@ protected:
 
   /** @brief This will create a UUID string with no hyphens used when creating dot graph */
   static std::string toString(const boost::uuids::uuid& u, const std::string& prefix = "");
+
+  /** @brief Copy the name, type, keys and conditional flag of this node to the provided node, excluding the uuid */
+  void copyNodeData(TaskComposerNode& node) const;
+
+  /**
+   * @brief Create a default constructed NodeType which has the node data of this node
+   * @details This is used to implement clone(), the caller is responsible for copying any data specific to NodeType
+   */
+  template <typename NodeType>
+  std::unique_ptr<NodeType> cloneAs() const
+  {
+    auto node = std::make_unique<NodeType>();
+    copyNodeData(*node);
+    return node;
+  }
 };
 
 }  // namespace tesseract_planning
@@ -31,6 +31,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 #include <shared_mutex>
 #include <map>
+#include <ostream>
+#include <vector>
 #include <boost/uuid/uuid.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -96,6 +98,19 @@ public:
    */
   double elapsed_time{ 0 };
 
+  /**
+   * @brief The time the node started in seconds since the steady clock epoch
+   * @details This is managed by core components so implementation do not need to calculate this. For graphs this is
+   * the time the graph was submitted to the executor.
+   */
+  double start_time{ 0 };
+
+  /**
+   * @brief The hash of the id of the thread the node ran on
+   * @details This is managed by core components so implementation do not need to calculate this
+   */
+  std::size_t thread_id{ 0 };
+
   /** @brief The DOT Graph color to fill with */
   std::string color{ "red" };
 
@@ -176,9 +191,22 @@ struct TaskComposerNodeInfoContainer
    */
   boost::uuids::uuid getAbortingNode() const;
 
-  /** @brief Clear the contents */
+  /**
+   * @brief Clear the contents
+   * @details The map nodes are kept and reused by addInfo, so a container which is cleared and refilled with a
+   * similar number of infos, like one owned by a recycled input, does not allocate them again
+   */
   void clear();
 
+  /**
+   * @brief Write the timeline of the nodes in the Chrome trace event format
+   * @details The file can be loaded in chrome://tracing or https://ui.perfetto.dev. Each node is a complete event on
+   * the thread it ran on, and the time between a node becoming ready (its inbound nodes finished, or for the first
+   * node its parent started) and starting is reported as queue_wait.
+   * @param os The output stream
+   */
+  void dumpChromeTrace(std::ostream& os) const;
+
   bool operator==(const TaskComposerNodeInfoContainer& rhs) const;
   bool operator!=(const TaskComposerNodeInfoContainer& rhs) const;
 
@@ -192,13 +220,18 @@ private:
   boost::uuids::uuid aborting_node_{};
   std::map<boost::uuids::uuid, TaskComposerNodeInfo::UPtr> info_map_;
 
+  /** @brief The map nodes released by clear which are reused by addInfo */
+  std::vector<std::map<boost::uuids::uuid, TaskComposerNodeInfo::UPtr>::node_type> free_nodes_;
+
   void updateParents(std::map<boost::uuids::uuid, TaskComposerNodeInfo::UPtr>& info_map,
                      const boost::uuids::uuid& uuid) const;
 };
 }  // namespace tesseract_planning
 
 #include <boost/serialization/export.hpp>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY2(tesseract_planning::TaskComposerNodeInfo, "TaskComposerNodeInfo")
+BOOST_CLASS_VERSION(tesseract_planning::TaskComposerNodeInfo, 1)
 BOOST_CLASS_EXPORT_KEY2(tesseract_planning::TaskComposerNodeInfoContainer, "TaskComposerNodeInfoContainer")
 
 #endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_NODE_INFO_H
@@ -30,6 +30,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <string>
 #include <map>
+#include <shared_mutex>
 #include <yaml-cpp/yaml.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -90,10 +91,10 @@ class TaskComposerPluginFactory
 public:
   TaskComposerPluginFactory();
   ~TaskComposerPluginFactory();
-  TaskComposerPluginFactory(const TaskComposerPluginFactory&) = default;
-  TaskComposerPluginFactory& operator=(const TaskComposerPluginFactory&) = default;
-  TaskComposerPluginFactory(TaskComposerPluginFactory&&) = default;
-  TaskComposerPluginFactory& operator=(TaskComposerPluginFactory&&) = default;
+  TaskComposerPluginFactory(const TaskComposerPluginFactory&);
+  TaskComposerPluginFactory& operator=(const TaskComposerPluginFactory&);
+  TaskComposerPluginFactory(TaskComposerPluginFactory&&) noexcept;
+  TaskComposerPluginFactory& operator=(TaskComposerPluginFactory&&) noexcept;
 
   /**
    * @brief Load plugins from yaml node
@@ -115,6 +116,7 @@ public:
 
   /**
    * @brief Load plugins from yaml node
+   * @details This also preloads the factories of all executors and nodes referenced by the config
    * @param config The config node
    */
   void loadConfig(const YAML::Node& config);
@@ -271,6 +273,20 @@ public:
   TaskComposerNode::UPtr createTaskComposerNode(const std::string& name,
                                                 const tesseract_common::PluginInfo& plugin_info) const;
 
+  /**
+   * @brief Load the factories of all executor and node plugins, including nodes defined inline within graphs
+   * @details This is called by loadConfig so plugin libraries are not loaded while creating nodes, which may happen
+   * on worker threads during execution. Factories for plugins added later are loaded on first use.
+   * @return True if all factories were loaded, otherwise false
+   */
+  bool preloadFactories();
+
+  /**
+   * @brief Get the time spent in the last call to preloadFactories
+   * @return The time in seconds
+   */
+  double getPreloadTime() const;
+
   /**
    * @brief Save the plugin information to a yaml config file
    * @param file_path The file path
@@ -286,9 +302,26 @@ public:
 private:
   mutable std::map<std::string, TaskComposerExecutorFactory::Ptr> executor_factories_;
   mutable std::map<std::string, TaskComposerNodeFactory::Ptr> node_factories_;
+
+  /** @brief Protects the factory caches which may be populated while creating nodes from multiple threads */
+  mutable std::shared_mutex factories_mutex_;
+
   tesseract_common::PluginInfoContainer executor_plugin_info_;
   tesseract_common::PluginInfoContainer task_plugin_info_;
   tesseract_common::PluginLoader plugin_loader_;
+  double preload_time_{ 0 };
+
+  /**
+   * @brief Get the executor factory for the class name, loading it if it is not in the cache
+   * @return The factory, or nullptr if it could not be loaded
+   */
+  TaskComposerExecutorFactory::Ptr getTaskComposerExecutorFactory(const std::string& class_name) const;
+
+  /**
+   * @brief Get the node factory for the class name, loading it if it is not in the cache
+   * @return The factory, or nullptr if it could not be loaded
+   */
+  TaskComposerNodeFactory::Ptr getTaskComposerNodeFactory(const std::string& class_name) const;
 };
 }  // namespace tesseract_planning
 #endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_FACTORY_H
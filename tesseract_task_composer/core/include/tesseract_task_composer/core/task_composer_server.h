@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_metrics.h>
 #include <tesseract_task_composer/core/task_composer_node.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 
@@ -116,6 +117,7 @@ public:
 
   /**
    * @brief Execute the provided task graph
+   * @details If the task input does not have a metrics registry the servers registry is assigned
    * @param task_input The task input provided to every task
    * @param name The name of the executor to use
    * @return The future associated with execution
@@ -137,10 +139,17 @@ public:
   /** @brief Queries the number of running tasks at the time of this call */
   long getTaskCount(const std::string& name) const;
 
+  /**
+   * @brief Get the runtime statistics of the nodes run by the server
+   * @return The metrics registry shared by all inputs run by the server
+   */
+  TaskComposerMetrics::Ptr getMetrics() const;
+
 protected:
   TaskComposerPluginFactory plugin_factory_;
   std::unordered_map<std::string, TaskComposerExecutor::Ptr> executors_;
   std::unordered_map<std::string, TaskComposerNode::UPtr> tasks_;
+  TaskComposerMetrics::Ptr metrics_{ std::make_shared<TaskComposerMetrics>() };
 
   void loadPlugins();
 };
@@ -51,6 +51,8 @@ public:
   bool set_abort{ false };
   int return_value{ 0 };
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const TestTask& rhs) const;
   bool operator!=(const TestTask& rhs) const;
 
@@ -50,6 +50,8 @@ TaskComposerNodeInfo::UPtr AbortTask::runImpl(TaskComposerInput& input, Optional
   return info;
 }
 
+TaskComposerNode::UPtr AbortTask::clone() const { return cloneAs<AbortTask>(); }
+
 bool AbortTask::operator==(const AbortTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool AbortTask::operator!=(const AbortTask& rhs) const { return !operator==(rhs); }
 
@@ -51,6 +51,8 @@ TaskComposerNodeInfo::UPtr DoneTask::runImpl(TaskComposerInput& /*input*/,
   return info;
 }
 
+TaskComposerNode::UPtr DoneTask::clone() const { return cloneAs<DoneTask>(); }
+
 bool DoneTask::operator==(const DoneTask& rhs) const { return TaskComposerTask::operator==(rhs); }
 bool DoneTask::operator!=(const DoneTask& rhs) const { return !operator==(rhs); }
 
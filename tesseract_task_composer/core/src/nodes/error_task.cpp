@@ -51,6 +51,8 @@ TaskComposerNodeInfo::UPtr ErrorTask::runImpl(TaskComposerInput& /*input*/,
   return info;
 }
 
+TaskComposerNode::UPtr ErrorTask::clone() const { return cloneAs<ErrorTask>(); }
+
 bool ErrorTask::operator==(const ErrorTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool ErrorTask::operator!=(const ErrorTask& rhs) const { return !operator==(rhs); }
 
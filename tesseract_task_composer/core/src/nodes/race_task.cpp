@@ -0,0 +1,334 @@
+/**
+ * @file race_task.cpp
+ * @brief A task which races several branches and keeps the result of the first to succeed
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <yaml-cpp/yaml.h>
+#include <boost/serialization/shared_ptr.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <optional>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/timer.h>
+#include <tesseract_task_composer/core/nodes/race_task.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_input.h>
+#include <tesseract_task_composer/core/task_composer_pipeline.h>
+#include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+
+namespace tesseract_planning
+{
+/** @brief The state of a single run of the race, shared with the branches */
+struct RaceTask::State
+{
+  explicit State(std::size_t num_branches) : elapsed_times(num_branches, 0) {}
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::size_t finished{ 0 };
+  std::optional<std::size_t> winner;
+  std::vector<double> elapsed_times;
+
+  /** @brief The branch inputs, runners and futures must outlive the branches */
+  std::vector<TaskComposerInput::UPtr> inputs;
+  std::vector<TaskComposerNode::UPtr> runners;
+  std::vector<TaskComposerFuture::UPtr> futures;
+
+  /** @brief Record that a branch finished, the first successful branch wins */
+  void finish(std::size_t index, bool success, double elapsed_time)
+  {
+    {
+      std::scoped_lock lock(mutex);
+      ++finished;
+      elapsed_times[index] = elapsed_time;
+      if (success && !winner.has_value())
+        winner = index;
+    }
+    cv.notify_all();
+  }
+
+  /** @brief Check if all branches have finished */
+  bool done()
+  {
+    return std::all_of(futures.begin(), futures.end(), [](const TaskComposerFuture::UPtr& f) { return f->ready(); });
+  }
+};
+
+namespace
+{
+/** @brief Runs a branch on its own input and reports the outcome to the race */
+class RaceBranchTask : public TaskComposerTask
+{
+public:
+  RaceBranchTask(std::string name, const TaskComposerNode& branch, std::size_t index, RaceTask::State& state)
+    : TaskComposerTask(std::move(name), false), branch_(branch), index_(index), state_(state)
+  {
+  }
+
+protected:
+  TaskComposerNodeInfo::UPtr runImpl(TaskComposerInput& input,
+                                     OptionalTaskComposerExecutor executor) const override final
+  {
+    tesseract_common::Timer timer;
+    timer.start();
+    if (const auto* pipeline = dynamic_cast<const TaskComposerPipeline*>(&branch_))
+      pipeline->run(input, executor);
+    else if (const auto* task = dynamic_cast<const TaskComposerTask*>(&branch_))
+      task->run(input, executor);
+    else
+      executor.value().get().run(branch_, input)->wait();
+    timer.stop();
+
+    auto branch_info = input.task_infos.getInfo(branch_.getUUID());
+    const bool success = (branch_info != nullptr && branch_info->return_value != 0 && !input.isAborted());
+    state_.finish(index_, success, timer.elapsedSeconds());
+
+    auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+    info->color = success ? "green" : "red";
+    info->message = success ? "Successful" : "Failed";
+    info->return_value = success ? 1 : 0;
+    return info;
+  }
+
+private:
+  const TaskComposerNode& branch_;
+  std::size_t index_;
+  RaceTask::State& state_;
+};
+}  // namespace
+
+RaceTask::RaceTask() : TaskComposerTask("RaceTask", true) {}
+RaceTask::RaceTask(std::string name,
+                   std::vector<std::string> input_keys,
+                   std::vector<std::string> output_keys,
+                   std::vector<TaskComposerNode::Ptr> branches,
+                   bool is_conditional)
+  : TaskComposerTask(std::move(name), is_conditional), branches_(std::move(branches))
+{
+  input_keys_ = std::move(input_keys);
+  output_keys_ = std::move(output_keys);
+
+  if (branches_.empty())
+    throw std::runtime_error("RaceTask, branches should not be empty!");
+}
+RaceTask::RaceTask(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory)
+  : TaskComposerTask(std::move(name), config)
+{
+  if (input_keys_.empty())
+    throw std::runtime_error("RaceTask, config missing 'inputs' entry");
+
+  if (output_keys_.empty())
+    throw std::runtime_error("RaceTask, config missing 'outputs' entry");
+
+  if (YAML::Node n = config["branches"])
+  {
+    for (const auto& branch_name : n.as<std::vector<std::string>>())
+    {
+      TaskComposerNode::Ptr branch = plugin_factory.createTaskComposerNode(branch_name);
+      if (branch == nullptr)
+        throw std::runtime_error("RaceTask, failed to create branch '" + branch_name + "'");
+
+      branches_.push_back(branch);
+    }
+  }
+  else
+  {
+    throw std::runtime_error("RaceTask missing config key: 'branches'");
+  }
+
+  if (branches_.empty())
+    throw std::runtime_error("RaceTask, branches should not be empty!");
+}
+
+RaceTask::~RaceTask()
+{
+  std::scoped_lock lock(pending_mutex_);
+  for (const auto& state : pending_)
+  {
+    for (const auto& future : state->futures)
+      future->wait();
+  }
+}
+
+const std::vector<TaskComposerNode::Ptr>& RaceTask::getBranches() const { return branches_; }
+
+TaskComposerNode::UPtr RaceTask::clone() const
+{
+  auto task = cloneAs<RaceTask>();
+  task->branches_ = branches_;
+  return task;
+}
+
+bool RaceTask::operator==(const RaceTask& rhs) const
+{
+  bool equal = true;
+  equal &= (branches_.size() == rhs.branches_.size());
+  if (equal)
+  {
+    for (std::size_t i = 0; i < branches_.size(); ++i)
+      equal &= (branches_[i]->getName() == rhs.branches_[i]->getName());
+  }
+  equal &= TaskComposerNode::operator==(rhs);
+  return equal;
+}
+bool RaceTask::operator!=(const RaceTask& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void RaceTask::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerTask);
+  ar& boost::serialization::make_nvp("branches", branches_);
+}
+
+TaskComposerNodeInfo::UPtr RaceTask::runImpl(TaskComposerInput& input, OptionalTaskComposerExecutor executor) const
+{
+  auto info = std::make_unique<RaceTaskInfo>(*this);
+  info->return_value = 0;
+  info->color = "red";
+
+  if (!executor.has_value())
+  {
+    info->message = "RaceTask, requires an executor to run the branches";
+    CONSOLE_BRIDGE_logError("%s", info->message.c_str());
+    return info;
+  }
+
+  // Release the races whose aborted branches have finished
+  {
+    std::scoped_lock lock(pending_mutex_);
+    pending_.erase(std::remove_if(pending_.begin(), pending_.end(), [](const auto& s) { return s->done(); }),
+                   pending_.end());
+  }
+
+  // Each branch runs in its own abort scope so it can be aborted without aborting the input or the other branches
+  auto state = std::make_shared<State>(branches_.size());
+  for (std::size_t i = 0; i < branches_.size(); ++i)
+  {
+    TaskComposerProblem::UPtr problem = input.problem->clone();
+    problem->input_data.clear();
+
+    auto branch_input = std::make_unique<TaskComposerInput>(std::move(problem), input);
+    for (const auto& key : input_keys_)
+    {
+      tesseract_common::AnyPoly data = input.data_storage.getData(key);
+      if (!data.isNull())
+        branch_input->data_storage.setData(key, std::move(data));
+    }
+
+    std::string runner_name = name_ + ": " + branches_[i]->getName();
+    state->runners.push_back(std::make_unique<RaceBranchTask>(std::move(runner_name), *branches_[i], i, *state));
+    state->inputs.push_back(std::move(branch_input));
+  }
+
+  for (std::size_t i = 0; i < branches_.size(); ++i)
+    state->futures.push_back(executor.value().get().run(*state->runners[i], *state->inputs[i]));
+
+  // Wait for the first branch to succeed or all branches to fail
+  {
+    std::unique_lock lock(state->mutex);
+    state->cv.wait(lock, [&state] { return state->winner.has_value() || state->finished == state->futures.size(); });
+    info->branch_elapsed_times = state->elapsed_times;
+  }
+
+  // The aborted branches check their own scope first, so they no longer access the input which may be destroyed
+  // before they finish
+  for (std::size_t i = 0; i < branches_.size(); ++i)
+  {
+    if (!state->winner.has_value() || i != state->winner.value())
+      state->inputs[i]->abort();
+  }
+
+  if (!state->done())
+  {
+    std::scoped_lock lock(pending_mutex_);
+    pending_.push_back(state);
+  }
+
+  if (!state->winner.has_value())
+  {
+    info->message = "RaceTask, all branches failed";
+    CONSOLE_BRIDGE_logError("%s", info->message.c_str());
+    return info;
+  }
+
+  const std::size_t winner = state->winner.value();
+  TaskComposerInput& winner_input = *state->inputs[winner];
+  for (const auto& key : output_keys_)
+  {
+    tesseract_common::AnyPoly data = winner_input.data_storage.getData(key);
+    if (!data.isNull())
+      input.data_storage.setData(key, std::move(data));
+  }
+
+  // Keep the infos of the winning branch so they show up in the dot graph
+  for (auto& pair : winner_input.task_infos.getInfoMap())
+    input.task_infos.addInfo(std::move(pair.second));
+
+  info->winner = static_cast<int>(winner);
+  info->winner_name = branches_[winner]->getName();
+  info->color = "green";
+  info->message = "Successful, winner: " + info->winner_name;
+  info->return_value = 1;
+  CONSOLE_BRIDGE_logDebug("%s", info->message.c_str());
+  return info;
+}
+
+RaceTaskInfo::RaceTaskInfo(const RaceTask& task) : TaskComposerNodeInfo(task) {}
+
+TaskComposerNodeInfo::UPtr RaceTaskInfo::clone() const { return std::make_unique<RaceTaskInfo>(*this); }
+
+bool RaceTaskInfo::operator==(const RaceTaskInfo& rhs) const
+{
+  bool equal = true;
+  equal &= TaskComposerNodeInfo::operator==(rhs);
+  equal &= (winner == rhs.winner);
+  equal &= (winner_name == rhs.winner_name);
+  equal &= (branch_elapsed_times == rhs.branch_elapsed_times);
+  return equal;
+}
+bool RaceTaskInfo::operator!=(const RaceTaskInfo& rhs) const { return !operator==(rhs); }
+
+template <class Archive>
+void RaceTaskInfo::serialize(Archive& ar, const unsigned int /*version*/)
+{
+  ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerNodeInfo);
+  ar& BOOST_SERIALIZATION_NVP(winner);
+  ar& BOOST_SERIALIZATION_NVP(winner_name);
+  ar& BOOST_SERIALIZATION_NVP(branch_elapsed_times);
+}
+
+}  // namespace tesseract_planning
+
+#include <tesseract_common/serialization.h>
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::RaceTask)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_planning::RaceTask)
+TESSERACT_SERIALIZE_ARCHIVES_INSTANTIATE(tesseract_planning::RaceTaskInfo)
+BOOST_CLASS_EXPORT_IMPLEMENT(tesseract_planning::RaceTaskInfo)
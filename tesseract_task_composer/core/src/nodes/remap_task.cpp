@@ -76,6 +76,14 @@ TaskComposerNodeInfo::UPtr RemapTask::runImpl(TaskComposerInput& input, Optional
   return info;
 }
 
+TaskComposerNode::UPtr RemapTask::clone() const
+{
+  auto task = cloneAs<RemapTask>();
+  task->remap_ = remap_;
+  task->copy_ = copy_;
+  return task;
+}
+
 bool RemapTask::operator==(const RemapTask& rhs) const
 {
   bool equal = true;
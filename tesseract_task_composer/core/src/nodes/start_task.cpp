@@ -56,6 +56,8 @@ TaskComposerNodeInfo::UPtr StartTask::runImpl(TaskComposerInput& /*input*/,
   return info;
 }
 
+TaskComposerNode::UPtr StartTask::clone() const { return cloneAs<StartTask>(); }
+
 bool StartTask::operator==(const StartTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool StartTask::operator!=(const StartTask& rhs) const { return !operator==(rhs); }
 
@@ -32,12 +32,19 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #endif
 #include <boost/serialization/unordered_map.hpp>
 #include <mutex>
+#include <stdexcept>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_data_storage.h>
 namespace tesseract_planning
 {
+namespace
+{
+/** @brief The number of data entries copied by the thread */
+thread_local std::size_t thread_copy_count{ 0 };  // NOLINT
+}  // namespace
+
 TaskComposerDataStorage::TaskComposerDataStorage(const TaskComposerDataStorage& other) { *this = other; }
 TaskComposerDataStorage& TaskComposerDataStorage::operator=(const TaskComposerDataStorage& other)
 {
@@ -45,6 +52,7 @@ TaskComposerDataStorage& TaskComposerDataStorage::operator=(const TaskComposerDa
   std::shared_lock rhs_lock(other.mutex_, std::defer_lock);
   std::scoped_lock lock{ lhs_lock, rhs_lock };
 
+  slots_ = other.slots_;
   data_ = other.data_;
   return *this;
 }
@@ -54,6 +62,7 @@ TaskComposerDataStorage::TaskComposerDataStorage(TaskComposerDataStorage&& other
   std::shared_lock rhs_lock(other.mutex_, std::defer_lock);
   std::scoped_lock lock{ lhs_lock, rhs_lock };
 
+  slots_ = std::move(other.slots_);
   data_ = std::move(other.data_);
 }
 TaskComposerDataStorage& TaskComposerDataStorage::operator=(TaskComposerDataStorage&& other) noexcept
@@ -62,6 +71,7 @@ TaskComposerDataStorage& TaskComposerDataStorage::operator=(TaskComposerDataStor
   std::shared_lock rhs_lock(other.mutex_, std::defer_lock);
   std::scoped_lock lock{ lhs_lock, rhs_lock };
 
+  slots_ = std::move(other.slots_);
   data_ = std::move(other.data_);
   return *this;
 }
@@ -69,79 +79,146 @@ TaskComposerDataStorage& TaskComposerDataStorage::operator=(TaskComposerDataStor
 bool TaskComposerDataStorage::hasKey(const std::string& key)
 {
   std::shared_lock lock(mutex_);
-  return (data_.find(key) != data_.end());
+  auto it = slots_.find(key);
+  return (it != slots_.end() && data_[it->second].has_data);
 }
 
 void TaskComposerDataStorage::setData(const std::string& key, tesseract_common::AnyPoly data)
 {
   std::unique_lock lock(mutex_);
-  data_[key] = std::move(data);
+  Entry& entry = data_[getSlotImpl(key)];
+  entry.data = std::move(data);
+  entry.has_data = true;
 }
 
 tesseract_common::AnyPoly TaskComposerDataStorage::getData(const std::string& key) const
 {
   std::shared_lock lock(mutex_);
-  auto it = data_.find(key);
-  if (it == data_.end())
+  auto it = slots_.find(key);
+  if (it == slots_.end() || !data_[it->second].has_data)
     return {};
 
-  return it->second;
+  ++thread_copy_count;
+  return data_[it->second].data;
 }
 
 void TaskComposerDataStorage::removeData(const std::string& key)
 {
   std::unique_lock lock(mutex_);
-  data_.erase(key);
+  auto it = slots_.find(key);
+  if (it == slots_.end())
+    return;
+
+  Entry& entry = data_[it->second];
+  entry.data = tesseract_common::AnyPoly();
+  entry.has_data = false;
+}
+
+TaskComposerDataStorage::Slot TaskComposerDataStorage::getSlot(const std::string& key)
+{
+  {
+    std::shared_lock lock(mutex_);
+    auto it = slots_.find(key);
+    if (it != slots_.end())
+      return it->second;
+  }
+
+  std::unique_lock lock(mutex_);
+  return getSlotImpl(key);
+}
+
+bool TaskComposerDataStorage::hasKey(Slot slot) const
+{
+  std::shared_lock lock(mutex_);
+  return getEntry(slot).has_data;
+}
+
+void TaskComposerDataStorage::setData(Slot slot, tesseract_common::AnyPoly data)
+{
+  std::unique_lock lock(mutex_);
+  Entry& entry = getEntry(slot);
+  entry.data = std::move(data);
+  entry.has_data = true;
+}
+
+tesseract_common::AnyPoly TaskComposerDataStorage::getData(Slot slot) const
+{
+  std::shared_lock lock(mutex_);
+  const Entry& entry = getEntry(slot);
+  if (!entry.has_data)
+    return {};
+
+  ++thread_copy_count;
+  return entry.data;
+}
+
+void TaskComposerDataStorage::removeData(Slot slot)
+{
+  std::unique_lock lock(mutex_);
+  Entry& entry = getEntry(slot);
+  entry.data = tesseract_common::AnyPoly();
+  entry.has_data = false;
+}
+
+void TaskComposerDataStorage::clear()
+{
+  std::unique_lock lock(mutex_);
+  for (auto& entry : data_)
+  {
+    entry.data = tesseract_common::AnyPoly();
+    entry.has_data = false;
+  }
 }
 
 std::unordered_map<std::string, tesseract_common::AnyPoly> TaskComposerDataStorage::getData() const
 {
   std::shared_lock lock(mutex_);
-  return data_;
+  auto data = getDataImpl();
+  thread_copy_count += data.size();
+  return data;
 }
 
 bool TaskComposerDataStorage::remapData(const std::map<std::string, std::string>& remapping, bool copy)
 {
   std::unique_lock lock(mutex_);
 
-  if (copy)
+  for (const auto& pair : remapping)
   {
-    for (const auto& pair : remapping)
+    auto it = slots_.find(pair.first);
+    if (it == slots_.end() || !data_[it->second].has_data)
     {
-      auto it = data_.find(pair.first);
-      if (it != data_.end())
-      {
-        data_[pair.second] = it->second;
-      }
-      else
-      {
-        CONSOLE_BRIDGE_logError(
-            "TaskComposerDataStorage, unable to remap data '%s' to '%s'", pair.first.c_str(), pair.second.c_str());
-        return false;
-      }
+      CONSOLE_BRIDGE_logError(
+          "TaskComposerDataStorage, unable to remap data '%s' to '%s'", pair.first.c_str(), pair.second.c_str());
+      return false;
     }
-  }
-  else
-  {
-    for (const auto& pair : remapping)
+
+    // Get the slots before accessing the entries because creating a slot may reallocate the entries
+    const Slot from_slot = it->second;
+    const Slot to_slot = getSlotImpl(pair.second);
+    if (from_slot == to_slot)
+      continue;
+
+    Entry& from = data_[from_slot];
+    Entry& to = data_[to_slot];
+    if (copy)
+    {
+      to.data = from.data;
+      ++thread_copy_count;
+    }
+    else
     {
-      if (auto nh = data_.extract(pair.first); !nh.empty())
-      {
-        nh.key() = pair.second;
-        data_.insert(std::move(nh));
-      }
-      else
-      {
-        CONSOLE_BRIDGE_logError(
-            "TaskComposerDataStorage, unable to remap data '%s' to '%s'", pair.first.c_str(), pair.second.c_str());
-        return false;
-      }
+      to.data = std::move(from.data);
+      from.data = tesseract_common::AnyPoly();
+      from.has_data = false;
     }
+    to.has_data = true;
   }
 
   return true;
 }
 
+std::size_t TaskComposerDataStorage::getThreadCopyCount() { return thread_copy_count; }
+
 bool TaskComposerDataStorage::operator==(const TaskComposerDataStorage& rhs) const
 {
   std::shared_lock lhs_lock(mutex_, std::defer_lock);
@@ -149,17 +226,71 @@ bool TaskComposerDataStorage::operator==(const TaskComposerDataStorage& rhs) con
   std::scoped_lock lock{ lhs_lock, rhs_lock };
 
   bool equal = true;
-  equal &= data_ == rhs.data_;
+  equal &= getDataImpl() == rhs.getDataImpl();
   return equal;
 }
 
 bool TaskComposerDataStorage::operator!=(const TaskComposerDataStorage& rhs) const { return !operator==(rhs); }
 
+TaskComposerDataStorage::Slot TaskComposerDataStorage::getSlotImpl(const std::string& key)
+{
+  auto it = slots_.find(key);
+  if (it != slots_.end())
+    return it->second;
+
+  const Slot slot = data_.size();
+  data_.push_back(Entry{ key, false, tesseract_common::AnyPoly() });
+  slots_[key] = slot;
+  return slot;
+}
+
+TaskComposerDataStorage::Entry& TaskComposerDataStorage::getEntry(Slot slot)
+{
+  if (slot >= data_.size())
+    throw std::runtime_error("TaskComposerDataStorage, invalid slot: " + std::to_string(slot));
+
+  return data_[slot];
+}
+
+const TaskComposerDataStorage::Entry& TaskComposerDataStorage::getEntry(Slot slot) const
+{
+  if (slot >= data_.size())
+    throw std::runtime_error("TaskComposerDataStorage, invalid slot: " + std::to_string(slot));
+
+  return data_[slot];
+}
+
+std::unordered_map<std::string, tesseract_common::AnyPoly> TaskComposerDataStorage::getDataImpl() const
+{
+  std::unordered_map<std::string, tesseract_common::AnyPoly> data;
+  data.reserve(data_.size());
+  for (const auto& entry : data_)
+  {
+    if (entry.has_data)
+      data[entry.key] = entry.data;
+  }
+  return data;
+}
+
 template <class Archive>
 void TaskComposerDataStorage::serialize(Archive& ar, const unsigned int /*version*/)
 {
   std::unique_lock lock(mutex_);
-  ar& boost::serialization::make_nvp("data", data_);
+
+  // The data is archived keyed by name, the slots are only valid for the lifetime of the storage
+  std::unordered_map<std::string, tesseract_common::AnyPoly> data;
+  if (Archive::is_saving::value)
+    data = getDataImpl();
+
+  ar& boost::serialization::make_nvp("data", data);
+
+  if (Archive::is_loading::value)
+  {
+    slots_.clear();
+    data_.clear();
+    for (auto& pair : data)
+      data_[getSlotImpl(pair.first)] = Entry{ pair.first, true, std::move(pair.second) };
+  }
 }
 
 }  // namespace tesseract_planning
@@ -243,6 +243,49 @@ void TaskComposerGraph::renameOutputKeys(const std::map<std::string, std::string
     node.second->renameOutputKeys(output_keys);
 }
 
+TaskComposerNode::UPtr TaskComposerGraph::clone() const
+{
+  auto graph = cloneAs<TaskComposerGraph>();
+  if (!cloneNodes(*graph))
+    return nullptr;
+
+  return graph;
+}
+
+bool TaskComposerGraph::cloneNodes(TaskComposerGraph& graph) const
+{
+  std::map<boost::uuids::uuid, boost::uuids::uuid> uuid_map;
+  for (const auto& pair : nodes_)
+  {
+    TaskComposerNode::UPtr node = pair.second->clone();
+    if (node == nullptr)
+      return false;
+
+    uuid_map[pair.first] = graph.addNode(std::move(node));
+  }
+
+  for (const auto& pair : nodes_)
+  {
+    const std::vector<boost::uuids::uuid>& edges = pair.second->getOutboundEdges();
+    if (edges.empty())
+      continue;
+
+    std::vector<boost::uuids::uuid> destinations;
+    destinations.reserve(edges.size());
+    for (const auto& edge : edges)
+      destinations.push_back(uuid_map.at(edge));
+
+    graph.addEdges(uuid_map.at(pair.first), std::move(destinations));
+  }
+
+  graph.terminals_.clear();
+  graph.terminals_.reserve(terminals_.size());
+  for (const auto& terminal : terminals_)
+    graph.terminals_.push_back(uuid_map.at(terminal));
+
+  return true;
+}
+
 std::string TaskComposerGraph::dump(std::ostream& os,
                                     const TaskComposerNode* parent,
                                     const std::map<boost::uuids::uuid, TaskComposerNodeInfo::UPtr>& results_map) const
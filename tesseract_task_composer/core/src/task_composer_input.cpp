@@ -44,9 +44,26 @@ TaskComposerInput::TaskComposerInput(TaskComposerProblem::UPtr problem)
 {
 }
 
-bool TaskComposerInput::isAborted() const { return aborted_; }
+TaskComposerInput::TaskComposerInput(TaskComposerProblem::UPtr problem, const TaskComposerInput& parent)
+  : TaskComposerInput(std::move(problem))
+{
+  dotgraph = parent.dotgraph;
+  priority = parent.priority;
+  metrics = parent.metrics;
+  parent_ = &parent;
+}
+
+bool TaskComposerInput::isAborted() const
+{
+  for (const TaskComposerInput* scope = this; scope != nullptr; scope = scope->parent_)
+  {
+    if (scope->aborted_)
+      return true;
+  }
+  return false;
+}
 
-bool TaskComposerInput::isSuccessful() const { return !aborted_; }
+bool TaskComposerInput::isSuccessful() const { return !isAborted(); }
 
 void TaskComposerInput::abort(const boost::uuids::uuid& calling_node)
 {
@@ -56,6 +73,8 @@ void TaskComposerInput::abort(const boost::uuids::uuid& calling_node)
   aborted_ = true;
 }
 
+const TaskComposerInput* TaskComposerInput::getParent() const { return parent_; }
+
 void TaskComposerInput::reset()
 {
   aborted_ = false;
@@ -63,6 +82,12 @@ void TaskComposerInput::reset()
   task_infos.clear();
 }
 
+void TaskComposerInput::reset(TaskComposerProblem::UPtr problem)
+{
+  this->problem = std::move(problem);
+  reset();
+}
+
 bool TaskComposerInput::operator==(const TaskComposerInput& rhs) const
 {
   bool equal = true;
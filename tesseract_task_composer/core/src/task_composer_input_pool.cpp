@@ -0,0 +1,94 @@
+/**
+ * @file task_composer_input_pool.cpp
+ * @brief A pool of reusable task composer inputs
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_task_composer/core/task_composer_input_pool.h>
+
+namespace tesseract_planning
+{
+void TaskComposerInputPool::Deleter::operator()(TaskComposerInput* input) const
+{
+  if (pool != nullptr)
+    pool->release(input);
+  else
+    delete input;  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+TaskComposerInputPool::TaskComposerInputPool(std::size_t max_size) : max_size_(max_size)
+{
+  inputs_.reserve(max_size_);
+}
+
+TaskComposerInputPool::InputUPtr TaskComposerInputPool::acquire(TaskComposerProblem::UPtr problem)
+{
+  TaskComposerInput::UPtr input;
+  {
+    std::scoped_lock lock(mutex_);
+    if (!inputs_.empty())
+    {
+      input = std::move(inputs_.back());
+      inputs_.pop_back();
+    }
+  }
+
+  if (input == nullptr)
+    return InputUPtr(new TaskComposerInput(std::move(problem)), Deleter{ this });  // NOLINT
+
+  input->reset(std::move(problem));
+  return InputUPtr(input.release(), Deleter{ this });
+}
+
+std::size_t TaskComposerInputPool::size() const
+{
+  std::scoped_lock lock(mutex_);
+  return inputs_.size();
+}
+
+std::size_t TaskComposerInputPool::getMaxSize() const { return max_size_; }
+
+void TaskComposerInputPool::clear()
+{
+  std::scoped_lock lock(mutex_);
+  inputs_.clear();
+}
+
+void TaskComposerInputPool::release(TaskComposerInput* input)
+{
+  TaskComposerInput::UPtr owned(input);
+
+  // Release the problem and data so an idle input only holds onto its bookkeeping memory
+  owned->problem = nullptr;
+  owned->data_storage.clear();
+  owned->task_infos.clear();
+  owned->dotgraph = false;
+  owned->priority = 0;
+  owned->metrics = nullptr;
+
+  std::scoped_lock lock(mutex_);
+  if (inputs_.size() < max_size_)
+    inputs_.push_back(std::move(owned));
+}
+
+}  // namespace tesseract_planning
@@ -0,0 +1,237 @@
+/**
+ * @file task_composer_metrics.cpp
+ * @brief A task composer runtime metrics registry
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <mutex>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_metrics.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+/** @brief The number of histogram buckets per doubling of the latency */
+const double BUCKETS_PER_OCTAVE = 4;
+
+/**
+ * @brief Get the histogram bucket of a latency
+ * @details Bucket zero holds latencies below one microsecond and bucket i holds latencies below 2^(i/4) microseconds
+ */
+std::size_t getBucket(std::uint64_t time_ns)
+{
+  const double time_us = static_cast<double>(time_ns) / 1000.0;
+  if (time_us < 1)
+    return 0;
+
+  auto bucket = static_cast<std::size_t>(std::floor(BUCKETS_PER_OCTAVE * std::log2(time_us))) + 1;
+  return std::min(bucket, TaskComposerMetrics::HISTOGRAM_SIZE - 1);
+}
+
+/** @brief Get the upper bound of a histogram bucket in seconds */
+double getBucketUpperBound(std::size_t bucket)
+{
+  return std::pow(2.0, static_cast<double>(bucket) / BUCKETS_PER_OCTAVE) * 1e-6;
+}
+}  // namespace
+
+double TaskComposerNodeStatistics::getMeanTime() const
+{
+  return (count > 0) ? total_time / static_cast<double>(count) : 0;
+}
+
+void TaskComposerMetrics::record(const TaskComposerNodeInfo& info, std::size_t data_copies)
+{
+  // The shared lock is held while updating the entry so it is not removed by clear()
+  std::shared_lock lock(mutex_);
+  Entry& entry = getEntry(info.name, lock);
+  entry.count.fetch_add(1, std::memory_order_relaxed);
+  if (info.isAborted())
+  {
+    entry.aborts.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  if (info.return_value != 0)
+    entry.successes.fetch_add(1, std::memory_order_relaxed);
+
+  entry.data_copies.fetch_add(data_copies, std::memory_order_relaxed);
+
+  const auto time_ns = static_cast<std::uint64_t>(std::max(0.0, info.elapsed_time) * 1e9);
+  entry.total_time_ns.fetch_add(time_ns, std::memory_order_relaxed);
+  entry.histogram[getBucket(time_ns)].fetch_add(1, std::memory_order_relaxed);
+
+  std::uint64_t max_time_ns = entry.max_time_ns.load(std::memory_order_relaxed);
+  while (time_ns > max_time_ns &&
+         !entry.max_time_ns.compare_exchange_weak(max_time_ns, time_ns, std::memory_order_relaxed))
+  {
+  }
+}
+
+TaskComposerNodeStatistics TaskComposerMetrics::getStatistics(const std::string& name) const
+{
+  std::shared_lock lock(mutex_);
+  auto it = entries_.find(name);
+  if (it == entries_.end())
+  {
+    TaskComposerNodeStatistics statistics;
+    statistics.name = name;
+    return statistics;
+  }
+
+  return getStatistics(name, *it->second);
+}
+
+std::vector<TaskComposerNodeStatistics> TaskComposerMetrics::getStatistics() const
+{
+  std::vector<TaskComposerNodeStatistics> statistics;
+  {
+    std::shared_lock lock(mutex_);
+    statistics.reserve(entries_.size());
+    for (const auto& pair : entries_)
+      statistics.push_back(getStatistics(pair.first, *pair.second));
+  }
+
+  std::sort(statistics.begin(), statistics.end(), [](const auto& a, const auto& b) { return a.name < b.name; });
+  return statistics;
+}
+
+void TaskComposerMetrics::clear()
+{
+  std::unique_lock lock(mutex_);
+  entries_.clear();
+}
+
+void TaskComposerMetrics::dump(std::ostream& os) const
+{
+  const std::ios_base::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision();
+  os << std::left << std::setw(48) << "name" << std::right << std::setw(10) << "count" << std::setw(10) << "success"
+     << std::setw(10) << "aborts" << std::setw(12) << "copies" << std::setw(12) << "mean (ms)" << std::setw(12)
+     << "p50 (ms)" << std::setw(12) << "p95 (ms)" << std::setw(12) << "p99 (ms)" << std::setw(12) << "max (ms)"
+     << "\n";
+
+  os << std::fixed << std::setprecision(3);
+  for (const auto& s : getStatistics())
+  {
+    os << std::left << std::setw(48) << s.name << std::right << std::setw(10) << s.count << std::setw(10)
+       << s.successes << std::setw(10) << s.aborts << std::setw(12) << s.data_copies << std::setw(12)
+       << s.getMeanTime() * 1e3 << std::setw(12) << s.p50 * 1e3 << std::setw(12) << s.p95 * 1e3 << std::setw(12)
+       << s.p99 * 1e3 << std::setw(12) << s.max_time * 1e3 << "\n";
+  }
+  os.flags(flags);
+  os.precision(precision);
+}
+
+void TaskComposerMetrics::dumpJSON(std::ostream& os) const
+{
+  const std::ios_base::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision();
+  os << std::scientific << std::setprecision(6);
+  os << "{\"nodes\":[";
+  bool first{ true };
+  for (const auto& s : getStatistics())
+  {
+    os << (first ? "\n" : ",\n");
+    os << "{\"name\":" << std::quoted(s.name) << ",\"count\":" << s.count << ",\"successes\":" << s.successes
+       << ",\"aborts\":" << s.aborts << ",\"data_copies\":" << s.data_copies << ",\"total_time\":" << s.total_time
+       << ",\"mean_time\":" << s.getMeanTime() << ",\"p50\":" << s.p50 << ",\"p95\":" << s.p95 << ",\"p99\":" << s.p99
+       << ",\"max_time\":" << s.max_time << "}";
+    first = false;
+  }
+  os << "\n]}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
+TaskComposerMetrics::Entry& TaskComposerMetrics::getEntry(const std::string& name,
+                                                          std::shared_lock<std::shared_mutex>& lock)
+{
+  // The entry may be removed by clear() between creating it and taking the shared lock again
+  while (true)
+  {
+    auto it = entries_.find(name);
+    if (it != entries_.end())
+      return *it->second;
+
+    lock.unlock();
+    {
+      std::unique_lock unique_lock(mutex_);
+      auto& entry = entries_[name];
+      if (entry == nullptr)
+        entry = std::make_unique<Entry>();
+    }
+    lock.lock();
+  }
+}
+
+TaskComposerNodeStatistics TaskComposerMetrics::getStatistics(const std::string& name, const Entry& entry)
+{
+  TaskComposerNodeStatistics statistics;
+  statistics.name = name;
+  statistics.count = entry.count.load(std::memory_order_relaxed);
+  statistics.successes = entry.successes.load(std::memory_order_relaxed);
+  statistics.aborts = entry.aborts.load(std::memory_order_relaxed);
+  statistics.data_copies = entry.data_copies.load(std::memory_order_relaxed);
+  statistics.total_time = static_cast<double>(entry.total_time_ns.load(std::memory_order_relaxed)) * 1e-9;
+  statistics.max_time = static_cast<double>(entry.max_time_ns.load(std::memory_order_relaxed)) * 1e-9;
+
+  std::array<std::size_t, HISTOGRAM_SIZE> histogram{};
+  std::size_t total{ 0 };
+  for (std::size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+  {
+    histogram[i] = entry.histogram[i].load(std::memory_order_relaxed);
+    total += histogram[i];
+  }
+
+  if (total == 0)
+    return statistics;
+
+  // The percentile is the upper bound of the bucket containing it, limited to the longest run
+  auto percentile = [&](double p) {
+    const auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(total)));
+    std::size_t cumulative{ 0 };
+    for (std::size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+    {
+      cumulative += histogram[i];
+      if (cumulative >= rank)
+        return std::min(getBucketUpperBound(i), statistics.max_time);
+    }
+    return statistics.max_time;
+  };
+
+  statistics.p50 = percentile(0.50);
+  statistics.p95 = percentile(0.95);
+  statistics.p99 = percentile(0.99);
+  return statistics;
+}
+
+}  // namespace tesseract_planning
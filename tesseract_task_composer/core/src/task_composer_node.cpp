@@ -35,12 +35,22 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_node.h>
 
+namespace
+{
+/** @brief Creating a random generator is expensive so one is kept per thread */
+boost::uuids::uuid generateUUID()
+{
+  thread_local boost::uuids::random_generator generator;
+  return generator();
+}
+}  // namespace
+
 namespace tesseract_planning
 {
 TaskComposerNode::TaskComposerNode(std::string name, TaskComposerNodeType type, bool conditional)
   : name_(std::move(name))
   , type_(type)
-  , uuid_(boost::uuids::random_generator()())
+  , uuid_(generateUUID())
   , uuid_str_(boost::uuids::to_string(uuid_))
   , conditional_(conditional)
 {
@@ -115,6 +125,17 @@ void TaskComposerNode::renameOutputKeys(const std::map<std::string, std::string>
 
 void TaskComposerNode::setConditional(bool enable) { conditional_ = enable; }
 
+TaskComposerNode::UPtr TaskComposerNode::clone() const { return nullptr; }
+
+void TaskComposerNode::copyNodeData(TaskComposerNode& node) const
+{
+  node.name_ = name_;
+  node.type_ = type_;
+  node.input_keys_ = input_keys_;
+  node.output_keys_ = output_keys_;
+  node.conditional_ = conditional_;
+}
+
 std::string TaskComposerNode::dump(std::ostream& os,
                                    const TaskComposerNode* /*parent*/,
                                    const std::map<boost::uuids::uuid, TaskComposerNodeInfo::UPtr>& results_map) const
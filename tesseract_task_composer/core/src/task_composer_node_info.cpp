@@ -33,6 +33,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/uuid_serialize.hpp>
 #include <mutex>
+#include <iomanip>
+#include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_node_info.h>
@@ -79,7 +81,7 @@ bool TaskComposerNodeInfo::isAborted() const { return aborted_; }
 TaskComposerNodeInfo::UPtr TaskComposerNodeInfo::clone() const { return std::make_unique<TaskComposerNodeInfo>(*this); }
 
 template <class Archive>
-void TaskComposerNodeInfo::serialize(Archive& ar, const unsigned int /*version*/)
+void TaskComposerNodeInfo::serialize(Archive& ar, const unsigned int version)
 {
   ar& boost::serialization::make_nvp("name", name);
   ar& boost::serialization::make_nvp("uuid", uuid);
@@ -95,6 +97,13 @@ void TaskComposerNodeInfo::serialize(Archive& ar, const unsigned int /*version*/
   ar& boost::serialization::make_nvp("color", color);
   ar& boost::serialization::make_nvp("dotgraph", dotgraph);
   ar& boost::serialization::make_nvp("aborted", aborted_);
+
+  // Version 0 archives were written before the start time and thread were recorded
+  if (version >= 1)
+  {
+    ar& boost::serialization::make_nvp("start_time", start_time);
+    ar& boost::serialization::make_nvp("thread_id", thread_id);
+  }
 }
 
 TaskComposerNodeInfoContainer::TaskComposerNodeInfoContainer(const TaskComposerNodeInfoContainer& other)
@@ -139,7 +148,25 @@ TaskComposerNodeInfoContainer& TaskComposerNodeInfoContainer::operator=(TaskComp
 void TaskComposerNodeInfoContainer::addInfo(TaskComposerNodeInfo::UPtr info)
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
-  info_map_[info->uuid] = std::move(info);
+  auto it = info_map_.find(info->uuid);
+  if (it != info_map_.end())
+  {
+    it->second = std::move(info);
+    return;
+  }
+
+  if (free_nodes_.empty())
+  {
+    const boost::uuids::uuid uuid = info->uuid;
+    info_map_.emplace(uuid, std::move(info));
+    return;
+  }
+
+  auto nh = std::move(free_nodes_.back());
+  free_nodes_.pop_back();
+  nh.key() = info->uuid;
+  nh.mapped() = std::move(info);
+  info_map_.insert(std::move(nh));
 }
 
 TaskComposerNodeInfo::UPtr TaskComposerNodeInfoContainer::getInfo(const boost::uuids::uuid& key) const
@@ -169,7 +196,13 @@ void TaskComposerNodeInfoContainer::clear()
 {
   std::unique_lock<std::shared_mutex> lock(mutex_);
   aborting_node_ = boost::uuids::uuid{};
-  info_map_.clear();
+  free_nodes_.reserve(free_nodes_.size() + info_map_.size());
+  while (!info_map_.empty())
+  {
+    auto nh = info_map_.extract(info_map_.begin());
+    nh.mapped() = nullptr;
+    free_nodes_.push_back(std::move(nh));
+  }
 }
 
 std::map<boost::uuids::uuid, TaskComposerNodeInfo::UPtr> TaskComposerNodeInfoContainer::getInfoMap() const
@@ -204,6 +237,145 @@ void TaskComposerNodeInfoContainer::updateParents(std::map<boost::uuids::uuid, T
   updateParents(info_map, it->second->parent_uuid);
 }
 
+namespace
+{
+/** @brief Escape a string to be written as a JSON string */
+std::string escapeJSON(const std::string& str)
+{
+  std::string escaped;
+  escaped.reserve(str.size());
+  for (const char c : str)
+  {
+    switch (c)
+    {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+          escaped += ' ';
+        else
+          escaped += c;
+    }
+  }
+  return escaped;
+}
+}  // namespace
+
+void TaskComposerNodeInfoContainer::dumpChromeTrace(std::ostream& os) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  // Nodes which have not started, for example the info of a graph that was never submitted, are not on the timeline
+  double min_start_time = std::numeric_limits<double>::max();
+  std::map<boost::uuids::uuid, double> end_times;
+  for (const auto& pair : info_map_)
+  {
+    if (pair.second->start_time <= 0)
+      continue;
+
+    min_start_time = std::min(min_start_time, pair.second->start_time);
+    end_times[pair.first] = pair.second->start_time + pair.second->elapsed_time;
+  }
+
+  // Graphs do not record an elapsed time because their children run on the executor, so a node ends when its last
+  // child ends
+  for (const auto& pair : info_map_)
+  {
+    auto it = end_times.find(pair.first);
+    if (it == end_times.end())
+      continue;
+
+    for (boost::uuids::uuid parent_uuid = pair.second->parent_uuid; !parent_uuid.is_nil();)
+    {
+      auto parent_it = end_times.find(parent_uuid);
+      if (parent_it == end_times.end() || parent_it->second >= it->second)
+        break;
+
+      parent_it->second = it->second;
+      parent_uuid = info_map_.at(parent_uuid)->parent_uuid;
+    }
+  }
+
+  // Map the thread ids to small sequential ids in the order the threads were first used
+  std::vector<std::pair<double, std::size_t>> thread_first_use;
+  for (const auto& pair : info_map_)
+  {
+    if (end_times.find(pair.first) != end_times.end())
+      thread_first_use.emplace_back(pair.second->start_time, pair.second->thread_id);
+  }
+  std::sort(thread_first_use.begin(), thread_first_use.end());
+
+  std::unordered_map<std::size_t, std::size_t> thread_ids;
+  for (const auto& pair : thread_first_use)
+    thread_ids.emplace(pair.second, thread_ids.size());
+
+  auto toMicroseconds = [min_start_time](double time) { return (time - min_start_time) * 1e6; };
+
+  const std::ios_base::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision();
+  os << std::fixed << std::setprecision(3);
+  os << "{\"traceEvents\":[";
+  bool first{ true };
+  for (const auto& pair : thread_ids)
+  {
+    os << (first ? "\n" : ",\n");
+    os << R"({"name":"thread_name","ph":"M","pid":0,"tid":)" << pair.second << R"(,"args":{"name":"thread )"
+       << pair.second << "\"}}";
+    first = false;
+  }
+
+  for (const auto& pair : info_map_)
+  {
+    auto it = end_times.find(pair.first);
+    if (it == end_times.end())
+      continue;
+
+    const TaskComposerNodeInfo& info = *pair.second;
+
+    // The node is ready when all of its inbound nodes finished, or when its parent started if it has no inbound nodes
+    double ready_time = info.start_time;
+    bool has_ready_time{ false };
+    for (const auto& edge : info.inbound_edges)
+    {
+      auto edge_it = end_times.find(edge);
+      if (edge_it == end_times.end())
+        continue;
+
+      ready_time = (has_ready_time) ? std::max(ready_time, edge_it->second) : edge_it->second;
+      has_ready_time = true;
+    }
+
+    if (!has_ready_time && !info.parent_uuid.is_nil())
+    {
+      auto parent_it = info_map_.find(info.parent_uuid);
+      if (parent_it != info_map_.end() && end_times.find(info.parent_uuid) != end_times.end())
+        ready_time = parent_it->second->start_time;
+    }
+
+    os << ",\n";
+    os << R"({"name":")" << escapeJSON(info.name) << R"(","cat":"task_composer","ph":"X","pid":0,"tid":)"
+       << thread_ids.at(info.thread_id) << R"(,"ts":)" << toMicroseconds(info.start_time) << R"(,"dur":)"
+       << (it->second - info.start_time) * 1e6 << R"(,"args":{"uuid":")" << boost::uuids::to_string(info.uuid)
+       << R"(","parent_uuid":")" << boost::uuids::to_string(info.parent_uuid) << R"(","return_value":)"
+       << info.return_value << R"(,"queue_wait_us":)" << std::max(0.0, info.start_time - ready_time) * 1e6
+       << R"(,"message":")" << escapeJSON(info.message) << "\"}}";
+  }
+
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
 bool TaskComposerNodeInfoContainer::operator==(const TaskComposerNodeInfoContainer& rhs) const
 {
   std::shared_lock lhs_lock(mutex_, std::defer_lock);
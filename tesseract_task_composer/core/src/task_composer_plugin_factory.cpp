@@ -24,6 +24,13 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <mutex>
+#include <set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_common/plugin_loader.hpp>
 #include <tesseract_common/yaml_utils.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
@@ -32,6 +39,29 @@ static const std::string TESSERACT_TASK_COMPOSER_PLUGIN_DIRECTORIES_ENV = "TESSE
                                                                           "DIRECTORIES";
 static const std::string TESSERACT_TASK_COMPOSER_PLUGINS_ENV = "TESSERACT_TASK_COMPOSER_PLUGINS";
 
+namespace
+{
+/** @brief Collect the factory class name of a node and the class names of all nodes defined inline in its config */
+void getNodeFactoryClassNames(std::set<std::string>& class_names,
+                              const std::string& class_name,
+                              const YAML::Node& config)
+{
+  class_names.insert(class_name);
+  if (!config || !config.IsMap())
+    return;
+
+  const YAML::Node nodes = config["nodes"];
+  if (!nodes || !nodes.IsMap())
+    return;
+
+  for (auto node_it = nodes.begin(); node_it != nodes.end(); ++node_it)
+  {
+    if (const YAML::Node fn = node_it->second["class"])
+      getNodeFactoryClassNames(class_names, fn.as<std::string>(), node_it->second["config"]);
+  }
+}
+}  // namespace
+
 namespace tesseract_planning
 {
 const std::string TaskComposerExecutorFactory::SECTION_NAME = "TaskExec";
@@ -69,6 +99,62 @@ TaskComposerPluginFactory::TaskComposerPluginFactory(const std::string& config)
 // If not the forward declare of PluginLoader cause compiler error.
 TaskComposerPluginFactory::~TaskComposerPluginFactory() = default;
 
+TaskComposerPluginFactory::TaskComposerPluginFactory(const TaskComposerPluginFactory& other)
+  : executor_plugin_info_(other.executor_plugin_info_)
+  , task_plugin_info_(other.task_plugin_info_)
+  , plugin_loader_(other.plugin_loader_)
+  , preload_time_(other.preload_time_)
+{
+  std::shared_lock lock(other.factories_mutex_);
+  executor_factories_ = other.executor_factories_;
+  node_factories_ = other.node_factories_;
+}
+
+TaskComposerPluginFactory& TaskComposerPluginFactory::operator=(const TaskComposerPluginFactory& other)
+{
+  if (this == &other)
+    return *this;
+
+  std::unique_lock lhs_lock(factories_mutex_, std::defer_lock);
+  std::shared_lock rhs_lock(other.factories_mutex_, std::defer_lock);
+  std::scoped_lock lock{ lhs_lock, rhs_lock };
+  executor_factories_ = other.executor_factories_;
+  node_factories_ = other.node_factories_;
+  executor_plugin_info_ = other.executor_plugin_info_;
+  task_plugin_info_ = other.task_plugin_info_;
+  plugin_loader_ = other.plugin_loader_;
+  preload_time_ = other.preload_time_;
+  return *this;
+}
+
+TaskComposerPluginFactory::TaskComposerPluginFactory(TaskComposerPluginFactory&& other) noexcept
+  : executor_plugin_info_(std::move(other.executor_plugin_info_))
+  , task_plugin_info_(std::move(other.task_plugin_info_))
+  , plugin_loader_(std::move(other.plugin_loader_))
+  , preload_time_(other.preload_time_)
+{
+  std::unique_lock lock(other.factories_mutex_);
+  executor_factories_ = std::move(other.executor_factories_);
+  node_factories_ = std::move(other.node_factories_);
+}
+
+TaskComposerPluginFactory& TaskComposerPluginFactory::operator=(TaskComposerPluginFactory&& other) noexcept
+{
+  if (this == &other)
+    return *this;
+
+  std::unique_lock lhs_lock(factories_mutex_, std::defer_lock);
+  std::unique_lock rhs_lock(other.factories_mutex_, std::defer_lock);
+  std::scoped_lock lock{ lhs_lock, rhs_lock };
+  executor_factories_ = std::move(other.executor_factories_);
+  node_factories_ = std::move(other.node_factories_);
+  executor_plugin_info_ = std::move(other.executor_plugin_info_);
+  task_plugin_info_ = std::move(other.task_plugin_info_);
+  plugin_loader_ = std::move(other.plugin_loader_);
+  preload_time_ = other.preload_time_;
+  return *this;
+}
+
 void TaskComposerPluginFactory::loadConfig(const YAML::Node& config)
 {
   if (const YAML::Node& plugin_info = config[tesseract_common::TaskComposerPluginInfo::CONFIG_KEY])
@@ -79,6 +165,7 @@ void TaskComposerPluginFactory::loadConfig(const YAML::Node& config)
                                            tc_plugin_info.search_libraries.end());
     executor_plugin_info_ = tc_plugin_info.executor_plugin_infos;
     task_plugin_info_ = tc_plugin_info.task_plugin_infos;
+    preloadFactories();
   }
 }
 
@@ -223,17 +310,13 @@ TaskComposerPluginFactory::createTaskComposerExecutor(const std::string& name,
 {
   try
   {
-    auto it = executor_factories_.find(plugin_info.class_name);
-    if (it != executor_factories_.end())
-      return it->second->create(name, plugin_info.config);
-
-    auto plugin = plugin_loader_.instantiate<TaskComposerExecutorFactory>(plugin_info.class_name);
+    TaskComposerExecutorFactory::Ptr plugin = getTaskComposerExecutorFactory(plugin_info.class_name);
     if (plugin == nullptr)
     {
       CONSOLE_BRIDGE_logWarn("Failed to load symbol '%s'", plugin_info.class_name.c_str());
       return nullptr;
     }
-    executor_factories_[plugin_info.class_name] = plugin;
+
     return plugin->create(name, plugin_info.config);
   }
   catch (const std::exception& e)
@@ -263,17 +346,13 @@ TaskComposerPluginFactory::createTaskComposerNode(const std::string& name,
 {
   try
   {
-    auto it = node_factories_.find(plugin_info.class_name);
-    if (it != node_factories_.end())
-      return it->second->create(name, plugin_info.config, *this);
-
-    auto plugin = plugin_loader_.instantiate<TaskComposerNodeFactory>(plugin_info.class_name);
+    TaskComposerNodeFactory::Ptr plugin = getTaskComposerNodeFactory(plugin_info.class_name);
     if (plugin == nullptr)
     {
       CONSOLE_BRIDGE_logWarn("Failed to load symbol '%s'", plugin_info.class_name.c_str());
       return nullptr;
     }
-    node_factories_[plugin_info.class_name] = plugin;
+
     return plugin->create(name, plugin_info.config, *this);
   }
   catch (const std::exception& e)
@@ -283,6 +362,67 @@ TaskComposerPluginFactory::createTaskComposerNode(const std::string& name,
   }
 }
 
+bool TaskComposerPluginFactory::preloadFactories()
+{
+  const auto start_time = std::chrono::steady_clock::now();
+
+  std::set<std::string> executor_class_names;
+  for (const auto& plugin : executor_plugin_info_.plugins)
+    executor_class_names.insert(plugin.second.class_name);
+
+  std::set<std::string> node_class_names;
+  for (const auto& plugin : task_plugin_info_.plugins)
+    getNodeFactoryClassNames(node_class_names, plugin.second.class_name, plugin.second.config);
+
+  bool success{ true };
+  for (const auto& class_name : executor_class_names)
+  {
+    try
+    {
+      if (getTaskComposerExecutorFactory(class_name) == nullptr)
+      {
+        CONSOLE_BRIDGE_logWarn("TaskComposerPluginFactory, failed to preload executor factory '%s'",
+                               class_name.c_str());
+        success = false;
+      }
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logWarn("TaskComposerPluginFactory, failed to preload executor factory '%s', Details: %s",
+                             class_name.c_str(),
+                             e.what());
+      success = false;
+    }
+  }
+
+  for (const auto& class_name : node_class_names)
+  {
+    try
+    {
+      if (getTaskComposerNodeFactory(class_name) == nullptr)
+      {
+        CONSOLE_BRIDGE_logWarn("TaskComposerPluginFactory, failed to preload node factory '%s'", class_name.c_str());
+        success = false;
+      }
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logWarn(
+          "TaskComposerPluginFactory, failed to preload node factory '%s', Details: %s", class_name.c_str(), e.what());
+      success = false;
+    }
+  }
+
+  preload_time_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  CONSOLE_BRIDGE_logDebug("TaskComposerPluginFactory, preloaded %zu executor and %zu node factories in %f seconds",
+                          executor_class_names.size(),
+                          node_class_names.size(),
+                          preload_time_);
+  return success;
+}
+
+double TaskComposerPluginFactory::getPreloadTime() const { return preload_time_; }
+
 void TaskComposerPluginFactory::saveConfig(const tesseract_common::fs::path& file_path) const
 {
   YAML::Node config = getConfig();
@@ -303,4 +443,48 @@ YAML::Node TaskComposerPluginFactory::getConfig() const
 
   return config;
 }
+
+TaskComposerExecutorFactory::Ptr
+TaskComposerPluginFactory::getTaskComposerExecutorFactory(const std::string& class_name) const
+{
+  {
+    std::shared_lock lock(factories_mutex_);
+    auto it = executor_factories_.find(class_name);
+    if (it != executor_factories_.end())
+      return it->second;
+  }
+
+  std::unique_lock lock(factories_mutex_);
+  auto it = executor_factories_.find(class_name);
+  if (it != executor_factories_.end())
+    return it->second;
+
+  auto plugin = plugin_loader_.instantiate<TaskComposerExecutorFactory>(class_name);
+  if (plugin != nullptr)
+    executor_factories_[class_name] = plugin;
+
+  return plugin;
+}
+
+TaskComposerNodeFactory::Ptr TaskComposerPluginFactory::getTaskComposerNodeFactory(const std::string& class_name) const
+{
+  {
+    std::shared_lock lock(factories_mutex_);
+    auto it = node_factories_.find(class_name);
+    if (it != node_factories_.end())
+      return it->second;
+  }
+
+  std::unique_lock lock(factories_mutex_);
+  auto it = node_factories_.find(class_name);
+  if (it != node_factories_.end())
+    return it->second;
+
+  auto plugin = plugin_loader_.instantiate<TaskComposerNodeFactory>(class_name);
+  if (plugin != nullptr)
+    node_factories_[class_name] = plugin;
+
+  return plugin;
+}
+
 }  // namespace tesseract_planning
@@ -114,6 +114,9 @@ TaskComposerFuture::UPtr TaskComposerServer::run(TaskComposerInput& task_input,
   if (t_it == tasks_.end())
     throw std::runtime_error("Task with name '" + task_input.problem->name + "' does not exist!");
 
+  if (task_input.metrics == nullptr)
+    task_input.metrics = metrics_;
+
   return e_it->second->run(*t_it->second, task_input);
 }
 
@@ -125,9 +128,14 @@ TaskComposerFuture::UPtr TaskComposerServer::run(const TaskComposerNode& node,
   if (it == executors_.end())
     throw std::runtime_error("Executor with name '" + name + "' does not exist!");
 
+  if (task_input.metrics == nullptr)
+    task_input.metrics = metrics_;
+
   return it->second->run(node, task_input);
 }
 
+TaskComposerMetrics::Ptr TaskComposerServer::getMetrics() const { return metrics_; }
+
 long TaskComposerServer::getWorkerCount(const std::string& name) const
 {
   auto it = executors_.find(name);
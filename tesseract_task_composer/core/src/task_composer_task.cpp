@@ -27,6 +27,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <chrono>
+#include <thread>
 #include <boost/serialization/base_object.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -55,12 +57,19 @@ int TaskComposerTask::run(TaskComposerInput& input, OptionalTaskComposerExecutor
     info->color = "white";
     info->message = "Aborted";
     info->aborted_ = true;
+    info->start_time = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    info->thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    if (input.metrics != nullptr)
+      input.metrics->record(*info);
+
     input.task_infos.addInfo(std::move(info));
     return 0;
   }
 
   tesseract_common::Timer timer;
   TaskComposerNodeInfo::UPtr results;
+  const auto start_time = std::chrono::steady_clock::now();
+  const std::size_t start_copy_count = TaskComposerDataStorage::getThreadCopyCount();
   timer.start();
   try
   {
@@ -75,6 +84,11 @@ int TaskComposerTask::run(TaskComposerInput& input, OptionalTaskComposerExecutor
   }
   timer.stop();
   results->elapsed_time = timer.elapsedSeconds();
+  results->start_time = std::chrono::duration<double>(start_time.time_since_epoch()).count();
+  results->thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+  if (input.metrics != nullptr)
+    input.metrics->record(*results, TaskComposerDataStorage::getThreadCopyCount() - start_copy_count);
 
   int value = results->return_value;
   assert(value >= 0);
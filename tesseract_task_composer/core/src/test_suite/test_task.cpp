@@ -52,6 +52,15 @@ TestTask::TestTask(std::string name, const YAML::Node& config, const TaskCompose
   // LCOV_EXCL_STOP
 }
 
+TaskComposerNode::UPtr TestTask::clone() const
+{
+  auto task = cloneAs<TestTask>();
+  task->throw_exception = throw_exception;
+  task->set_abort = set_abort;
+  task->return_value = return_value;
+  return task;
+}
+
 bool TestTask::operator==(const TestTask& rhs) const
 {
   bool equal = true;
@@ -9,10 +9,15 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 #include <tesseract_task_composer/core/test_suite/test_programs.hpp>
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
+#include <tesseract_task_composer/planning/nodes/time_optimal_parameterization_task.h>
+#include <tesseract_task_composer/planning/profiles/time_optimal_parameterization_profile.h>
+#include <tesseract_motion_planners/trajopt/profile/trajopt_default_solver_profile.h>
 
 #include <tesseract_common/types.h>
+#include <tesseract_common/timer.h>
 #include <tesseract_environment/environment.h>
 #include <tesseract_command_language/utils.h>
+#include <tesseract_command_language/poly/state_waypoint_poly.h>
 #include <tesseract_visualization/visualization_loader.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
 
@@ -78,8 +83,75 @@ int main()
   task->dump(tc_out_data, nullptr, task_input->task_infos.getInfoMap());
   tc_out_data.close();
 
+  // Save timeline, this can be viewed in chrome://tracing or https://ui.perfetto.dev
+  std::ofstream trace_out_data;
+  trace_out_data.open(tesseract_common::getTempPath() + "task_composer_raster_example.json");
+  task_input->task_infos.dumpChromeTrace(trace_out_data);
+  trace_out_data.close();
+
   // Plot Process Trajectory
   auto output_program = task_input->data_storage.getData(output_key).as<CompositeInstruction>();
+
+  // Compare time parameterizing the whole program to time parameterizing its segments concurrently
+  for (bool parameterize_segments : { false, true })
+  {
+    auto totg_profile = std::make_shared<TimeOptimalParameterizationProfile>();
+    totg_profile->parameterize_segments = parameterize_segments;
+    auto totg_profiles = std::make_shared<ProfileDictionary>();
+    totg_profiles->addProfile<TimeOptimalParameterizationProfile>(
+        "TimeOptimalParameterizationTask", output_program.getProfile(), totg_profile);
+
+    TaskComposerDataStorage totg_data;
+    totg_data.setData("input_data", output_program);
+    TaskComposerInput totg_input(std::make_unique<PlanningTaskComposerProblem>(env, totg_data, totg_profiles));
+    TimeOptimalParameterizationTask totg_task("TimeOptimalParameterizationTask", "input_data", "output_data", false);
+
+    tesseract_common::Timer timer;
+    timer.start();
+    task_executor->run(totg_task, totg_input)->wait();
+    timer.stop();
+
+    auto totg_program = totg_input.data_storage.getData("output_data").as<CompositeInstruction>();
+    const auto& last_state = totg_program.getLastMoveInstruction()->getWaypoint().as<StateWaypointPoly>();
+    std::cout << (parameterize_segments ? "Segment wise" : "Whole program")
+              << " time parameterization wall time: " << timer.elapsedSeconds()
+              << " s, trajectory duration: " << last_state.getTime() << " s" << std::endl;
+  }
+
+  // Compare solving the raster segments as a single trajopt problem to solving them as overlapping windows
+  for (int window_size : { 0, 10 })
+  {
+    auto trajopt_solver_profile = std::make_shared<TrajOptDefaultSolverProfile>();
+    trajopt_solver_profile->window.window_size = window_size;
+    auto trajopt_profiles = std::make_shared<ProfileDictionary>();
+    trajopt_profiles->addProfile<TrajOptSolverProfile>("TrajOptMotionPlannerTask", "PROCESS", trajopt_solver_profile);
+
+    TaskComposerDataStorage trajopt_data;
+    trajopt_data.setData(input_key, program);
+    TaskComposerInput trajopt_input(std::make_unique<PlanningTaskComposerProblem>(env, trajopt_data, trajopt_profiles));
+
+    tesseract_common::Timer timer;
+    timer.start();
+    task_executor->run(*task, trajopt_input)->wait();
+    timer.stop();
+
+    if (!trajopt_input.isSuccessful())
+    {
+      std::cout << "Raster planning with trajopt window size " << window_size << " failed" << std::endl;
+      continue;
+    }
+
+    // The joint path length shows whether the windows converge to a different solution than the single problem
+    auto trajopt_program = trajopt_input.data_storage.getData(output_key).as<CompositeInstruction>();
+    tesseract_common::JointTrajectory trajectory = toJointTrajectory(trajopt_program);
+    double path_length{ 0 };
+    for (std::size_t i = 1; i < trajectory.size(); ++i)
+      path_length += (trajectory[i].position - trajectory[i - 1].position).norm();
+
+    std::cout << "Raster planning with trajopt window size " << window_size << " wall time: " << timer.elapsedSeconds()
+              << " s, joint path length: " << path_length << " rad" << std::endl;
+  }
+
   if (plotter != nullptr && plotter->isConnected())
   {
     plotter->waitForInput();
@@ -56,6 +56,8 @@ public:
   CheckInputTask(CheckInputTask&&) = delete;
   CheckInputTask& operator=(CheckInputTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const CheckInputTask& rhs) const;
   bool operator!=(const CheckInputTask& rhs) const;
 
@@ -59,6 +59,8 @@ public:
   ContinuousContactCheckTask(ContinuousContactCheckTask&&) = delete;
   ContinuousContactCheckTask& operator=(ContinuousContactCheckTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const ContinuousContactCheckTask& rhs) const;
   bool operator!=(const ContinuousContactCheckTask& rhs) const;
 
@@ -59,6 +59,8 @@ public:
   DiscreteContactCheckTask(DiscreteContactCheckTask&&) = delete;
   DiscreteContactCheckTask& operator=(DiscreteContactCheckTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const DiscreteContactCheckTask& rhs) const;
   bool operator!=(const DiscreteContactCheckTask& rhs) const;
 
@@ -72,6 +72,8 @@ public:
   FixStateCollisionTask(FixStateCollisionTask&&) = delete;
   FixStateCollisionTask& operator=(FixStateCollisionTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const FixStateCollisionTask& rhs) const;
   bool operator!=(const FixStateCollisionTask& rhs) const;
 
@@ -72,6 +72,8 @@ public:
   FormatAsInputTask(FormatAsInputTask&&) = delete;
   FormatAsInputTask& operator=(FormatAsInputTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const FormatAsInputTask& rhs) const;
   bool operator!=(const FormatAsInputTask& rhs) const;
 
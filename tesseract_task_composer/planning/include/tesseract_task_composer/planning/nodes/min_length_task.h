@@ -56,6 +56,8 @@ public:
   MinLengthTask(MinLengthTask&&) = delete;
   MinLengthTask& operator=(MinLengthTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const MinLengthTask& rhs) const;
   bool operator!=(const MinLengthTask& rhs) const;
 
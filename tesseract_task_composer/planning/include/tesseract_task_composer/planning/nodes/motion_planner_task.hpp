@@ -89,6 +89,16 @@ public:
   }
   ~MotionPlannerTask() override = default;
 
+  TaskComposerNode::UPtr clone() const override
+  {
+    auto task = cloneAs<MotionPlannerTask<MotionPlannerType>>();
+    if (planner_ != nullptr)
+      task->planner_ = std::make_shared<MotionPlannerType>(planner_->getName());
+
+    task->format_result_as_input_ = format_result_as_input_;
+    return task;
+  }
+
   bool operator==(const MotionPlannerTask& rhs) const
   {
     bool equal = true;
@@ -57,6 +57,8 @@ public:
   ProfileSwitchTask(ProfileSwitchTask&&) = delete;
   ProfileSwitchTask& operator=(ProfileSwitchTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const ProfileSwitchTask& rhs) const;
   bool operator!=(const ProfileSwitchTask& rhs) const;
 
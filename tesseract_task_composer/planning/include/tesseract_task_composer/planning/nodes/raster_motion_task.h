@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_task.h>
+#include <tesseract_task_composer/planning/nodes/raster_segment_cache.h>
 #include <tesseract_common/any_poly.h>
 
 namespace tesseract_planning
@@ -54,6 +55,15 @@ class TaskComposerPluginFactory;
  *   Composite - Raster segment
  *   Composite - to end
  * }
+ *
+ * Each segment is planned in its own abort scope, so a segment which fails only skips the transitions, from start or
+ * to end which depend on it while the other segments are still planned. A failed segment does not abort the input, the
+ * task returns zero instead. If max_segment_retries is greater than zero the planned segments are kept and only the
+ * failed and skipped segments are planned again, up to the number of retries.
+ *
+ * If a segment cache is provided, or segment_cache_size is set in the config, the planned segments are stored and the
+ * segments of a later program which did not change are reused instead of planned again. See RasterSegmentCache for
+ * what makes up the key of a segment.
  */
 
 class RasterMotionTask : public TaskComposerTask
@@ -74,7 +84,9 @@ public:
                             bool conditional,
                             TaskFactory freespace_task_factory,
                             TaskFactory raster_task_factory,
-                            TaskFactory transition_task_factory);
+                            TaskFactory transition_task_factory,
+                            std::size_t max_segment_retries = 0,
+                            RasterSegmentCache::Ptr segment_cache = nullptr);
 
   explicit RasterMotionTask(std::string name,
                             const YAML::Node& config,
@@ -86,6 +98,14 @@ public:
   RasterMotionTask(RasterMotionTask&&) = delete;
   RasterMotionTask& operator=(RasterMotionTask&&) = delete;
 
+  /** @brief The number of times the failed segments are planned again, keeping the segments which were planned */
+  std::size_t getMaxSegmentRetries() const;
+
+  /** @brief The cache of planned segments, nullptr if segments are not cached */
+  RasterSegmentCache::Ptr getSegmentCache() const;
+
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const RasterMotionTask& rhs) const;
   bool operator!=(const RasterMotionTask& rhs) const;
 
@@ -93,6 +113,10 @@ protected:
   TaskFactory freespace_task_factory_;
   TaskFactory raster_task_factory_;
   TaskFactory transition_task_factory_;
+  std::size_t max_segment_retries_{ 0 };
+
+  /** @brief The cache of planned segments, this is shared with clones and is not serialized */
+  RasterSegmentCache::Ptr segment_cache_;
 
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
@@ -108,6 +132,8 @@ protected:
 }  // namespace tesseract_planning
 
 #include <boost/serialization/export.hpp>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY2(tesseract_planning::RasterMotionTask, "RasterMotionTask")
+BOOST_CLASS_VERSION(tesseract_planning::RasterMotionTask, 1)
 
 #endif  // TESSERACT_TASK_COMPOSER_RASTER_MOTION_TASK_H
@@ -80,6 +80,8 @@ public:
   RasterOnlyMotionTask(RasterOnlyMotionTask&&) = delete;
   RasterOnlyMotionTask& operator=(RasterOnlyMotionTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const RasterOnlyMotionTask& rhs) const;
   bool operator!=(const RasterOnlyMotionTask& rhs) const;
 
@@ -0,0 +1,177 @@
+/**
+ * @file raster_segment_cache.h
+ * @brief A cache of planned raster program segments
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_RASTER_SEGMENT_CACHE_H
+#define TESSERACT_TASK_COMPOSER_RASTER_SEGMENT_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/profile_dictionary.h>
+
+namespace tesseract_planning
+{
+struct PlanningTaskComposerProblem;
+
+/**
+ * @brief A thread safe store of planned raster program segments keyed on everything used to plan them
+ *
+ * The key of a segment holds an encoding of its program, the environment name and revision, the profiles and profile
+ * remapping of the problem, and the programs of the segments its start and end state are taken from. A segment of a
+ * resubmitted program which did not change therefore has an equal key and its planned output is reused, while an
+ * edited raster also changes the keys of the transitions connected to it. The full keys are compared on lookup, so a
+ * hash collision never returns the output of another segment.
+ *
+ * The uuids of the instructions are not part of the key so the program may be recreated between requests, the cached
+ * output keeps the uuids of the program it was planned from. Profiles are immutable, so they are identified by the
+ * profile objects stored under each name. A rebuilt profile dictionary holding the same profiles gives the same key,
+ * while adding or replacing a profile changes it. The key keeps the profiles alive so their addresses are not reused.
+ *
+ * When the cache is full the least recently used segment is removed.
+ */
+class RasterSegmentCache
+{
+public:
+  using Ptr = std::shared_ptr<RasterSegmentCache>;
+  using ConstPtr = std::shared_ptr<const RasterSegmentCache>;
+
+  /** @brief The part of the key shared by all segments of a request */
+  struct ProblemKey
+  {
+    using ConstPtr = std::shared_ptr<const ProblemKey>;
+
+    /** @brief The encoded environment, profiles and profile remapping */
+    std::string content;
+
+    /** @brief The profiles referenced by the content */
+    std::vector<ProfileDictionary::Snapshot::ConstPtr> snapshots;
+  };
+
+  /** @brief The key of a segment */
+  struct Key
+  {
+    /** @brief The hash of the problem and content */
+    std::size_t hash{ 0 };
+
+    /** @brief The encoded segment program and the programs of the segments it depends on */
+    std::string content;
+
+    /** @brief The profile overrides referenced by the content */
+    std::vector<ProfileDictionary::Snapshot::ConstPtr> snapshots;
+
+    /** @brief The problem the segment belongs to */
+    ProblemKey::ConstPtr problem;
+
+    bool operator==(const Key& rhs) const;
+    bool operator!=(const Key& rhs) const;
+  };
+
+  /**
+   * @brief Constructor
+   * @param max_size The maximum number of segments stored
+   */
+  RasterSegmentCache(std::size_t max_size = 1000);
+
+  /**
+   * @brief Create the part of the key shared by all segments of a request
+   * @param problem The problem providing the environment and profiles
+   * @return The problem key
+   */
+  static ProblemKey::ConstPtr createProblemKey(const PlanningTaskComposerProblem& problem);
+
+  /**
+   * @brief Create the key of a segment
+   * @param program The segment program, including the start instruction taken from the previous segment
+   * @param problem_key The key of the problem, see createProblemKey()
+   * @param dependency_keys The keys of the segments the start and end state of the segment are taken from
+   * @return The key
+   */
+  static Key createKey(const CompositeInstruction& program,
+                       ProblemKey::ConstPtr problem_key,
+                       const std::vector<const Key*>& dependency_keys = {});
+
+  /**
+   * @brief Get the planned output of a segment
+   * @param key The segment key
+   * @return The planned output, empty if the segment is not stored
+   */
+  std::optional<CompositeInstruction> get(const Key& key);
+
+  /**
+   * @brief Store the planned output of a segment
+   * @param key The segment key
+   * @param output The planned output
+   */
+  void put(const Key& key, CompositeInstruction output);
+
+  /** @brief Remove all segments */
+  void clear();
+
+  /** @brief The number of segments stored */
+  std::size_t size() const;
+
+  /** @brief The maximum number of segments stored */
+  std::size_t getMaxSize() const;
+
+  /** @brief The number of lookups which found the segment */
+  std::size_t getHits() const;
+
+  /** @brief The number of lookups which did not find the segment */
+  std::size_t getMisses() const;
+
+protected:
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const { return key.hash; }
+  };
+
+  /** @brief The maximum number of segments stored */
+  std::size_t max_size_;
+
+  /** @brief The mutex protecting the entries */
+  mutable std::mutex mutex_;
+
+  /** @brief The keys ordered from the most to the least recently used, pointing into the entries */
+  std::list<const Key*> lru_;
+
+  /** @brief The planned outputs and their position in the usage order */
+  std::unordered_map<Key, std::pair<CompositeInstruction, std::list<const Key*>::iterator>, KeyHash> entries_;
+
+  /** @brief The lookup statistics */
+  std::size_t hits_{ 0 };
+  std::size_t misses_{ 0 };
+};
+
+}  // namespace tesseract_planning
+#endif  // TESSERACT_TASK_COMPOSER_RASTER_SEGMENT_CACHE_H
@@ -56,6 +56,8 @@ public:
   RuckigTrajectorySmoothingTask(RuckigTrajectorySmoothingTask&&) = delete;
   RuckigTrajectorySmoothingTask& operator=(RuckigTrajectorySmoothingTask&&) = delete;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const RuckigTrajectorySmoothingTask& rhs) const;
   bool operator!=(const RuckigTrajectorySmoothingTask& rhs) const;
 
@@ -0,0 +1,76 @@
+/**
+ * @file segment_time_parameterization.h
+ * @brief Time parameterize the segments of a program concurrently
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_SEGMENT_TIME_PARAMETERIZATION_H
+#define TESSERACT_TASK_COMPOSER_SEGMENT_TIME_PARAMETERIZATION_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_input.h>
+#include <tesseract_task_composer/core/task_composer_node.h>
+#include <tesseract_command_language/composite_instruction.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Create the task which time parameterizes a segment given its input key and output key
+ * @details The task should have the same name as the task parameterizing the whole program since tasks look up their
+ * profiles using their name.
+ */
+using SegmentTaskFactory =
+    std::function<TaskComposerNode::UPtr(const std::string& input_key, const std::string& output_key)>;
+
+/**
+ * @brief Check if the program can be time parameterized segment wise
+ * @details Every top level instruction must be a composite instruction containing a move instruction and the first
+ * segment must contain at least two move instructions
+ * @param program The program to check
+ * @return True if it has more than one segment which can be parameterized, otherwise false
+ */
+bool canParameterizeSegments(const CompositeInstruction& program);
+
+/**
+ * @brief Time parameterize each top level segment of the program concurrently and stitch their timing together
+ * @details Every segment after the first is prepended with the last move instruction of the previous segment so it
+ * starts where the previous segment ended. The segments are parameterized independently so the trajectory comes to rest
+ * between segments, which matches parameterizing the whole program when the segments are already decoupled.
+ * @param program The program to time parameterize, on success its segments are replaced with the results
+ * @param input The task input used to run the segment tasks
+ * @param executor The executor the segment tasks are run on
+ * @param segment_task_factory Creates the task which time parameterizes a segment
+ * @return True if every segment was successfully time parameterized, otherwise false and the program is unchanged
+ */
+bool parameterizeSegments(CompositeInstruction& program,
+                          TaskComposerInput& input,
+                          TaskComposerExecutor& executor,
+                          const SegmentTaskFactory& segment_task_factory);
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_SEGMENT_TIME_PARAMETERIZATION_H
@@ -54,6 +54,8 @@ public:
 
   ~UpdateEndStateTask() override = default;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const UpdateEndStateTask& rhs) const;
   bool operator!=(const UpdateEndStateTask& rhs) const;
 
@@ -58,6 +58,8 @@ public:
                                       bool conditional);
   ~UpdateStartAndEndStateTask() override = default;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const UpdateStartAndEndStateTask& rhs) const;
   bool operator!=(const UpdateStartAndEndStateTask& rhs) const;
 
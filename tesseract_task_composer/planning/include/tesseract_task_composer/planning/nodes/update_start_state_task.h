@@ -53,6 +53,8 @@ public:
                                 bool conditional);
   ~UpdateStartStateTask() override = default;
 
+  TaskComposerNode::UPtr clone() const override;
+
   bool operator==(const UpdateStartStateTask& rhs) const;
   bool operator!=(const UpdateStartStateTask& rhs) const;
 
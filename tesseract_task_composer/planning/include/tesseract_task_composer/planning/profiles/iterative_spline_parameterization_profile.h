@@ -50,6 +50,15 @@ struct IterativeSplineParameterizationProfile
 
   /** @brief max_velocity_scaling_factor The max acceleration scaling factor passed to the solver */
   double max_acceleration_scaling_factor{ 1.0 };
+
+  /**
+   * @brief Time parameterize each top level segment of the program concurrently on the executor. Default: false
+   * @details Each segment is parameterized on its own, so the trajectory is forced to come to rest at every segment
+   * boundary even if the whole program would pass through it with a non-zero velocity. The result only matches
+   * parameterizing the whole program when the motion already comes to rest between segments, for example where it
+   * reverses between rasters. Otherwise it is slower than the whole program parameterization.
+   */
+  bool parameterize_segments{ false };
 };
 }  // namespace tesseract_planning
 
@@ -29,6 +29,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_time_parameterization/ruckig/ruckig_trajectory_smoothing.h>
+
 namespace tesseract_planning
 {
 struct RuckigTrajectorySmoothingCompositeProfile
@@ -62,6 +64,12 @@ struct RuckigTrajectorySmoothingCompositeProfile
 
   /** @brief max_jerk_scaling_factor The max jerk scaling factor passed to the solver */
   double max_jerk_scaling_factor{ 1.0 };
+
+  /** @brief How the trajectory is extended when Ruckig is not able to reach a waypoint. Default: GLOBAL */
+  RuckigSmoothingMode smoothing_mode{ RuckigSmoothingMode::GLOBAL };
+
+  /** @brief The number of threads used to check the segments when using RuckigSmoothingMode::LOCAL. Default: 1 */
+  std::size_t num_threads{ 1 };
 };
 
 struct RuckigTrajectorySmoothingMoveProfile
@@ -62,6 +62,31 @@ struct TimeOptimalParameterizationProfile
 
   /** @brief At least one joint must change by greater than this amount for the point to be added. Default: 0.001*/
   double min_angle_change{ 0.001 };
+
+  /** @brief The time step used when integrating, this is the initial time step when adaptive. Default: 0.001 */
+  double time_step{ 0.001 };
+
+  /**
+   * @brief The maximum path velocity error per integration step, if zero a fixed time step is used. Default: 0.0
+   * @details When enabled the time step grows where the path acceleration is nearly constant and shrinks where it
+   * changes quickly, which reduces the number of integration steps of long and slow trajectories.
+   */
+  double adaptive_tolerance{ 0.0 };
+
+  /** @brief The smallest time step allowed when adaptive. Default: 0.00001 */
+  double min_time_step{ 0.00001 };
+
+  /** @brief The largest time step allowed when adaptive. Default: 0.01 */
+  double max_time_step{ 0.01 };
+
+  /**
+   * @brief Time parameterize each top level segment of the program concurrently on the executor. Default: false
+   * @details Each segment is parameterized on its own, so the trajectory is forced to come to rest at every segment
+   * boundary even if the whole program would pass through it with a non-zero velocity. The result only matches
+   * parameterizing the whole program when the motion already comes to rest between segments, for example where it
+   * reverses between rasters. Otherwise it is slower than the whole program parameterization.
+   */
+  bool parameterize_segments{ false };
 };
 
 }  // namespace tesseract_planning
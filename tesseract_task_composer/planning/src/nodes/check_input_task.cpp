@@ -100,6 +100,8 @@ TaskComposerNodeInfo::UPtr CheckInputTask::runImpl(TaskComposerInput& input,
   return info;
 }
 
+TaskComposerNode::UPtr CheckInputTask::clone() const { return cloneAs<CheckInputTask>(); }
+
 bool CheckInputTask::operator==(const CheckInputTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool CheckInputTask::operator!=(const CheckInputTask& rhs) const { return !operator==(rhs); }
 
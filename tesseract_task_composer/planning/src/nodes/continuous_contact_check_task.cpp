@@ -128,6 +128,8 @@ TaskComposerNodeInfo::UPtr ContinuousContactCheckTask::runImpl(TaskComposerInput
   return info;
 }
 
+TaskComposerNode::UPtr ContinuousContactCheckTask::clone() const { return cloneAs<ContinuousContactCheckTask>(); }
+
 bool ContinuousContactCheckTask::operator==(const ContinuousContactCheckTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
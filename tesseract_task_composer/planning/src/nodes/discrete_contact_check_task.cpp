@@ -125,6 +125,8 @@ TaskComposerNodeInfo::UPtr DiscreteContactCheckTask::runImpl(TaskComposerInput&
   return info;
 }
 
+TaskComposerNode::UPtr DiscreteContactCheckTask::clone() const { return cloneAs<DiscreteContactCheckTask>(); }
+
 bool DiscreteContactCheckTask::operator==(const DiscreteContactCheckTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
@@ -223,6 +223,8 @@ TaskComposerNodeInfo::UPtr FixStateBoundsTask::runImpl(TaskComposerInput& input,
   return info;
 }
 
+TaskComposerNode::UPtr FixStateBoundsTask::clone() const { return cloneAs<FixStateBoundsTask>(); }
+
 bool FixStateBoundsTask::operator==(const FixStateBoundsTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool FixStateBoundsTask::operator!=(const FixStateBoundsTask& rhs) const { return !operator==(rhs); }
 
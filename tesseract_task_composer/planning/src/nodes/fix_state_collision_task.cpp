@@ -679,6 +679,8 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerInput& inp
   return info;
 }
 
+TaskComposerNode::UPtr FixStateCollisionTask::clone() const { return cloneAs<FixStateCollisionTask>(); }
+
 bool FixStateCollisionTask::operator==(const FixStateCollisionTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
@@ -147,6 +147,8 @@ TaskComposerNodeInfo::UPtr FormatAsInputTask::runImpl(TaskComposerInput& input,
   return info;
 }
 
+TaskComposerNode::UPtr FormatAsInputTask::clone() const { return cloneAs<FormatAsInputTask>(); }
+
 bool FormatAsInputTask::operator==(const FormatAsInputTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool FormatAsInputTask::operator!=(const FormatAsInputTask& rhs) const { return !operator==(rhs); }
 
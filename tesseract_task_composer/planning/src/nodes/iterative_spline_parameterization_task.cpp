@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_task_composer/planning/nodes/iterative_spline_parameterization_task.h>
+#include <tesseract_task_composer/planning/nodes/segment_time_parameterization.h>
 #include <tesseract_task_composer/planning/profiles/iterative_spline_parameterization_profile.h>
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
 
@@ -89,7 +90,7 @@ IterativeSplineParameterizationTask::IterativeSplineParameterizationTask(
 }
 
 TaskComposerNodeInfo::UPtr IterativeSplineParameterizationTask::runImpl(TaskComposerInput& input,
-                                                                        OptionalTaskComposerExecutor /*executor*/) const
+                                                                        OptionalTaskComposerExecutor executor) const
 {
   // Get the problem
   auto& problem = dynamic_cast<PlanningTaskComposerProblem&>(*input.problem);
@@ -136,24 +137,45 @@ TaskComposerNodeInfo::UPtr IterativeSplineParameterizationTask::runImpl(TaskComp
     return info;
   }
 
+  if (cur_composite_profile->parameterize_segments && executor.has_value() && canParameterizeSegments(ci))
+  {
+    // The segment tasks share this task's name so they resolve the same profiles
+    auto segment_task_factory = [this](const std::string& input_key, const std::string& output_key) {
+      return std::make_unique<IterativeSplineParameterizationTask>(name_, input_key, output_key, false, add_points_);
+    };
+
+    if (!parameterizeSegments(ci, input, executor.value().get(), segment_task_factory))
+    {
+      if (output_keys_[0] != input_keys_[0])
+        input.data_storage.setData(output_keys_[0], input.data_storage.getData(input_keys_[0]));
+
+      info->message = "Failed to perform segment wise iterative spline time parameterization for process input: " +
+                      ci.getDescription();
+      CONSOLE_BRIDGE_logInform("%s", info->message.c_str());
+      return info;
+    }
+
+    info->color = "green";
+    info->message = "Successful";
+    input.data_storage.setData(output_keys_[0], input_data_poly);
+    info->return_value = 1;
+    CONSOLE_BRIDGE_logDebug("Iterative spline time parameterization succeeded");
+    return info;
+  }
+
   Eigen::VectorXd velocity_scaling_factors = Eigen::VectorXd::Ones(static_cast<Eigen::Index>(flattened.size())) *
                                              cur_composite_profile->max_velocity_scaling_factor;
   Eigen::VectorXd acceleration_scaling_factors = Eigen::VectorXd::Ones(static_cast<Eigen::Index>(flattened.size())) *
                                                  cur_composite_profile->max_acceleration_scaling_factor;
 
-  // Loop over all MoveInstructions
+  // Loop over all MoveInstructions, moves without a move profile use the composite profile
+  ProfileResolver<IterativeSplineParameterizationProfile> move_profile_resolver(
+      name_, *problem.profiles, problem.move_profile_remapping, cur_composite_profile);
+  const ProfileTable<IterativeSplineParameterizationProfile> move_profiles(flattened, move_profile_resolver);
   for (Eigen::Index idx = 0; idx < static_cast<Eigen::Index>(flattened.size()); idx++)
   {
-    const auto& mi = flattened[static_cast<std::size_t>(idx)].get().as<MoveInstructionPoly>();
-    std::string move_profile = mi.getProfile();
-
-    // Check for remapping of the plan profile
-    move_profile = getProfileString(name_, profile, problem.move_profile_remapping);
-    auto cur_move_profile = getProfile<IterativeSplineParameterizationProfile>(
-        name_, move_profile, *problem.profiles, std::make_shared<IterativeSplineParameterizationProfile>());
-    //    cur_move_profile = applyProfileOverrides(name_, profile, cur_move_profile, mi.profile_overrides);
-
     // If there is a move profile associated with it, override the parameters
+    const auto& cur_move_profile = move_profiles[static_cast<std::size_t>(idx)];
     if (cur_move_profile)
     {
       velocity_scaling_factors[idx] = cur_move_profile->max_velocity_scaling_factor;
@@ -188,6 +210,14 @@ TaskComposerNodeInfo::UPtr IterativeSplineParameterizationTask::runImpl(TaskComp
   return info;
 }
 
+TaskComposerNode::UPtr IterativeSplineParameterizationTask::clone() const
+{
+  auto task = cloneAs<IterativeSplineParameterizationTask>();
+  task->add_points_ = add_points_;
+  task->solver_ = solver_;
+  return task;
+}
+
 bool IterativeSplineParameterizationTask::operator==(const IterativeSplineParameterizationTask& rhs) const
 {
   bool equal = true;
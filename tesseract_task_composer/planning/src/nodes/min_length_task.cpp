@@ -147,6 +147,8 @@ TaskComposerNodeInfo::UPtr MinLengthTask::runImpl(TaskComposerInput& input,
   return info;
 }
 
+TaskComposerNode::UPtr MinLengthTask::clone() const { return cloneAs<MinLengthTask>(); }
+
 bool MinLengthTask::operator==(const MinLengthTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool MinLengthTask::operator!=(const MinLengthTask& rhs) const { return !operator==(rhs); }
 
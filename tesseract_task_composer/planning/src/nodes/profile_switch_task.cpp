@@ -97,6 +97,8 @@ TaskComposerNodeInfo::UPtr ProfileSwitchTask::runImpl(TaskComposerInput& input,
   return info;
 }
 
+TaskComposerNode::UPtr ProfileSwitchTask::clone() const { return cloneAs<ProfileSwitchTask>(); }
+
 bool ProfileSwitchTask::operator==(const ProfileSwitchTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool ProfileSwitchTask::operator!=(const ProfileSwitchTask& rhs) const { return !operator==(rhs); }
 
@@ -24,6 +24,13 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <optional>
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_task_composer/planning/nodes/raster_motion_task.h>
 #include <tesseract_task_composer/planning/nodes/update_start_and_end_state_task.h>
 #include <tesseract_task_composer/planning/nodes/update_end_state_task.h>
@@ -34,15 +41,36 @@
 #include <tesseract_task_composer/core/nodes/start_task.h>
 #include <tesseract_task_composer/core/task_composer_future.h>
 #include <tesseract_task_composer/core/task_composer_executor.h>
+#include <tesseract_task_composer/core/task_composer_pipeline.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 
 #include <tesseract_command_language/composite_instruction.h>
 
 namespace
 {
+tesseract_planning::TaskComposerNode::ConstPtr
+createPrototype(const std::string& task_name,
+                const std::map<std::string, std::string>& input_remapping,
+                const std::map<std::string, std::string>& output_remapping,
+                const tesseract_planning::TaskComposerPluginFactory& plugin_factory)
+{
+  tesseract_planning::TaskComposerNode::Ptr prototype = plugin_factory.createTaskComposerNode(task_name);
+  if (prototype == nullptr)
+    return nullptr;
+
+  if (!input_remapping.empty())
+    prototype->renameInputKeys(input_remapping);
+
+  if (!output_remapping.empty())
+    prototype->renameOutputKeys(output_remapping);
+
+  return prototype;
+}
+
 tesseract_planning::RasterMotionTask::TaskFactoryResults
 createTask(const std::string& name,
            const std::string& task_name,
+           const tesseract_planning::TaskComposerNode::ConstPtr& prototype,
            const std::map<std::string, std::string>& input_remapping,
            const std::map<std::string, std::string>& output_remapping,
            const std::vector<std::string>& input_indexing,
@@ -51,14 +79,22 @@ createTask(const std::string& name,
            std::size_t index)
 {
   tesseract_planning::RasterMotionTask::TaskFactoryResults tf_results;
-  tf_results.node = plugin_factory.createTaskComposerNode(task_name);
-  tf_results.node->setName(name);
+  if (prototype != nullptr)
+    tf_results.node = prototype->clone();
 
-  if (!input_remapping.empty())
-    tf_results.node->renameInputKeys(input_remapping);
+  // Nodes which do not support cloning are created from their config
+  if (tf_results.node == nullptr)
+  {
+    tf_results.node = plugin_factory.createTaskComposerNode(task_name);
 
-  if (!output_remapping.empty())
-    tf_results.node->renameOutputKeys(output_remapping);
+    if (!input_remapping.empty())
+      tf_results.node->renameInputKeys(input_remapping);
+
+    if (!output_remapping.empty())
+      tf_results.node->renameOutputKeys(output_remapping);
+  }
+
+  tf_results.node->setName(name);
 
   if (!input_indexing.empty())
   {
@@ -95,6 +131,183 @@ createTask(const std::string& name,
 
   return tf_results;
 }
+
+/** @brief A segment of the raster program and what is needed to create the tasks planning it */
+struct RasterSegment
+{
+  /** @brief The name of the segment */
+  std::string name;
+
+  /** @brief The segment program, including the last move instruction of the previous segment */
+  tesseract_planning::CompositeInstruction program;
+
+  /** @brief The factory and index used to create the task planning the segment */
+  const tesseract_planning::RasterMotionTask::TaskFactory* factory{ nullptr };
+  std::size_t index{ 0 };
+
+  /** @brief The segments the start and end state are taken from */
+  std::optional<std::size_t> prev;
+  std::optional<std::size_t> next;
+
+  /** @brief The output key of the segment and its slot in the input data storage */
+  std::string output_key;
+  tesseract_planning::TaskComposerDataStorage::Slot output_slot{ 0 };
+};
+
+/**
+ * @brief Runs the tasks planning a segment in their own abort scope
+ * @details The program and the outputs of the segments it depends on are copied to the scope, and the output is copied
+ * back to the input on success. A failed segment does not abort the input, and a segment is skipped if a segment it
+ * depends on has not been planned.
+ */
+class RasterSegmentTask : public tesseract_planning::TaskComposerTask
+{
+public:
+  RasterSegmentTask(std::string name,
+                    const tesseract_planning::TaskComposerProblem& problem,
+                    std::vector<tesseract_planning::TaskComposerNode::UPtr> nodes,
+                    std::string program_key,
+                    tesseract_common::AnyPoly program,
+                    std::vector<std::string> dependency_keys,
+                    std::string output_key)
+    : TaskComposerTask(std::move(name), false)
+    , problem_(problem)
+    , nodes_(std::move(nodes))
+    , program_key_(std::move(program_key))
+    , program_(std::move(program))
+  {
+    input_keys_ = std::move(dependency_keys);
+    output_keys_.push_back(std::move(output_key));
+  }
+
+protected:
+  tesseract_planning::TaskComposerNodeInfo::UPtr
+  runImpl(tesseract_planning::TaskComposerInput& input,
+          tesseract_planning::OptionalTaskComposerExecutor executor) const override final
+  {
+    using namespace tesseract_planning;
+
+    auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+    info->return_value = 0;
+
+    for (const auto& key : input_keys_)
+    {
+      if (!input.data_storage.hasKey(key))
+      {
+        info->message = "Skipped, a segment it depends on was not planned";
+        CONSOLE_BRIDGE_logDebug("%s: %s", name_.c_str(), info->message.c_str());
+        return info;
+      }
+    }
+
+    TaskComposerInput segment_input(problem_.clone(), input);
+    segment_input.data_storage.setData(program_key_, program_);
+    for (const auto& key : input_keys_)
+      segment_input.data_storage.setData(key, input.data_storage.getData(key));
+
+    for (const auto& node : nodes_)
+    {
+      if (const auto* pipeline = dynamic_cast<const TaskComposerPipeline*>(node.get()))
+        pipeline->run(segment_input, executor);
+      else if (const auto* task = dynamic_cast<const TaskComposerTask*>(node.get()))
+        task->run(segment_input, executor);
+      else
+        executor.value().get().run(*node, segment_input)->wait();
+
+      auto node_info = segment_input.task_infos.getInfo(node->getUUID());
+      if (node_info == nullptr || node_info->return_value == 0 || segment_input.isAborted())
+        break;
+    }
+
+    // Keep the infos of the segment so they show up in the dot graph
+    auto info_map = segment_input.task_infos.getInfoMap();
+    if (input.dotgraph)
+    {
+      std::stringstream dot_graph;
+      std::stringstream sub_graphs;
+      dot_graph << "subgraph cluster_" << toString(uuid_) << " {\n color=black;\n label = \"" << name_ << "\\n("
+                << uuid_str_ << ")\";\n";
+      for (const auto& node : nodes_)
+        sub_graphs << node->dump(dot_graph, this, info_map);
+      dot_graph << "}\n" << sub_graphs.str();
+      info->dotgraph = dot_graph.str();
+    }
+
+    for (auto& pair : info_map)
+      input.task_infos.addInfo(std::move(pair.second));
+
+    tesseract_common::AnyPoly output = segment_input.data_storage.getData(output_keys_[0]);
+    if (segment_input.isAborted() || output.isNull())
+    {
+      info->color = "red";
+      info->message = "Failed";
+      return info;
+    }
+
+    input.data_storage.setData(output_keys_[0], std::move(output));
+    info->color = "green";
+    info->message = "Successful";
+    info->return_value = 1;
+    return info;
+  }
+
+private:
+  const tesseract_planning::TaskComposerProblem& problem_;
+  std::vector<tesseract_planning::TaskComposerNode::UPtr> nodes_;
+  std::string program_key_;
+  tesseract_common::AnyPoly program_;
+};
+
+/** @brief Create the task planning a segment, updating its start and end state from the segments it depends on */
+tesseract_planning::TaskComposerNode::UPtr
+createSegmentTask(const std::vector<RasterSegment>& segments,
+                  std::size_t idx,
+                  tesseract_planning::RasterMotionTask::TaskFactoryResults results,
+                  const tesseract_planning::TaskComposerProblem& problem)
+{
+  using namespace tesseract_planning;
+
+  const RasterSegment& segment = segments[idx];
+  std::vector<TaskComposerNode::UPtr> nodes;
+  std::vector<std::string> dependency_keys;
+  std::string program_key = results.input_key;
+  if (segment.prev.has_value() && segment.next.has_value())
+  {
+    const std::string& prev_output = segments[segment.prev.value()].output_key;
+    const std::string& next_output = segments[segment.next.value()].output_key;
+    auto mux_task = std::make_unique<UpdateStartAndEndStateTask>(
+        "UpdateStartAndEndStateTask", prev_output, next_output, results.input_key, false);
+    program_key = mux_task->getUUIDString();
+    nodes.push_back(std::move(mux_task));
+    dependency_keys = { prev_output, next_output };
+  }
+  else if (segment.next.has_value())
+  {
+    const std::string& next_output = segments[segment.next.value()].output_key;
+    auto mux_task = std::make_unique<UpdateEndStateTask>("UpdateEndStateTask", next_output, results.input_key, false);
+    program_key = mux_task->getUUIDString();
+    nodes.push_back(std::move(mux_task));
+    dependency_keys = { next_output };
+  }
+  else if (segment.prev.has_value())
+  {
+    const std::string& prev_output = segments[segment.prev.value()].output_key;
+    auto mux_task =
+        std::make_unique<UpdateStartStateTask>("UpdateStartStateTask", prev_output, results.input_key, false);
+    program_key = mux_task->getUUIDString();
+    nodes.push_back(std::move(mux_task));
+    dependency_keys = { prev_output };
+  }
+  nodes.push_back(std::move(results.node));
+
+  return std::make_unique<RasterSegmentTask>(segment.name,
+                                             problem,
+                                             std::move(nodes),
+                                             std::move(program_key),
+                                             segment.program,
+                                             std::move(dependency_keys),
+                                             results.output_key);
+}
 }  // namespace
 
 namespace tesseract_planning
@@ -106,11 +319,15 @@ RasterMotionTask::RasterMotionTask(std::string name,
                                    bool conditional,
                                    TaskFactory freespace_task_factory,
                                    TaskFactory raster_task_factory,
-                                   TaskFactory transition_task_factory)
+                                   TaskFactory transition_task_factory,
+                                   std::size_t max_segment_retries,
+                                   RasterSegmentCache::Ptr segment_cache)
   : TaskComposerTask(std::move(name), conditional)
   , freespace_task_factory_(std::move(freespace_task_factory))
   , raster_task_factory_(std::move(raster_task_factory))
   , transition_task_factory_(std::move(transition_task_factory))
+  , max_segment_retries_(max_segment_retries)
+  , segment_cache_(std::move(segment_cache))
 {
   input_keys_.push_back(std::move(input_key));
   output_keys_.push_back(std::move(output_key));
@@ -133,6 +350,16 @@ RasterMotionTask::RasterMotionTask(std::string name,
   if (output_keys_.size() > 1)
     throw std::runtime_error("RasterMotionTask, config 'outputs' entry currently only supports one output key");
 
+  if (YAML::Node n = config["max_segment_retries"])
+    max_segment_retries_ = n.as<std::size_t>();
+
+  if (YAML::Node n = config["segment_cache_size"])
+  {
+    const auto segment_cache_size = n.as<std::size_t>();
+    if (segment_cache_size > 0)
+      segment_cache_ = std::make_shared<RasterSegmentCache>(segment_cache_size);
+  }
+
   if (YAML::Node freespace_config = config["freespace"])
   {
     std::string task_name;
@@ -169,14 +396,23 @@ RasterMotionTask::RasterMotionTask(std::string name,
       throw std::runtime_error("RasterMotionTask, entry 'freespace' missing 'config' entry");
     }
 
+    auto prototype = createPrototype(task_name, input_remapping, output_remapping, plugin_factory);
     freespace_task_factory_ = [task_name,
+                               prototype,
                                input_remapping,
                                output_remapping,
                                input_indexing,
                                output_indexing,
                                &plugin_factory](const std::string& name, std::size_t index) {
-      return createTask(
-          name, task_name, input_remapping, output_remapping, input_indexing, output_indexing, plugin_factory, index);
+      return createTask(name,
+                        task_name,
+                        prototype,
+                        input_remapping,
+                        output_remapping,
+                        input_indexing,
+                        output_indexing,
+                        plugin_factory,
+                        index);
     };
   }
   else
@@ -220,14 +456,23 @@ RasterMotionTask::RasterMotionTask(std::string name,
       throw std::runtime_error("RasterMotionTask, entry 'raster' missing 'config' entry");
     }
 
+    auto prototype = createPrototype(task_name, input_remapping, output_remapping, plugin_factory);
     raster_task_factory_ = [task_name,
+                            prototype,
                             input_remapping,
                             output_remapping,
                             input_indexing,
                             output_indexing,
                             &plugin_factory](const std::string& name, std::size_t index) {
-      return createTask(
-          name, task_name, input_remapping, output_remapping, input_indexing, output_indexing, plugin_factory, index);
+      return createTask(name,
+                        task_name,
+                        prototype,
+                        input_remapping,
+                        output_remapping,
+                        input_indexing,
+                        output_indexing,
+                        plugin_factory,
+                        index);
     };
   }
   else
@@ -271,14 +516,23 @@ RasterMotionTask::RasterMotionTask(std::string name,
       throw std::runtime_error("RasterMotionTask, entry 'transition' missing 'config' entry");
     }
 
+    auto prototype = createPrototype(task_name, input_remapping, output_remapping, plugin_factory);
     transition_task_factory_ = [task_name,
+                                prototype,
                                 input_remapping,
                                 output_remapping,
                                 input_indexing,
                                 output_indexing,
                                 &plugin_factory](const std::string& name, std::size_t index) {
-      return createTask(
-          name, task_name, input_remapping, output_remapping, input_indexing, output_indexing, plugin_factory, index);
+      return createTask(name,
+                        task_name,
+                        prototype,
+                        input_remapping,
+                        output_remapping,
+                        input_indexing,
+                        output_indexing,
+                        plugin_factory,
+                        index);
     };
   }
   else
@@ -287,13 +541,38 @@ RasterMotionTask::RasterMotionTask(std::string name,
   }
 }
 
-bool RasterMotionTask::operator==(const RasterMotionTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
+TaskComposerNode::UPtr RasterMotionTask::clone() const
+{
+  auto task = cloneAs<RasterMotionTask>();
+  task->freespace_task_factory_ = freespace_task_factory_;
+  task->raster_task_factory_ = raster_task_factory_;
+  task->transition_task_factory_ = transition_task_factory_;
+  task->max_segment_retries_ = max_segment_retries_;
+  task->segment_cache_ = segment_cache_;
+  return task;
+}
+
+std::size_t RasterMotionTask::getMaxSegmentRetries() const { return max_segment_retries_; }
+
+RasterSegmentCache::Ptr RasterMotionTask::getSegmentCache() const { return segment_cache_; }
+
+bool RasterMotionTask::operator==(const RasterMotionTask& rhs) const
+{
+  bool equal = true;
+  equal &= (max_segment_retries_ == rhs.max_segment_retries_);
+  equal &= TaskComposerTask::operator==(rhs);
+  return equal;
+}
 bool RasterMotionTask::operator!=(const RasterMotionTask& rhs) const { return !operator==(rhs); }
 
 template <class Archive>
-void RasterMotionTask::serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
+void RasterMotionTask::serialize(Archive& ar, const unsigned int version)  // NOLINT
 {
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerTask);
+
+  // Version 0 archives were written before segment retries were added
+  if (version >= 1)
+    ar& boost::serialization::make_nvp("max_segment_retries", max_segment_retries_);
 }
 
 TaskComposerNodeInfo::UPtr RasterMotionTask::runImpl(TaskComposerInput& input,
@@ -322,176 +601,227 @@ TaskComposerNodeInfo::UPtr RasterMotionTask::runImpl(TaskComposerInput& input,
   }
 
   auto& program = input_data_poly.template as<CompositeInstruction>();
-  TaskComposerGraph task_graph;
 
   tesseract_common::ManipulatorInfo program_manip_info = program.getManipulatorInfo().getCombined(problem.manip_info);
 
-  auto start_task = std::make_unique<StartTask>();
-  auto start_uuid = task_graph.addNode(std::move(start_task));
-
-  std::vector<std::pair<boost::uuids::uuid, std::pair<std::string, std::string>>> raster_tasks;
-  raster_tasks.reserve(program.size());
-
-  // Generate all of the raster tasks. They don't depend on anything
+  // The segments are stored in program order, so the rasters are at the odd indices
+  std::vector<RasterSegment> segments(program.size());
   std::size_t raster_idx = 0;
-  for (std::size_t idx = 1; idx < program.size() - 1; idx += 2)
+  std::size_t transition_idx = 0;
+  for (std::size_t idx = 0; idx < program.size(); ++idx)
   {
-    // Get Raster program
-    auto raster_input = program[idx].template as<CompositeInstruction>();
-
-    // Set the manipulator info
-    raster_input.setManipulatorInfo(raster_input.getManipulatorInfo().getCombined(program_manip_info));
+    RasterSegment& segment = segments[idx];
+    segment.program = program[idx].template as<CompositeInstruction>();
+    segment.program.setManipulatorInfo(segment.program.getManipulatorInfo().getCombined(program_manip_info));
 
     // Get Start Plan Instruction
-    const InstructionPoly& pre_input_instruction = program[idx - 1];
-    assert(pre_input_instruction.isCompositeInstruction());
-    const auto& tci = pre_input_instruction.as<CompositeInstruction>();
-    const auto* li = tci.getLastMoveInstruction();
-    assert(li != nullptr);
-    raster_input.insertMoveInstruction(raster_input.begin(), *li);
-
-    const std::string task_name = "Raster #" + std::to_string(raster_idx + 1) + ": " + raster_input.getDescription();
-    auto raster_results = raster_task_factory_(task_name, raster_idx + 1);
-    auto raster_uuid = task_graph.addNode(std::move(raster_results.node));
-    raster_tasks.emplace_back(raster_uuid, std::make_pair(raster_results.input_key, raster_results.output_key));
-    input.data_storage.setData(raster_results.input_key, raster_input);
-
-    task_graph.addEdges(start_uuid, { raster_uuid });
-
-    raster_idx++;
+    if (idx > 0)
+    {
+      const InstructionPoly& pre_input_instruction = program[idx - 1];
+      assert(pre_input_instruction.isCompositeInstruction());
+      const auto& tci = pre_input_instruction.as<CompositeInstruction>();
+      const auto* li = tci.getLastMoveInstruction();
+      assert(li != nullptr);
+      segment.program.insertMoveInstruction(segment.program.begin(), *li);
+    }
+
+    if (idx == 0)
+    {
+      segment.name = "From Start: " + segment.program.getDescription();
+      segment.factory = &freespace_task_factory_;
+      segment.index = 1;
+      segment.next = 1;
+    }
+    else if (idx == program.size() - 1)
+    {
+      segment.name = "To End: " + segment.program.getDescription();
+      segment.factory = &freespace_task_factory_;
+      segment.index = 2;
+      segment.prev = idx - 1;
+    }
+    else if (idx % 2 == 1)
+    {
+      segment.name = "Raster #" + std::to_string(raster_idx + 1) + ": " + segment.program.getDescription();
+      segment.factory = &raster_task_factory_;
+      segment.index = ++raster_idx;
+    }
+    else
+    {
+      segment.name = "Transition #" + std::to_string(transition_idx + 1) + ": " + segment.program.getDescription();
+      segment.factory = &transition_task_factory_;
+      segment.index = ++transition_idx;
+      segment.prev = idx - 1;
+      segment.next = idx + 1;
+    }
   }
 
-  // Loop over all transitions
-  std::vector<std::pair<std::string, std::string>> transition_keys;
-  transition_keys.reserve(program.size());
-  std::size_t transition_idx = 0;
-  for (std::size_t idx = 2; idx < program.size() - 2; idx += 2)
+  // The segments only need the problem for the environment and profiles, so the input data is not copied to them
+  TaskComposerProblem::UPtr segment_problem = input.problem->clone();
+  segment_problem->input_data.clear();
+
+  std::stringstream dot_graph;
+  if (input.dotgraph)
   {
-    // Get transition program
-    auto transition_input = program[idx].template as<CompositeInstruction>();
+    dot_graph << "subgraph cluster_" << toString(uuid_) << " {\n color=black;\n label = \"" << name_ << "\\n("
+              << uuid_str_ << ")\";\n";
+  }
 
-    // Set the manipulator info
-    transition_input.setManipulatorInfo(transition_input.getManipulatorInfo().getCombined(program_manip_info));
+  // Reuse the outputs of the segments which did not change since they were planned. The rasters are keyed and looked
+  // up first since the other segments take their start and end state from them. A dependent segment is only reused if
+  // the rasters it depends on were reused, otherwise it would not match the start and end state of a replanned raster.
+  std::vector<bool> planned(segments.size(), false);
+  std::vector<RasterSegmentCache::Key> segment_keys;
+  if (segment_cache_ != nullptr)
+  {
+    RasterSegmentCache::ProblemKey::ConstPtr problem_key = RasterSegmentCache::createProblemKey(problem);
+    segment_keys.resize(segments.size());
+    for (std::size_t idx = 1; idx < segments.size() - 1; idx += 2)
+      segment_keys[idx] = RasterSegmentCache::createKey(segments[idx].program, problem_key);
 
-    // Get Start Plan Instruction
-    const InstructionPoly& pre_input_instruction = program[idx - 1];
-    assert(pre_input_instruction.isCompositeInstruction());
-    const auto& tci = pre_input_instruction.as<CompositeInstruction>();
-    const auto* li = tci.getLastMoveInstruction();
-    assert(li != nullptr);
-    transition_input.insertMoveInstruction(transition_input.begin(), *li);
-
-    const std::string task_name =
-        "Transition #" + std::to_string(transition_idx + 1) + ": " + transition_input.getDescription();
-    auto transition_results = transition_task_factory_(task_name, transition_idx + 1);
-    auto transition_uuid = task_graph.addNode(std::move(transition_results.node));
-    transition_keys.emplace_back(std::make_pair(transition_results.input_key, transition_results.output_key));
-
-    const auto& prev = raster_tasks[transition_idx];
-    const auto& next = raster_tasks[transition_idx + 1];
-    const auto& prev_output = prev.second.second;
-    const auto& next_output = next.second.second;
-    auto transition_mux_task = std::make_unique<UpdateStartAndEndStateTask>(
-        "UpdateStartAndEndStateTask", prev_output, next_output, transition_results.input_key, false);
-    std::string transition_mux_key = transition_mux_task->getUUIDString();
-    auto transition_mux_uuid = task_graph.addNode(std::move(transition_mux_task));
-
-    input.data_storage.setData(transition_mux_key, transition_input);
-
-    task_graph.addEdges(transition_mux_uuid, { transition_uuid });
-    task_graph.addEdges(prev.first, { transition_mux_uuid });
-    task_graph.addEdges(next.first, { transition_mux_uuid });
-
-    transition_idx++;
-  }
+    for (std::size_t idx = 0; idx < segments.size(); idx += 2)
+    {
+      std::vector<const RasterSegmentCache::Key*> dependency_keys;
+      for (const auto& dependency : { segments[idx].prev, segments[idx].next })
+      {
+        if (dependency.has_value())
+          dependency_keys.push_back(&segment_keys[dependency.value()]);
+      }
+      segment_keys[idx] = RasterSegmentCache::createKey(segments[idx].program, problem_key, dependency_keys);
+    }
 
-  // Plan from_start - preceded by the first raster
-  auto from_start_input = program[0].template as<CompositeInstruction>();
-  from_start_input.setManipulatorInfo(from_start_input.getManipulatorInfo().getCombined(program_manip_info));
+    auto reuse = [this, &input, &segments, &segment_keys, &planned](std::size_t idx) {
+      std::optional<CompositeInstruction> output = segment_cache_->get(segment_keys[idx]);
+      if (!output.has_value())
+        return;
+
+      // The reused output is stored under a key of its own, the segments which depend on it read it from there
+      RasterSegment& segment = segments[idx];
+      segment.output_key = uuid_str_ + "_segment_" + std::to_string(idx);
+      segment.output_slot = input.data_storage.getSlot(segment.output_key);
+      input.data_storage.setData(segment.output_slot, std::move(output.value()));
+      planned[idx] = true;
+    };
 
-  auto from_start_results = freespace_task_factory_("From Start: " + from_start_input.getDescription(), 1);
-  auto from_start_pipeline_uuid = task_graph.addNode(std::move(from_start_results.node));
+    for (std::size_t idx = 1; idx < segments.size() - 1; idx += 2)
+      reuse(idx);
 
-  const auto& first_raster_output_key = raster_tasks[0].second.second;
-  auto update_end_state_task = std::make_unique<UpdateEndStateTask>(
-      "UpdateEndStateTask", first_raster_output_key, from_start_results.input_key, false);
-  std::string update_end_state_key = update_end_state_task->getUUIDString();
-  auto update_end_state_uuid = task_graph.addNode(std::move(update_end_state_task));
+    for (std::size_t idx = 0; idx < segments.size(); idx += 2)
+    {
+      const RasterSegment& segment = segments[idx];
+      if ((!segment.prev.has_value() || planned[segment.prev.value()]) &&
+          (!segment.next.has_value() || planned[segment.next.value()]))
+        reuse(idx);
+    }
 
-  input.data_storage.setData(update_end_state_key, from_start_input);
+    CONSOLE_BRIDGE_logDebug("RasterMotionTask, reused %zu of %zu segments",
+                            static_cast<std::size_t>(std::count(planned.begin(), planned.end(), true)),
+                            segments.size());
+  }
 
-  task_graph.addEdges(update_end_state_uuid, { from_start_pipeline_uuid });
-  task_graph.addEdges(raster_tasks[0].first, { update_end_state_uuid });
+  // Each segment runs in its own abort scope, so a failed segment only skips the segments which depend on it. The
+  // successful segments are kept and the others are replanned until no segment fails or the retries are exhausted.
+  std::vector<std::size_t> failed;
+  for (std::size_t attempt = 0; attempt <= max_segment_retries_; ++attempt)
+  {
+    if (attempt > 0)
+      CONSOLE_BRIDGE_logInform("RasterMotionTask, replanning %zu failed segments", failed.size());
+
+    TaskComposerGraph task_graph((attempt == 0) ? "TaskComposerGraph" : "Retry #" + std::to_string(attempt));
+    auto start_uuid = task_graph.addNode(std::make_unique<StartTask>());
 
-  // Plan to_end - preceded by the last raster
-  auto to_end_input = program.back().template as<CompositeInstruction>();
+    // The output keys of all segments must be known before creating the tasks which depend on them. The output slots
+    // are resolved while building the graph so the results are retrieved without hashing the keys.
+    std::vector<TaskFactoryResults> segment_results(segments.size());
+    for (std::size_t idx = 0; idx < segments.size(); ++idx)
+    {
+      if (planned[idx])
+        continue;
 
-  to_end_input.setManipulatorInfo(to_end_input.getManipulatorInfo().getCombined(program_manip_info));
+      RasterSegment& segment = segments[idx];
+      segment_results[idx] = (*segment.factory)(segment.name, segment.index);
+      segment.output_key = segment_results[idx].output_key;
+      segment.output_slot = input.data_storage.getSlot(segment.output_key);
+    }
 
-  // Get Start Plan Instruction
-  const InstructionPoly& pre_input_instruction = program[program.size() - 2];
-  assert(pre_input_instruction.isCompositeInstruction());
-  const auto& tci = pre_input_instruction.as<CompositeInstruction>();
-  const auto* li = tci.getLastMoveInstruction();
-  assert(li != nullptr);
-  to_end_input.insertMoveInstruction(to_end_input.begin(), *li);
+    std::vector<std::optional<boost::uuids::uuid>> segment_uuids(segments.size());
+    for (std::size_t idx = 0; idx < segments.size(); ++idx)
+    {
+      if (planned[idx])
+        continue;
 
-  auto to_end_results = freespace_task_factory_("To End: " + to_end_input.getDescription(), 2);
-  auto to_end_pipeline_uuid = task_graph.addNode(std::move(to_end_results.node));
+      segment_uuids[idx] =
+          task_graph.addNode(createSegmentTask(segments, idx, std::move(segment_results[idx]), *segment_problem));
+    }
 
-  const auto& last_raster_output_key = raster_tasks.back().second.second;
-  auto update_start_state_task = std::make_unique<UpdateStartStateTask>(
-      "UpdateStartStateTask", last_raster_output_key, to_end_results.input_key, false);
-  std::string update_start_state_key = update_start_state_task->getUUIDString();
-  auto update_start_state_uuid = task_graph.addNode(std::move(update_start_state_task));
+    for (std::size_t idx = 0; idx < segments.size(); ++idx)
+    {
+      if (!segment_uuids[idx].has_value())
+        continue;
+
+      bool has_dependency{ false };
+      for (const auto& dependency : { segments[idx].prev, segments[idx].next })
+      {
+        if (dependency.has_value() && segment_uuids[dependency.value()].has_value())
+        {
+          task_graph.addEdges(segment_uuids[dependency.value()].value(), { segment_uuids[idx].value() });
+          has_dependency = true;
+        }
+      }
+
+      if (!has_dependency)
+        task_graph.addEdges(start_uuid, { segment_uuids[idx].value() });
+    }
 
-  input.data_storage.setData(update_start_state_key, to_end_input);
+    TaskComposerFuture::UPtr future = executor.value().get().run(task_graph, input);
+    future->wait();
 
-  task_graph.addEdges(update_start_state_uuid, { to_end_pipeline_uuid });
-  task_graph.addEdges(raster_tasks.back().first, { update_start_state_uuid });
+    failed.clear();
+    for (std::size_t idx = 0; idx < segments.size(); ++idx)
+    {
+      if (!segment_uuids[idx].has_value())
+        continue;
+
+      auto segment_info = input.task_infos.getInfo(segment_uuids[idx].value());
+      planned[idx] = (segment_info != nullptr && segment_info->return_value != 0);
+      if (!planned[idx])
+        failed.push_back(idx);
+      else if (segment_cache_ != nullptr)
+        segment_cache_->put(segment_keys[idx],
+                            input.data_storage.getData(segments[idx].output_slot).as<CompositeInstruction>());
+    }
 
-  TaskComposerFuture::UPtr future = executor.value().get().run(task_graph, input);
-  future->wait();
+    if (input.dotgraph)
+      task_graph.dump(dot_graph, this, input.task_infos.getInfoMap());  // dump the graph including dynamic tasks
 
-  auto info_map = input.task_infos.getInfoMap();
+    if (failed.empty() || input.isAborted())
+      break;
+  }
 
   if (input.dotgraph)
   {
-    std::stringstream dot_graph;
-    dot_graph << "subgraph cluster_" << toString(uuid_) << " {\n color=black;\n label = \"" << name_ << "\\n("
-              << uuid_str_ << ")\";\n";
-    task_graph.dump(dot_graph, this, info_map);  // dump the graph including dynamic tasks
     dot_graph << "}\n";
     info->dotgraph = dot_graph.str();
   }
 
-  if (input.isAborted())
+  if (!failed.empty())
   {
-    info->message = "Raster subgraph failed";
+    info->message = "Raster subgraph failed, failed segments:";
+    for (std::size_t idx : failed)
+      info->message += " '" + segments[idx].name + "'";
+
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
     return info;
   }
 
   program.clear();
-  program.emplace_back(input.data_storage.getData(from_start_results.output_key).as<CompositeInstruction>());
-  for (std::size_t i = 0; i < raster_tasks.size(); ++i)
+  for (std::size_t idx = 0; idx < segments.size(); ++idx)
   {
-    const auto& raster_output_key = raster_tasks[i].second.second;
-    CompositeInstruction segment = input.data_storage.getData(raster_output_key).as<CompositeInstruction>();
-    segment.erase(segment.begin());
-    program.emplace_back(segment);
+    CompositeInstruction segment = input.data_storage.getData(segments[idx].output_slot).as<CompositeInstruction>();
+    if (idx > 0)
+      segment.erase(segment.begin());
 
-    if (i < raster_tasks.size() - 1)
-    {
-      const auto& transition_output_key = transition_keys[i].second;
-      CompositeInstruction transition = input.data_storage.getData(transition_output_key).as<CompositeInstruction>();
-      transition.erase(transition.begin());
-      program.emplace_back(transition);
-    }
+    program.emplace_back(segment);
   }
-  CompositeInstruction to_end = input.data_storage.getData(to_end_results.output_key).as<CompositeInstruction>();
-  to_end.erase(to_end.begin());
-  program.emplace_back(to_end);
 
   input.data_storage.setData(output_keys_[0], program);
 
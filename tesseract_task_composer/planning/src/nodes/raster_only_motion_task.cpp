@@ -40,9 +40,29 @@
 
 namespace
 {
+tesseract_planning::TaskComposerNode::ConstPtr
+createPrototype(const std::string& task_name,
+                const std::map<std::string, std::string>& input_remapping,
+                const std::map<std::string, std::string>& output_remapping,
+                const tesseract_planning::TaskComposerPluginFactory& plugin_factory)
+{
+  tesseract_planning::TaskComposerNode::Ptr prototype = plugin_factory.createTaskComposerNode(task_name);
+  if (prototype == nullptr)
+    return nullptr;
+
+  if (!input_remapping.empty())
+    prototype->renameInputKeys(input_remapping);
+
+  if (!output_remapping.empty())
+    prototype->renameOutputKeys(output_remapping);
+
+  return prototype;
+}
+
 tesseract_planning::RasterOnlyMotionTask::TaskFactoryResults
 createTask(const std::string& name,
            const std::string& task_name,
+           const tesseract_planning::TaskComposerNode::ConstPtr& prototype,
            const std::map<std::string, std::string>& input_remapping,
            const std::map<std::string, std::string>& output_remapping,
            const std::vector<std::string>& input_indexing,
@@ -51,14 +71,22 @@ createTask(const std::string& name,
            std::size_t index)
 {
   tesseract_planning::RasterOnlyMotionTask::TaskFactoryResults tf_results;
-  tf_results.node = plugin_factory.createTaskComposerNode(task_name);
-  tf_results.node->setName(name);
+  if (prototype != nullptr)
+    tf_results.node = prototype->clone();
 
-  if (!input_remapping.empty())
-    tf_results.node->renameInputKeys(input_remapping);
+  // Nodes which do not support cloning are created from their config
+  if (tf_results.node == nullptr)
+  {
+    tf_results.node = plugin_factory.createTaskComposerNode(task_name);
 
-  if (!output_remapping.empty())
-    tf_results.node->renameOutputKeys(output_remapping);
+    if (!input_remapping.empty())
+      tf_results.node->renameInputKeys(input_remapping);
+
+    if (!output_remapping.empty())
+      tf_results.node->renameOutputKeys(output_remapping);
+  }
+
+  tf_results.node->setName(name);
 
   if (!input_indexing.empty())
   {
@@ -167,14 +195,23 @@ RasterOnlyMotionTask::RasterOnlyMotionTask(std::string name,
       throw std::runtime_error("RasterOnlyMotionTask, entry 'raster' missing 'config' entry");
     }
 
+    auto prototype = createPrototype(task_name, input_remapping, output_remapping, plugin_factory);
     raster_task_factory_ = [task_name,
+                            prototype,
                             input_remapping,
                             output_remapping,
                             input_indexing,
                             output_indexing,
                             &plugin_factory](const std::string& name, std::size_t index) {
-      return createTask(
-          name, task_name, input_remapping, output_remapping, input_indexing, output_indexing, plugin_factory, index);
+      return createTask(name,
+                        task_name,
+                        prototype,
+                        input_remapping,
+                        output_remapping,
+                        input_indexing,
+                        output_indexing,
+                        plugin_factory,
+                        index);
     };
   }
   else
@@ -218,14 +255,23 @@ RasterOnlyMotionTask::RasterOnlyMotionTask(std::string name,
       throw std::runtime_error("RasterOnlyMotionTask, entry 'transition' missing 'config' entry");
     }
 
+    auto prototype = createPrototype(task_name, input_remapping, output_remapping, plugin_factory);
     transition_task_factory_ = [task_name,
+                                prototype,
                                 input_remapping,
                                 output_remapping,
                                 input_indexing,
                                 output_indexing,
                                 &plugin_factory](const std::string& name, std::size_t index) {
-      return createTask(
-          name, task_name, input_remapping, output_remapping, input_indexing, output_indexing, plugin_factory, index);
+      return createTask(name,
+                        task_name,
+                        prototype,
+                        input_remapping,
+                        output_remapping,
+                        input_indexing,
+                        output_indexing,
+                        plugin_factory,
+                        index);
     };
   }
   else
@@ -234,6 +280,14 @@ RasterOnlyMotionTask::RasterOnlyMotionTask(std::string name,
   }
 }
 
+TaskComposerNode::UPtr RasterOnlyMotionTask::clone() const
+{
+  auto task = cloneAs<RasterOnlyMotionTask>();
+  task->raster_task_factory_ = raster_task_factory_;
+  task->transition_task_factory_ = transition_task_factory_;
+  return task;
+}
+
 bool RasterOnlyMotionTask::operator==(const RasterOnlyMotionTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
@@ -282,6 +336,10 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerInput& inpu
   std::vector<std::pair<boost::uuids::uuid, std::pair<std::string, std::string>>> raster_tasks;
   raster_tasks.reserve(program.size());
 
+  // The output slots are resolved while building the graph so the results are retrieved without hashing the keys
+  std::vector<TaskComposerDataStorage::Slot> raster_output_slots;
+  raster_output_slots.reserve(program.size());
+
   // Generate all of the raster tasks. They don't depend on anything
   std::size_t raster_idx = 0;
   for (std::size_t idx = 0; idx < program.size(); idx += 2)
@@ -307,6 +365,7 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerInput& inpu
     auto raster_results = raster_task_factory_(task_name, raster_idx + 1);
     auto raster_uuid = task_graph.addNode(std::move(raster_results.node));
     raster_tasks.emplace_back(raster_uuid, std::make_pair(raster_results.input_key, raster_results.output_key));
+    raster_output_slots.push_back(input.data_storage.getSlot(raster_results.output_key));
     input.data_storage.setData(raster_results.input_key, raster_input);
 
     task_graph.addEdges(start_uuid, { raster_uuid });
@@ -315,8 +374,8 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerInput& inpu
   }
 
   // Loop over all transitions
-  std::vector<std::pair<std::string, std::string>> transition_keys;
-  transition_keys.reserve(program.size());
+  std::vector<TaskComposerDataStorage::Slot> transition_output_slots;
+  transition_output_slots.reserve(program.size());
   std::size_t transition_idx = 0;
   for (std::size_t idx = 1; idx < program.size() - 1; idx += 2)
   {
@@ -337,7 +396,7 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerInput& inpu
         "Transition #" + std::to_string(transition_idx + 1) + ": " + transition_input.getDescription();
     auto transition_results = transition_task_factory_(task_name, transition_idx + 1);
     auto transition_uuid = task_graph.addNode(std::move(transition_results.node));
-    transition_keys.emplace_back(std::make_pair(transition_results.input_key, transition_results.output_key));
+    transition_output_slots.push_back(input.data_storage.getSlot(transition_results.output_key));
 
     const auto& prev = raster_tasks[transition_idx];
     const auto& next = raster_tasks[transition_idx + 1];
@@ -382,7 +441,7 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerInput& inpu
   program.clear();
   for (std::size_t i = 0; i < raster_tasks.size(); ++i)
   {
-    CompositeInstruction segment = input.data_storage.getData(raster_tasks[i].second.second).as<CompositeInstruction>();
+    CompositeInstruction segment = input.data_storage.getData(raster_output_slots[i]).as<CompositeInstruction>();
     if (i != 0)
       segment.erase(segment.begin());
 
@@ -391,7 +450,7 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerInput& inpu
     if (i < raster_tasks.size() - 1)
     {
       CompositeInstruction transition =
-          input.data_storage.getData(transition_keys[i].second).as<CompositeInstruction>();
+          input.data_storage.getData(transition_output_slots[i]).as<CompositeInstruction>();
       transition.erase(transition.begin());
       program.emplace_back(transition);
     }
@@ -0,0 +1,388 @@
+/**
+ * @file raster_segment_cache.cpp
+ * @brief A cache of planned raster program segments
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/functional/hash.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/serialization.h>
+#include <tesseract_task_composer/planning/nodes/raster_segment_cache.h>
+#include <tesseract_task_composer/planning/planning_task_composer_problem.h>
+
+#include <tesseract_command_language/poly/cartesian_waypoint_poly.h>
+#include <tesseract_command_language/poly/joint_waypoint_poly.h>
+#include <tesseract_command_language/poly/move_instruction_poly.h>
+#include <tesseract_command_language/poly/state_waypoint_poly.h>
+
+#include <tesseract_environment/environment.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+/** @brief Tags which keep values of different types with the same content from having the same encoding */
+enum class EncodeTag : int
+{
+  COMPOSITE,
+  MOVE,
+  OTHER,
+  CARTESIAN,
+  JOINT,
+  STATE,
+  DEPENDENCY,
+};
+
+/** @brief Appends the content of the key, collecting the profiles it references */
+struct Encoder
+{
+  std::string content;
+  std::vector<ProfileDictionary::Snapshot::ConstPtr> snapshots;
+
+  template <typename T>
+  void add(const T& value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values are encoded by their bytes");
+    content.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void add(const std::string& value)
+  {
+    add(value.size());
+    content.append(value);
+  }
+
+  void add(const std::vector<std::string>& values)
+  {
+    add(values.size());
+    for (const auto& value : values)
+      add(value);
+  }
+
+  void add(EncodeTag tag) { add(static_cast<int>(tag)); }
+
+  void add(const Eigen::VectorXd& v)
+  {
+    add(v.size());
+    content.append(reinterpret_cast<const char*>(v.data()), static_cast<std::size_t>(v.size()) * sizeof(double));
+  }
+
+  void add(const Eigen::Isometry3d& t)
+  {
+    content.append(reinterpret_cast<const char*>(t.matrix().data()), sizeof(double) * 16);
+  }
+
+  /** @brief Profiles are immutable, so they are identified by the object stored under each name */
+  void add(const ProfileDictionary::Snapshot::ConstPtr& snapshot)
+  {
+    std::vector<std::tuple<std::string, std::string, std::string, std::uintptr_t>> profiles;
+    snapshot->forEachProfile([&profiles](const std::string& ns,
+                                         const std::type_index& type,
+                                         const std::string& profile_name,
+                                         const std::shared_ptr<const void>& profile) {
+      profiles.emplace_back(ns, type.name(), profile_name, reinterpret_cast<std::uintptr_t>(profile.get()));
+    });
+    std::sort(profiles.begin(), profiles.end());
+
+    add(profiles.size());
+    for (const auto& profile : profiles)
+    {
+      add(std::get<0>(profile));
+      add(std::get<1>(profile));
+      add(std::get<2>(profile));
+      add(std::get<3>(profile));
+    }
+
+    // Keep the profiles alive so their addresses are not reused while the key exists
+    snapshots.push_back(snapshot);
+  }
+
+  void add(const ProfileDictionary::ConstPtr& profiles)
+  {
+    add(profiles != nullptr);
+    if (profiles != nullptr)
+      add(profiles->getSnapshot());
+  }
+
+  /** @brief The encoding does not depend on the order of the unordered map */
+  void add(const ProfileRemapping& remapping)
+  {
+    std::map<std::string, std::map<std::string, std::string>> sorted;
+    for (const auto& planner : remapping)
+      sorted[planner.first].insert(planner.second.begin(), planner.second.end());
+
+    add(sorted.size());
+    for (const auto& planner : sorted)
+    {
+      add(planner.first);
+      add(planner.second.size());
+      for (const auto& profile : planner.second)
+      {
+        add(profile.first);
+        add(profile.second);
+      }
+    }
+  }
+
+  void add(const tesseract_common::ManipulatorInfo& manip_info)
+  {
+    add(manip_info.manipulator);
+    add(manip_info.manipulator_ik_solver);
+    add(manip_info.working_frame);
+    add(manip_info.tcp_frame);
+    add(manip_info.tcp_offset.index());
+    if (const auto* tcp_offset_name = std::get_if<std::string>(&manip_info.tcp_offset))
+      add(*tcp_offset_name);
+    else
+      add(std::get<Eigen::Isometry3d>(manip_info.tcp_offset));
+  }
+
+  void add(const WaypointPoly& waypoint)
+  {
+    if (waypoint.isCartesianWaypoint())
+    {
+      const auto& cwp = waypoint.as<CartesianWaypointPoly>();
+      add(EncodeTag::CARTESIAN);
+      add(cwp.getName());
+      add(cwp.getTransform());
+      add(cwp.getUpperTolerance());
+      add(cwp.getLowerTolerance());
+      add(cwp.hasSeed());
+      if (cwp.hasSeed())
+      {
+        add(cwp.getSeed().joint_names);
+        add(cwp.getSeed().position);
+      }
+    }
+    else if (waypoint.isJointWaypoint())
+    {
+      const auto& jwp = waypoint.as<JointWaypointPoly>();
+      add(EncodeTag::JOINT);
+      add(jwp.getName());
+      add(jwp.getNames());
+      add(jwp.getPosition());
+      add(jwp.getUpperTolerance());
+      add(jwp.getLowerTolerance());
+      add(jwp.isConstrained());
+    }
+    else if (waypoint.isStateWaypoint())
+    {
+      const auto& swp = waypoint.as<StateWaypointPoly>();
+      add(EncodeTag::STATE);
+      add(swp.getName());
+      add(swp.getNames());
+      add(swp.getPosition());
+      add(swp.getVelocity());
+      add(swp.getAcceleration());
+      add(swp.getEffort());
+      add(swp.getTime());
+    }
+    else
+    {
+      add(EncodeTag::OTHER);
+      add(tesseract_common::Serialization::toArchiveStringXML<WaypointPoly>(waypoint));
+    }
+  }
+
+  void add(const InstructionPoly& instruction)
+  {
+    if (instruction.isCompositeInstruction())
+    {
+      add(instruction.as<CompositeInstruction>());
+    }
+    else if (instruction.isMoveInstruction())
+    {
+      const auto& move = instruction.as<MoveInstructionPoly>();
+      add(EncodeTag::MOVE);
+      add(static_cast<int>(move.getMoveType()));
+      add(move.getProfile());
+      add(move.getPathProfile());
+      add(move.getProfileOverrides());
+      add(move.getPathProfileOverrides());
+      add(move.getDescription());
+      add(move.getManipulatorInfo());
+      add(move.getWaypoint());
+    }
+    else
+    {
+      // Other instructions are rare so they are encoded using their serialization, which includes their uuid
+      add(EncodeTag::OTHER);
+      add(tesseract_common::Serialization::toArchiveStringXML<InstructionPoly>(instruction));
+    }
+  }
+
+  void add(const CompositeInstruction& composite)
+  {
+    add(EncodeTag::COMPOSITE);
+    add(static_cast<int>(composite.getOrder()));
+    add(composite.getProfile());
+    add(composite.getProfileOverrides());
+    add(composite.getDescription());
+    add(composite.getManipulatorInfo());
+    add(composite.size());
+    for (const auto& instruction : composite)
+      add(instruction);
+  }
+};
+}  // namespace
+
+bool RasterSegmentCache::Key::operator==(const Key& rhs) const
+{
+  if (hash != rhs.hash || content != rhs.content)
+    return false;
+
+  if (problem == rhs.problem)
+    return true;
+
+  return (problem != nullptr && rhs.problem != nullptr && problem->content == rhs.problem->content);
+}
+bool RasterSegmentCache::Key::operator!=(const Key& rhs) const { return !operator==(rhs); }
+
+RasterSegmentCache::RasterSegmentCache(std::size_t max_size) : max_size_(max_size) {}
+
+RasterSegmentCache::ProblemKey::ConstPtr
+RasterSegmentCache::createProblemKey(const PlanningTaskComposerProblem& problem)
+{
+  Encoder encoder;
+  encoder.add(problem.env != nullptr);
+  if (problem.env != nullptr)
+  {
+    encoder.add(problem.env->getName());
+    encoder.add(problem.env->getRevision());
+  }
+  encoder.add(problem.profiles);
+  encoder.add(problem.move_profile_remapping);
+  encoder.add(problem.composite_profile_remapping);
+
+  auto problem_key = std::make_shared<ProblemKey>();
+  problem_key->content = std::move(encoder.content);
+  problem_key->snapshots = std::move(encoder.snapshots);
+  return problem_key;
+}
+
+RasterSegmentCache::Key RasterSegmentCache::createKey(const CompositeInstruction& program,
+                                                      ProblemKey::ConstPtr problem_key,
+                                                      const std::vector<const Key*>& dependency_keys)
+{
+  Encoder encoder;
+  encoder.add(program);
+
+  // The dependencies are encoded in full so a dependent segment only matches if the segments it depends on match
+  for (const Key* dependency : dependency_keys)
+  {
+    encoder.add(EncodeTag::DEPENDENCY);
+    encoder.add(dependency->content);
+    encoder.snapshots.insert(encoder.snapshots.end(), dependency->snapshots.begin(), dependency->snapshots.end());
+  }
+
+  Key key;
+  key.hash = std::hash<std::string>{}(encoder.content);
+  if (problem_key != nullptr)
+    boost::hash_combine(key.hash, std::hash<std::string>{}(problem_key->content));
+
+  key.content = std::move(encoder.content);
+  key.snapshots = std::move(encoder.snapshots);
+  key.problem = std::move(problem_key);
+  return key;
+}
+
+std::optional<CompositeInstruction> RasterSegmentCache::get(const Key& key)
+{
+  std::scoped_lock lock(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end())
+  {
+    ++misses_;
+    return std::nullopt;
+  }
+
+  ++hits_;
+  lru_.splice(lru_.begin(), lru_, it->second.second);
+  return it->second.first;
+}
+
+void RasterSegmentCache::put(const Key& key, CompositeInstruction output)
+{
+  if (max_size_ == 0)
+    return;
+
+  std::scoped_lock lock(mutex_);
+  auto it = entries_.find(key);
+  if (it != entries_.end())
+  {
+    it->second.first = std::move(output);
+    lru_.splice(lru_.begin(), lru_, it->second.second);
+    return;
+  }
+
+  if (entries_.size() >= max_size_)
+  {
+    auto lru_it = entries_.find(*lru_.back());
+    lru_.pop_back();
+    entries_.erase(lru_it);
+  }
+
+  auto result = entries_.emplace(key, std::make_pair(std::move(output), lru_.end()));
+  lru_.push_front(&result.first->first);
+  result.first->second.second = lru_.begin();
+}
+
+void RasterSegmentCache::clear()
+{
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+  lru_.clear();
+  hits_ = 0;
+  misses_ = 0;
+}
+
+std::size_t RasterSegmentCache::size() const
+{
+  std::scoped_lock lock(mutex_);
+  return entries_.size();
+}
+
+std::size_t RasterSegmentCache::getMaxSize() const { return max_size_; }
+
+std::size_t RasterSegmentCache::getHits() const
+{
+  std::scoped_lock lock(mutex_);
+  return hits_;
+}
+
+std::size_t RasterSegmentCache::getMisses() const
+{
+  std::scoped_lock lock(mutex_);
+  return misses_;
+}
+
+}  // namespace tesseract_planning
@@ -107,6 +107,8 @@ TaskComposerNodeInfo::UPtr RuckigTrajectorySmoothingTask::runImpl(TaskComposerIn
 
   RuckigTrajectorySmoothing solver(cur_composite_profile->duration_extension_fraction,
                                    cur_composite_profile->max_duration_extension_factor);
+  solver.setSmoothingMode(cur_composite_profile->smoothing_mode);
+  solver.setNumThreads(cur_composite_profile->num_threads);
 
   // Create data structures for checking for plan profile overrides
   auto flattened = ci.flatten(moveFilter);
@@ -131,19 +133,14 @@ TaskComposerNodeInfo::UPtr RuckigTrajectorySmoothingTask::runImpl(TaskComposerIn
   Eigen::VectorXd jerk_scaling_factors = Eigen::VectorXd::Ones(static_cast<Eigen::Index>(flattened.size())) *
                                          cur_composite_profile->max_jerk_scaling_factor;
 
-  // Loop over all MoveInstructions
+  // Loop over all MoveInstructions, moves without a move profile keep the composite profile scaling factors
+  ProfileResolver<RuckigTrajectorySmoothingMoveProfile> move_profile_resolver(
+      name_, *problem.profiles, problem.move_profile_remapping);
+  const ProfileTable<RuckigTrajectorySmoothingMoveProfile> move_profiles(flattened, move_profile_resolver);
   for (Eigen::Index idx = 0; idx < static_cast<Eigen::Index>(flattened.size()); idx++)
   {
-    const auto& mi = flattened[static_cast<std::size_t>(idx)].get().as<MoveInstructionPoly>();
-    std::string move_profile = mi.getProfile();
-
-    // Check for remapping of the plan profile
-    move_profile = getProfileString(name_, profile, problem.move_profile_remapping);
-    auto cur_move_profile = getProfile<RuckigTrajectorySmoothingMoveProfile>(
-        name_, move_profile, *problem.profiles, std::make_shared<RuckigTrajectorySmoothingMoveProfile>());
-    //    cur_move_profile = applyProfileOverrides(name_, profile, cur_move_profile, mi.profile_overrides);
-
     // If there is a move profile associated with it, override the parameters
+    const auto& cur_move_profile = move_profiles[static_cast<std::size_t>(idx)];
     if (cur_move_profile)
     {
       velocity_scaling_factors[idx] = cur_move_profile->max_velocity_scaling_factor;
@@ -181,6 +178,8 @@ TaskComposerNodeInfo::UPtr RuckigTrajectorySmoothingTask::runImpl(TaskComposerIn
   return info;
 }
 
+TaskComposerNode::UPtr RuckigTrajectorySmoothingTask::clone() const { return cloneAs<RuckigTrajectorySmoothingTask>(); }
+
 bool RuckigTrajectorySmoothingTask::operator==(const RuckigTrajectorySmoothingTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
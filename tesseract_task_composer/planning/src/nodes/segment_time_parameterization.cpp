@@ -0,0 +1,140 @@
+/**
+ * @file segment_time_parameterization.cpp
+ * @brief Time parameterize the segments of a program concurrently
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/planning/nodes/segment_time_parameterization.h>
+#include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_graph.h>
+
+#include <tesseract_command_language/poly/move_instruction_poly.h>
+#include <tesseract_command_language/poly/state_waypoint_poly.h>
+#include <tesseract_command_language/utils.h>
+
+namespace tesseract_planning
+{
+bool canParameterizeSegments(const CompositeInstruction& program)
+{
+  if (program.size() < 2)
+    return false;
+
+  for (const auto& instruction : program)
+  {
+    if (!instruction.isCompositeInstruction())
+      return false;
+
+    if (instruction.as<CompositeInstruction>().getFirstMoveInstruction() == nullptr)
+      return false;
+  }
+
+  return (program.front().as<CompositeInstruction>().getMoveInstructionCount() > 1);
+}
+
+bool parameterizeSegments(CompositeInstruction& program,
+                          TaskComposerInput& input,
+                          TaskComposerExecutor& executor,
+                          const SegmentTaskFactory& segment_task_factory)
+{
+  TaskComposerGraph task_graph;
+  std::vector<boost::uuids::uuid> segment_uuids;
+  std::vector<std::pair<TaskComposerDataStorage::Slot, TaskComposerDataStorage::Slot>> segment_slots;
+  segment_uuids.reserve(program.size());
+  segment_slots.reserve(program.size());
+  for (std::size_t i = 0; i < program.size(); ++i)
+  {
+    // The segments are parameterized using the profile and manipulator of the program
+    CompositeInstruction segment = program[i].as<CompositeInstruction>();
+    segment.setProfile(program.getProfile());
+    segment.setProfileOverrides(program.getProfileOverrides());
+    segment.setManipulatorInfo(program.getManipulatorInfo());
+
+    if (i > 0)
+    {
+      const auto* li = program[i - 1].as<CompositeInstruction>().getLastMoveInstruction();
+      segment.insertMoveInstruction(segment.begin(), *li);
+    }
+
+    std::string input_key = task_graph.getUUIDString() + "_input_" + std::to_string(i);
+    std::string output_key = task_graph.getUUIDString() + "_output_" + std::to_string(i);
+    segment_slots.emplace_back(input.data_storage.getSlot(input_key), input.data_storage.getSlot(output_key));
+    input.data_storage.setData(segment_slots.back().first, std::move(segment));
+    segment_uuids.push_back(task_graph.addNode(segment_task_factory(input_key, output_key)));
+  }
+
+  TaskComposerFuture::UPtr future = executor.run(task_graph, input);
+  future->wait();
+
+  std::vector<CompositeInstruction> results;
+  results.reserve(program.size());
+  for (std::size_t i = 0; i < program.size(); ++i)
+  {
+    auto info = input.task_infos.getInfo(segment_uuids[i]);
+    tesseract_common::AnyPoly result = input.data_storage.getData(segment_slots[i].second);
+    input.data_storage.removeData(segment_slots[i].first);
+    input.data_storage.removeData(segment_slots[i].second);
+    if (info == nullptr || info->return_value == 0 || result.isNull())
+      continue;
+
+    results.push_back(result.as<CompositeInstruction>());
+  }
+
+  if (results.size() != program.size())
+    return false;
+
+  // Remove the prepended start of each segment and offset its time by the end time of the previous segment
+  double time_offset{ 0 };
+  for (std::size_t i = 0; i < program.size(); ++i)
+  {
+    CompositeInstruction& segment = results[i];
+    if (i > 0)
+      segment.erase(segment.begin());
+
+    double end_time{ time_offset };
+    for (auto& instruction : segment.flatten(moveFilter))
+    {
+      auto& move = instruction.get().as<MoveInstructionPoly>();
+      if (!move.getWaypoint().isStateWaypoint())
+        continue;
+
+      auto& swp = move.getWaypoint().as<StateWaypointPoly>();
+      swp.setTime(swp.getTime() + time_offset);
+      end_time = swp.getTime();
+    }
+    time_offset = end_time;
+
+    auto& original = program[i].as<CompositeInstruction>();
+    segment.setProfile(original.getProfile());
+    segment.setProfileOverrides(original.getProfileOverrides());
+    segment.setManipulatorInfo(original.getManipulatorInfo());
+    original = std::move(segment);
+  }
+
+  return true;
+}
+}  // namespace tesseract_planning
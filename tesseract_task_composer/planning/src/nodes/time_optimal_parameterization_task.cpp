@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_task_composer/planning/nodes/time_optimal_parameterization_task.h>
+#include <tesseract_task_composer/planning/nodes/segment_time_parameterization.h>
 #include <tesseract_task_composer/planning/profiles/time_optimal_parameterization_profile.h>
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
 
@@ -80,7 +81,7 @@ TimeOptimalParameterizationTask::TimeOptimalParameterizationTask(std::string nam
 }
 
 TaskComposerNodeInfo::UPtr TimeOptimalParameterizationTask::runImpl(TaskComposerInput& input,
-                                                                    OptionalTaskComposerExecutor /*executor*/) const
+                                                                    OptionalTaskComposerExecutor executor) const
 {
   // Get the problem
   auto& problem = dynamic_cast<PlanningTaskComposerProblem&>(*input.problem);
@@ -127,14 +128,45 @@ TaskComposerNodeInfo::UPtr TimeOptimalParameterizationTask::runImpl(TaskComposer
     return info;
   }
 
-  // Solve using parameters
-  TimeOptimalTrajectoryGeneration solver(cur_composite_profile->path_tolerance,
-                                         cur_composite_profile->min_angle_change);
-
   // Store scaling factors
   info->max_velocity_scaling_factor = cur_composite_profile->max_velocity_scaling_factor;
   info->max_acceleration_scaling_factor = cur_composite_profile->max_acceleration_scaling_factor;
 
+  if (cur_composite_profile->parameterize_segments && executor.has_value() && canParameterizeSegments(ci))
+  {
+    // The segment tasks share this task's name so they resolve the same profiles
+    auto segment_task_factory = [this](const std::string& input_key, const std::string& output_key) {
+      return std::make_unique<TimeOptimalParameterizationTask>(name_, input_key, output_key, false);
+    };
+
+    CompositeInstruction copy_ci(ci);
+    if (!parameterizeSegments(copy_ci, input, executor.value().get(), segment_task_factory))
+    {
+      if (output_keys_[0] != input_keys_[0])
+        input.data_storage.setData(output_keys_[0], input.data_storage.getData(input_keys_[0]));
+
+      info->message = "Failed to perform segment wise TOTG for process input: " + ci.getDescription();
+      CONSOLE_BRIDGE_logInform("%s", info->message.c_str());
+      return info;
+    }
+
+    input.data_storage.setData(output_keys_[0], copy_ci);
+
+    info->color = "green";
+    info->message = "Successful";
+    info->return_value = 1;
+    CONSOLE_BRIDGE_logDebug("TOTG succeeded");
+    return info;
+  }
+
+  // Solve using parameters
+  TimeOptimalTrajectoryGeneration solver(cur_composite_profile->path_tolerance,
+                                         cur_composite_profile->min_angle_change,
+                                         cur_composite_profile->time_step,
+                                         cur_composite_profile->adaptive_tolerance,
+                                         cur_composite_profile->min_time_step,
+                                         cur_composite_profile->max_time_step);
+
   // Copy the Composite before passing in because it will get flattened and resampled
   CompositeInstruction copy_ci(ci);
   InstructionsTrajectory traj_wrapper(copy_ci);
@@ -163,6 +195,8 @@ TaskComposerNodeInfo::UPtr TimeOptimalParameterizationTask::runImpl(TaskComposer
   return info;
 }
 
+TaskComposerNode::UPtr TimeOptimalParameterizationTask::clone() const { return cloneAs<TimeOptimalParameterizationTask>(); }
+
 bool TimeOptimalParameterizationTask::operator==(const TimeOptimalParameterizationTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
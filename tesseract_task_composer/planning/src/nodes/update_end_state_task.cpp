@@ -108,6 +108,8 @@ TaskComposerNodeInfo::UPtr UpdateEndStateTask::runImpl(TaskComposerInput& input,
   return info;
 }
 
+TaskComposerNode::UPtr UpdateEndStateTask::clone() const { return cloneAs<UpdateEndStateTask>(); }
+
 bool UpdateEndStateTask::operator==(const UpdateEndStateTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool UpdateEndStateTask::operator!=(const UpdateEndStateTask& rhs) const { return !operator==(rhs); }
 
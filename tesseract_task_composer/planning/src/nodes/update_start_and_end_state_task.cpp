@@ -136,6 +136,8 @@ TaskComposerNodeInfo::UPtr UpdateStartAndEndStateTask::runImpl(TaskComposerInput
   return info;
 }
 
+TaskComposerNode::UPtr UpdateStartAndEndStateTask::clone() const { return cloneAs<UpdateStartAndEndStateTask>(); }
+
 bool UpdateStartAndEndStateTask::operator==(const UpdateStartAndEndStateTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
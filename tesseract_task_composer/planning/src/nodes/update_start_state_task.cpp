@@ -108,6 +108,8 @@ TaskComposerNodeInfo::UPtr UpdateStartStateTask::runImpl(TaskComposerInput& inpu
   return info;
 }
 
+TaskComposerNode::UPtr UpdateStartStateTask::clone() const { return cloneAs<UpdateStartStateTask>(); }
+
 bool UpdateStartStateTask::operator==(const UpdateStartStateTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
@@ -174,6 +174,8 @@ void UpsampleTrajectoryTask::upsample(CompositeInstruction& composite,
   }
 }
 
+TaskComposerNode::UPtr UpsampleTrajectoryTask::clone() const { return cloneAs<UpsampleTrajectoryTask>(); }
+
 bool UpsampleTrajectoryTask::operator==(const UpsampleTrajectoryTask& rhs) const
 {
   return (TaskComposerTask::operator==(rhs));
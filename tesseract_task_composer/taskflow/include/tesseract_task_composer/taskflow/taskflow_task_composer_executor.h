@@ -28,6 +28,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <map>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -41,6 +42,24 @@ class Taskflow;
 
 namespace tesseract_planning
 {
+/**
+ * @brief An executor which runs the nodes on a taskflow executor
+ * @details Taskflow schedules the submitted graphs in order without priorities, so a long batch request can occupy all
+ * of the workers. To keep interactive requests responsive the executor can be split into priority partitions, each
+ * with its own workers. An input runs on the partition with the highest priority not greater than the priority of the
+ * input, and on the default partition if there is none. A partition only runs inputs of its own priority class, so its
+ * workers are idle when there are none, and it needs more than one thread if its nodes wait on subgraphs.
+ *
+ * @code{.yaml}
+ * TaskflowExecutor:
+ *   class: TaskflowTaskComposerExecutorFactory
+ *   config:
+ *     threads: 3
+ *     priorities:
+ *       - priority: 1
+ *         threads: 2
+ * @endcode
+ */
 class TaskflowTaskComposerExecutor : public TaskComposerExecutor
 {
 public:
@@ -49,8 +68,15 @@ public:
   using UPtr = std::unique_ptr<TaskflowTaskComposerExecutor>;
   using ConstUPtr = std::unique_ptr<const TaskflowTaskComposerExecutor>;
 
+  /**
+   * @brief Constructor
+   * @param name The name of the executor
+   * @param num_threads The number of threads of the default partition
+   * @param priority_threads The number of threads of each priority partition, keyed on the lowest priority it runs
+   */
   TaskflowTaskComposerExecutor(std::string name = "TaskflowExecutor",
-                               size_t num_threads = std::thread::hardware_concurrency());
+                               size_t num_threads = std::thread::hardware_concurrency(),
+                               std::map<int, std::size_t> priority_threads = {});
   TaskflowTaskComposerExecutor(std::string name, const YAML::Node& config);
   TaskflowTaskComposerExecutor(size_t num_threads);
   ~TaskflowTaskComposerExecutor() override;
@@ -65,6 +91,9 @@ public:
 
   long getTaskCount() const override final;
 
+  /** @brief Get the number of threads of each priority partition, keyed on the lowest priority it runs */
+  const std::map<int, std::size_t>& getPriorityThreads() const;
+
   bool operator==(const TaskflowTaskComposerExecutor& rhs) const;
   bool operator!=(const TaskflowTaskComposerExecutor& rhs) const;
 
@@ -84,6 +113,16 @@ protected:
   std::size_t num_threads_;
   std::unique_ptr<tf::Executor> executor_;
 
+  /** @brief The priority partitions keyed on the lowest priority they run */
+  std::map<int, std::size_t> priority_threads_;
+  std::map<int, std::unique_ptr<tf::Executor>> priority_executors_;
+
+  /** @brief Create the executors of the partitions */
+  void createExecutors();
+
+  /** @brief Get the executor of the partition an input with the priority runs on */
+  tf::Executor& getExecutor(int priority) const;
+
   static std::shared_ptr<std::vector<std::unique_ptr<tf::Taskflow>>>
   convertToTaskflow(const TaskComposerGraph& task_graph,
                     TaskComposerInput& task_input,
@@ -101,6 +140,8 @@ protected:
 
 #include <boost/serialization/export.hpp>
 #include <boost/serialization/tracking.hpp>
+#include <boost/serialization/version.hpp>
 BOOST_CLASS_EXPORT_KEY2(tesseract_planning::TaskflowTaskComposerExecutor, "TaskflowExecutor")
+BOOST_CLASS_VERSION(tesseract_planning::TaskflowTaskComposerExecutor, 1)
 
 #endif  // TESSERACT_TASK_COMPOSER_TASKFLOW_TASK_COMPOSER_EXECUTOR_H
@@ -24,6 +24,13 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/serialization/map.hpp>
+#include <chrono>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_task_composer/taskflow/taskflow_task_composer_executor.h>
 #include <tesseract_task_composer/taskflow/taskflow_task_composer_future.h>
 #include <taskflow/taskflow.hpp>
@@ -31,16 +38,22 @@
 namespace tesseract_planning
 {
 TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(size_t num_threads)
-  : TaskComposerExecutor("TaskflowExecutor")
-  , num_threads_(num_threads)
-  , executor_(std::make_unique<tf::Executor>(num_threads_))
+  : TaskComposerExecutor("TaskflowExecutor"), num_threads_(num_threads)
 {
+  createExecutors();
 }
-TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(std::string name, size_t num_threads)
-  : TaskComposerExecutor(std::move(name))
-  , num_threads_(num_threads)
-  , executor_(std::make_unique<tf::Executor>(num_threads_))
+TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(std::string name,
+                                                           size_t num_threads,
+                                                           std::map<int, std::size_t> priority_threads)
+  : TaskComposerExecutor(std::move(name)), num_threads_(num_threads), priority_threads_(std::move(priority_threads))
 {
+  for (const auto& pair : priority_threads_)
+  {
+    if (pair.second == 0)
+      throw std::runtime_error("TaskflowTaskComposerExecutor: priority partition threads must be greater than zero");
+  }
+
+  createExecutors();
 }
 
 TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(std::string name, const YAML::Node& config)
@@ -57,7 +70,29 @@ TaskflowTaskComposerExecutor::TaskflowTaskComposerExecutor(std::string name, con
         throw std::runtime_error("TaskflowTaskComposerExecutor: entry 'threads' must be greater than zero");
     }
 
-    executor_ = std::make_unique<tf::Executor>(num_threads_);
+    if (YAML::Node priorities = config["priorities"])
+    {
+      for (const auto& partition : priorities)
+      {
+        if (!partition["priority"])
+          throw std::runtime_error("TaskflowTaskComposerExecutor: priority partition missing entry 'priority'");
+
+        if (!partition["threads"])
+          throw std::runtime_error("TaskflowTaskComposerExecutor: priority partition missing entry 'threads'");
+
+        auto priority = partition["priority"].as<int>();
+        auto t = partition["threads"].as<int>();
+        if (t <= 0)
+          throw std::runtime_error("TaskflowTaskComposerExecutor: priority partition entry 'threads' must be greater "
+                                   "than zero");
+
+        if (!priority_threads_.emplace(priority, static_cast<std::size_t>(t)).second)
+          throw std::runtime_error("TaskflowTaskComposerExecutor: duplicate priority partition '" +
+                                   std::to_string(priority) + "'");
+      }
+    }
+
+    createExecutors();
   }
   catch (const std::exception& e)
   {
@@ -85,18 +120,57 @@ TaskComposerFuture::UPtr TaskflowTaskComposerExecutor::run(const TaskComposerNod
   //  taskflow.top->dump(out_data);  // dump the graph including dynamic tasks
   //  out_data.close();
 
-  std::shared_future<void> f = executor_->run(*(taskflow->front()));
+  std::shared_future<void> f = getExecutor(task_input.priority).run(*(taskflow->front()));
   return std::make_unique<TaskflowTaskComposerFuture>(f, std::move(taskflow));
 }
 
-long TaskflowTaskComposerExecutor::getWorkerCount() const { return static_cast<long>(executor_->num_workers()); }
+long TaskflowTaskComposerExecutor::getWorkerCount() const
+{
+  auto count = static_cast<long>(executor_->num_workers());
+  for (const auto& pair : priority_executors_)
+    count += static_cast<long>(pair.second->num_workers());
+
+  return count;
+}
+
+long TaskflowTaskComposerExecutor::getTaskCount() const
+{
+  auto count = static_cast<long>(executor_->num_topologies());
+  for (const auto& pair : priority_executors_)
+    count += static_cast<long>(pair.second->num_topologies());
+
+  return count;
+}
+
+const std::map<int, std::size_t>& TaskflowTaskComposerExecutor::getPriorityThreads() const
+{
+  return priority_threads_;
+}
 
-long TaskflowTaskComposerExecutor::getTaskCount() const { return static_cast<long>(executor_->num_topologies()); }
+void TaskflowTaskComposerExecutor::createExecutors()
+{
+  executor_ = std::make_unique<tf::Executor>(num_threads_);
+
+  priority_executors_.clear();
+  for (const auto& pair : priority_threads_)
+    priority_executors_[pair.first] = std::make_unique<tf::Executor>(pair.second);
+}
+
+tf::Executor& TaskflowTaskComposerExecutor::getExecutor(int priority) const
+{
+  // The partition with the highest priority not greater than the priority
+  auto it = priority_executors_.upper_bound(priority);
+  if (it == priority_executors_.begin())
+    return *executor_;
+
+  return *std::prev(it)->second;
+}
 
 bool TaskflowTaskComposerExecutor::operator==(const TaskflowTaskComposerExecutor& rhs) const
 {
   bool equal = true;
   equal &= (num_threads_ == rhs.num_threads_);
+  equal &= (priority_threads_ == rhs.priority_threads_);
   equal &= TaskComposerExecutor::operator==(rhs);
   return equal;
 }
@@ -107,19 +181,26 @@ bool TaskflowTaskComposerExecutor::operator!=(const TaskflowTaskComposerExecutor
 }
 
 template <class Archive>
-void TaskflowTaskComposerExecutor::save(Archive& ar, const unsigned int /*version*/) const
+void TaskflowTaskComposerExecutor::save(Archive& ar, const unsigned int version) const
 {
   ar& BOOST_SERIALIZATION_NVP(num_threads_);
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerExecutor);
+  if (version >= 1)
+    ar& BOOST_SERIALIZATION_NVP(priority_threads_);
 }
 
 template <class Archive>
-void TaskflowTaskComposerExecutor::load(Archive& ar, const unsigned int /*version*/)
+void TaskflowTaskComposerExecutor::load(Archive& ar, const unsigned int version)
 {
   ar& BOOST_SERIALIZATION_NVP(num_threads_);
   ar& BOOST_SERIALIZATION_BASE_OBJECT_NVP(TaskComposerExecutor);
 
-  executor_ = std::make_unique<tf::Executor>(num_threads_);
+  // Version 0 archives were written before priority partitions were added
+  priority_threads_.clear();
+  if (version >= 1)
+    ar& BOOST_SERIALIZATION_NVP(priority_threads_);
+
+  createExecutors();
 }
 
 template <class Archive>
@@ -139,6 +220,8 @@ TaskflowTaskComposerExecutor::convertToTaskflow(const TaskComposerGraph& task_gr
   // Must add a Node Info object for the graph
   auto info = std::make_unique<TaskComposerNodeInfo>(task_graph);
   info->color = "green";
+  info->start_time = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  info->thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
   task_input.task_infos.addInfo(std::move(info));
 
   // Generate process tasks for each node
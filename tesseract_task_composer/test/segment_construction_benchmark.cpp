@@ -0,0 +1,104 @@
+/**
+ * @file segment_construction_benchmark.cpp
+ * @brief Benchmark constructing the segment pipelines of a raster program
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+
+using namespace tesseract_planning;
+
+const std::string SEGMENT_TASK_NAME = "CartesianPipeline";
+
+tesseract_common::fs::path getConfigPath()
+{
+#ifdef TESSERACT_TASK_COMPOSER_HAS_TRAJOPT_IFOPT
+  return { std::string(TESSERACT_TASK_COMPOSER_DIR) + "/config/task_composer_plugins.yaml" };
+#else
+  return { std::string(TESSERACT_TASK_COMPOSER_DIR) + "/config/task_composer_plugins_no_trajopt_ifopt.yaml" };
+#endif
+}
+
+/** @brief Apply the same key renaming the raster tasks perform for each segment */
+void indexSegment(TaskComposerNode& node, std::size_t index)
+{
+  node.setName("Raster #" + std::to_string(index + 1) + ": " + node.getName());
+  node.renameInputKeys({ { "output_data", SEGMENT_TASK_NAME + "_output_data" + std::to_string(index) } });
+  node.renameOutputKeys({ { "output_data", SEGMENT_TASK_NAME + "_output_data" + std::to_string(index) } });
+}
+
+/** @brief Construct every segment from its config using the plugin factory */
+static void BM_CreateSegmentsFromConfig(benchmark::State& state)
+{
+  TaskComposerPluginFactory factory(getConfigPath());
+  const std::map<std::string, std::string> remapping{ { "input_data", "output_data" } };
+  const auto num_segments = static_cast<std::size_t>(state.range(0));
+
+  for (auto _ : state)
+  {
+    std::vector<TaskComposerNode::UPtr> segments;
+    segments.reserve(num_segments);
+    for (std::size_t i = 0; i < num_segments; ++i)
+    {
+      TaskComposerNode::UPtr node = factory.createTaskComposerNode(SEGMENT_TASK_NAME);
+      node->renameInputKeys(remapping);
+      indexSegment(*node, i);
+      segments.push_back(std::move(node));
+    }
+    benchmark::DoNotOptimize(segments);
+  }
+}
+
+BENCHMARK(BM_CreateSegmentsFromConfig)->Arg(200)->Unit(benchmark::kMillisecond);
+
+/** @brief Construct the segment once and clone it for every segment */
+static void BM_CloneSegmentsFromPrototype(benchmark::State& state)
+{
+  TaskComposerPluginFactory factory(getConfigPath());
+  const std::map<std::string, std::string> remapping{ { "input_data", "output_data" } };
+  const auto num_segments = static_cast<std::size_t>(state.range(0));
+
+  TaskComposerNode::Ptr prototype = factory.createTaskComposerNode(SEGMENT_TASK_NAME);
+  prototype->renameInputKeys(remapping);
+
+  for (auto _ : state)
+  {
+    std::vector<TaskComposerNode::UPtr> segments;
+    segments.reserve(num_segments);
+    for (std::size_t i = 0; i < num_segments; ++i)
+    {
+      TaskComposerNode::UPtr node = prototype->clone();
+      indexSegment(*node, i);
+      segments.push_back(std::move(node));
+    }
+    benchmark::DoNotOptimize(segments);
+  }
+}
+
+BENCHMARK(BM_CloneSegmentsFromPrototype)->Arg(200)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
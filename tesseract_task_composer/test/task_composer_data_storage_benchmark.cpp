@@ -0,0 +1,138 @@
+/**
+ * @file task_composer_data_storage_benchmark.cpp
+ * @brief Benchmark accessing the task composer data storage by key and by slot
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/joint_state.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+
+TESSERACT_ANY_EXPORT(tesseract_common, JointState)
+
+using namespace tesseract_planning;
+
+/** @brief The number of keys in the storage, similar to a raster program with several rasters */
+const std::size_t NUM_KEYS = 64;
+
+/** @brief Create keys similar to the ones created by the raster tasks */
+std::vector<std::string> createKeys()
+{
+  boost::uuids::random_generator gen;
+  std::vector<std::string> keys;
+  keys.reserve(NUM_KEYS);
+  for (std::size_t i = 0; i < NUM_KEYS; ++i)
+    keys.push_back("RasterPipeline_output_data" + std::to_string(i) + "_" + boost::uuids::to_string(gen()));
+
+  return keys;
+}
+
+/** @brief A storage shared by all benchmark threads */
+struct SharedStorage
+{
+  SharedStorage() : keys(createKeys()), js({ "joint_1", "joint_2" }, Eigen::Vector2d(5, 10))
+  {
+    slots.reserve(keys.size());
+    for (const auto& key : keys)
+    {
+      slots.push_back(data.getSlot(key));
+      data.setData(key, js);
+    }
+  }
+
+  TaskComposerDataStorage data;
+  std::vector<std::string> keys;
+  std::vector<TaskComposerDataStorage::Slot> slots;
+  tesseract_common::JointState js;
+};
+
+SharedStorage& getSharedStorage()
+{
+  static SharedStorage storage;
+  return storage;
+}
+
+/** @brief Get the data of each key by name from several threads */
+static void BM_GetDataByKey(benchmark::State& state)
+{
+  SharedStorage& storage = getSharedStorage();
+  for (auto _ : state)
+  {
+    for (const auto& key : storage.keys)
+      benchmark::DoNotOptimize(storage.data.getData(key));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(NUM_KEYS));
+}
+
+BENCHMARK(BM_GetDataByKey)->Threads(1)->Threads(4)->UseRealTime();
+
+/** @brief Get the data of each key by slot from several threads */
+static void BM_GetDataBySlot(benchmark::State& state)
+{
+  SharedStorage& storage = getSharedStorage();
+  for (auto _ : state)
+  {
+    for (const auto& slot : storage.slots)
+      benchmark::DoNotOptimize(storage.data.getData(slot));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(NUM_KEYS));
+}
+
+BENCHMARK(BM_GetDataBySlot)->Threads(1)->Threads(4)->UseRealTime();
+
+/** @brief Set the data of each key by name, each thread writes its own keys */
+static void BM_SetDataByKey(benchmark::State& state)
+{
+  SharedStorage& storage = getSharedStorage();
+  const auto offset = static_cast<std::size_t>(state.thread_index());
+  for (auto _ : state)
+  {
+    for (std::size_t i = offset; i < NUM_KEYS; i += static_cast<std::size_t>(state.threads()))
+      storage.data.setData(storage.keys[i], storage.js);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(NUM_KEYS) / state.threads());
+}
+
+BENCHMARK(BM_SetDataByKey)->Threads(1)->Threads(4)->UseRealTime();
+
+/** @brief Set the data of each key by slot, each thread writes its own keys */
+static void BM_SetDataBySlot(benchmark::State& state)
+{
+  SharedStorage& storage = getSharedStorage();
+  const auto offset = static_cast<std::size_t>(state.thread_index());
+  for (auto _ : state)
+  {
+    for (std::size_t i = offset; i < NUM_KEYS; i += static_cast<std::size_t>(state.threads()))
+      storage.data.setData(storage.slots[i], storage.js);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<long>(NUM_KEYS) / state.threads());
+}
+
+BENCHMARK(BM_SetDataBySlot)->Threads(1)->Threads(4)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,155 @@
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_input_pool.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/test_suite/test_task.h>
+
+namespace
+{
+/** @brief Indicate if allocations are counted */
+std::atomic<bool> count_allocations{ false };  // NOLINT
+
+/** @brief The number of allocations while counting */
+std::atomic<std::size_t> allocation_count{ 0 };  // NOLINT
+
+void* allocate(std::size_t size)
+{
+  if (count_allocations.load(std::memory_order_relaxed))
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+  void* ptr = std::malloc(size == 0 ? 1 : size);  // NOLINT
+  if (ptr == nullptr)
+    throw std::bad_alloc();
+
+  return ptr;
+}
+}  // namespace
+
+// The global allocator is replaced to count the allocations, which is why these tests are in their own executable
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }                          // NOLINT
+void operator delete[](void* ptr) noexcept { std::free(ptr); }                        // NOLINT
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }    // NOLINT
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }  // NOLINT
+
+using namespace tesseract_planning;
+
+TEST(TesseractTaskComposerInputPoolUnit, AcquireRelease)  // NOLINT
+{
+  TaskComposerInputPool pool(2);
+  EXPECT_EQ(pool.getMaxSize(), 2);
+  EXPECT_EQ(pool.size(), 0);
+
+  TaskComposerInput* first{ nullptr };
+  {
+    auto input = pool.acquire(std::make_unique<TaskComposerProblem>("first"));
+    first = input.get();
+    EXPECT_EQ(input->problem->name, "first");
+    input->data_storage.setData("key", tesseract_common::AnyPoly());
+    input->dotgraph = true;
+    input->priority = 1;
+    input->abort();
+    EXPECT_EQ(pool.size(), 0);
+  }
+  EXPECT_EQ(pool.size(), 1);
+
+  {  // The idle input is reused and reset to the constructed state
+    auto input = pool.acquire(std::make_unique<TaskComposerProblem>("second"));
+    EXPECT_EQ(input.get(), first);
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_EQ(input->problem->name, "second");
+    EXPECT_FALSE(input->data_storage.hasKey("key"));
+    EXPECT_TRUE(input->task_infos.getInfoMap().empty());
+    EXPECT_FALSE(input->dotgraph);
+    EXPECT_EQ(input->priority, 0);
+    EXPECT_FALSE(input->isAborted());
+    EXPECT_TRUE(input->isSuccessful());
+  }
+
+  {  // Inputs released to a full pool are deleted
+    auto input1 = pool.acquire(std::make_unique<TaskComposerProblem>());
+    auto input2 = pool.acquire(std::make_unique<TaskComposerProblem>());
+    auto input3 = pool.acquire(std::make_unique<TaskComposerProblem>());
+  }
+  EXPECT_EQ(pool.size(), 2);
+
+  pool.clear();
+  EXPECT_EQ(pool.size(), 0);
+}
+
+TEST(TesseractTaskComposerInputPoolUnit, SteadyStateAllocations)  // NOLINT
+{
+  const std::size_t num_runs{ 10 };
+  const std::size_t num_tasks{ 50 };
+  std::vector<std::unique_ptr<test_suite::TestTask>> tasks;
+  for (std::size_t i = 0; i < num_tasks; ++i)
+    tasks.push_back(std::make_unique<test_suite::TestTask>("Task" + std::to_string(i), false));
+
+  TaskComposerInputPool pool;
+  std::size_t warm_up_allocations{ 0 };
+  for (std::size_t run = 0; run < num_runs; ++run)
+  {
+    // The problem and node infos are created by the caller and tasks, only the bookkeeping of the input is counted
+    auto problem = std::make_unique<TaskComposerProblem>();
+    std::vector<TaskComposerNodeInfo::UPtr> infos;
+    infos.reserve(num_tasks);
+    for (const auto& task : tasks)
+      infos.push_back(std::make_unique<TaskComposerNodeInfo>(*task));
+
+    allocation_count = 0;
+    count_allocations = true;
+    {
+      auto input = pool.acquire(std::move(problem));
+      for (auto& info : infos)
+        input->task_infos.addInfo(std::move(info));
+    }
+    count_allocations = false;
+
+    if (run == 0)
+      warm_up_allocations = allocation_count.load();
+    else
+      EXPECT_EQ(allocation_count.load(), 0) << "run " << run;
+  }
+
+  // The first run allocates the input and the info container nodes
+  EXPECT_GT(warm_up_allocations, num_tasks);
+}
+
+TEST(TesseractTaskComposerInputPoolUnit, UnpooledAllocations)  // NOLINT
+{
+  const std::size_t num_tasks{ 50 };
+  std::vector<std::unique_ptr<test_suite::TestTask>> tasks;
+  for (std::size_t i = 0; i < num_tasks; ++i)
+    tasks.push_back(std::make_unique<test_suite::TestTask>("Task" + std::to_string(i), false));
+
+  auto problem = std::make_unique<TaskComposerProblem>();
+  std::vector<TaskComposerNodeInfo::UPtr> infos;
+  infos.reserve(num_tasks);
+  for (const auto& task : tasks)
+    infos.push_back(std::make_unique<TaskComposerNodeInfo>(*task));
+
+  // Without the pool every submission allocates the input and a map node per info
+  allocation_count = 0;
+  count_allocations = true;
+  {
+    auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+    for (auto& info : infos)
+      input->task_infos.addInfo(std::move(info));
+  }
+  count_allocations = false;
+  EXPECT_GT(allocation_count.load(), num_tasks);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
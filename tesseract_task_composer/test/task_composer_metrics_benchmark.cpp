@@ -0,0 +1,98 @@
+/**
+ * @file task_composer_metrics_benchmark.cpp
+ * @brief Benchmark the overhead of recording runtime metrics
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_input.h>
+#include <tesseract_task_composer/core/task_composer_metrics.h>
+#include <tesseract_task_composer/core/task_composer_pipeline.h>
+#include <tesseract_task_composer/core/test_suite/test_task.h>
+
+using namespace tesseract_planning;
+
+/** @brief Create a pipeline of tasks which do no work so the run time is dominated by the task composer overhead */
+TaskComposerPipeline::UPtr createPipeline(long num_tasks)
+{
+  auto pipeline = std::make_unique<TaskComposerPipeline>("Pipeline");
+  boost::uuids::uuid previous_uuid{};
+  for (long i = 0; i < num_tasks; ++i)
+  {
+    auto task = std::make_unique<test_suite::TestTask>("Task" + std::to_string(i), false);
+    boost::uuids::uuid uuid = pipeline->addNode(std::move(task));
+    if (!previous_uuid.is_nil())
+      pipeline->addEdges(previous_uuid, { uuid });
+
+    previous_uuid = uuid;
+  }
+  pipeline->setTerminals({ previous_uuid });
+  return pipeline;
+}
+
+/** @brief Run the pipeline without recording metrics */
+static void BM_RunPipeline(benchmark::State& state)
+{
+  TaskComposerPipeline::UPtr pipeline = createPipeline(state.range(0));
+  TaskComposerInput input(std::make_unique<TaskComposerProblem>());
+  for (auto _ : state)
+  {
+    input.reset();
+    benchmark::DoNotOptimize(pipeline->run(input));
+  }
+}
+
+BENCHMARK(BM_RunPipeline)->Arg(10)->Arg(50);
+
+/** @brief Run the pipeline recording metrics */
+static void BM_RunPipelineMetrics(benchmark::State& state)
+{
+  TaskComposerPipeline::UPtr pipeline = createPipeline(state.range(0));
+  TaskComposerInput input(std::make_unique<TaskComposerProblem>());
+  input.metrics = std::make_shared<TaskComposerMetrics>();
+  for (auto _ : state)
+  {
+    input.reset();
+    benchmark::DoNotOptimize(pipeline->run(input));
+  }
+}
+
+BENCHMARK(BM_RunPipelineMetrics)->Arg(10)->Arg(50);
+
+/** @brief Record to the same node entry from several threads */
+static void BM_RecordMetrics(benchmark::State& state)
+{
+  static TaskComposerMetrics metrics;
+  test_suite::TestTask task("Task", false);
+  TaskComposerNodeInfo info(task);
+  info.elapsed_time = 1e-3;
+  for (auto _ : state)
+    metrics.record(info, 1);
+}
+
+BENCHMARK(BM_RecordMetrics)->Threads(1)->Threads(4);
+
+BENCHMARK_MAIN();
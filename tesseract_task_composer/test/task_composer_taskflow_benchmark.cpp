@@ -0,0 +1,160 @@
+/**
+ * @file task_composer_taskflow_benchmark.cpp
+ * @brief Benchmark the latency of scheduling strategies on the taskflow executor
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <map>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/joint_state.h>
+#include <tesseract_task_composer/taskflow/taskflow_task_composer_executor.h>
+#include <tesseract_task_composer/core/nodes/done_task.h>
+#include <tesseract_task_composer/core/nodes/error_task.h>
+#include <tesseract_task_composer/core/nodes/race_task.h>
+#include <tesseract_task_composer/core/task_composer_pipeline.h>
+
+TESSERACT_ANY_EXPORT(tesseract_common, JointState)
+
+using namespace tesseract_planning;
+
+/** @brief A task which takes time to run like a motion planner, writing its name to the output on success */
+class DelayTask : public TaskComposerTask
+{
+public:
+  DelayTask(std::string name, double delay, int return_value)
+    : TaskComposerTask(std::move(name), true), delay_(delay), return_value_(return_value)
+  {
+    input_keys_.emplace_back("input_data");
+    output_keys_.emplace_back("output_data");
+  }
+
+protected:
+  double delay_;
+  int return_value_;
+
+  TaskComposerNodeInfo::UPtr runImpl(TaskComposerInput& input,
+                                     OptionalTaskComposerExecutor /*executor*/) const override final
+  {
+    std::this_thread::sleep_for(std::chrono::duration<double>(delay_));
+
+    auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+    info->return_value = return_value_;
+    info->color = (info->return_value == 0) ? "red" : "green";
+    if (info->return_value != 0)
+    {
+      tesseract_common::JointState js({ name_ }, Eigen::VectorXd::Zero(1));
+      input.data_storage.setData(output_keys_[0], js);
+    }
+    return info;
+  }
+};
+
+/** @brief Create an input with the input data set */
+TaskComposerInput::UPtr createInput()
+{
+  auto input = std::make_unique<TaskComposerInput>(std::make_unique<TaskComposerProblem>());
+  input->data_storage.setData("input_data", tesseract_common::JointState());
+  return input;
+}
+
+/** @brief Race a planner which fails against a planner which succeeds */
+static void BM_RaceFallback(benchmark::State& state)
+{
+  TaskflowTaskComposerExecutor executor("RaceExecutor", 4);
+  auto fail = std::make_shared<DelayTask>("Fail", 0.05, 0);
+  auto succeed = std::make_shared<DelayTask>("Succeed", 0.05, 1);
+  RaceTask race("RaceTask", { "input_data" }, { "output_data" }, { fail, succeed });
+  for (auto _ : state)
+  {
+    auto input = createInput();
+    executor.run(race, *input)->wait();
+  }
+}
+
+BENCHMARK(BM_RaceFallback)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/** @brief Run the same planners as a sequential fallback chain, where the first planner fails */
+static void BM_SequentialFallback(benchmark::State& state)
+{
+  TaskflowTaskComposerExecutor executor("SequentialExecutor", 4);
+  TaskComposerPipeline fallback("Fallback");
+  auto fail_uuid = fallback.addNode(std::make_unique<DelayTask>("Fail", 0.05, 0));
+  auto succeed_uuid = fallback.addNode(std::make_unique<DelayTask>("Succeed", 0.05, 1));
+  auto error_uuid = fallback.addNode(std::make_unique<ErrorTask>());
+  auto done_uuid = fallback.addNode(std::make_unique<DoneTask>());
+  fallback.addEdges(fail_uuid, { succeed_uuid, done_uuid });
+  fallback.addEdges(succeed_uuid, { error_uuid, done_uuid });
+  fallback.setTerminals({ error_uuid, done_uuid });
+  for (auto _ : state)
+  {
+    auto input = createInput();
+    executor.run(fallback, *input)->wait();
+  }
+}
+
+BENCHMARK(BM_SequentialFallback)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief The latency of an interactive input submitted while batch inputs occupy the workers of the default partition
+ * @details The argument is the number of threads of the interactive priority partition, zero to share the workers
+ */
+static void BM_InteractiveLatency(benchmark::State& state)
+{
+  std::map<int, std::size_t> priority_threads;
+  if (state.range(0) > 0)
+    priority_threads[1] = static_cast<std::size_t>(state.range(0));
+
+  TaskflowTaskComposerExecutor executor("LatencyExecutor", 2, priority_threads);
+  DelayTask batch_task("Batch", 0.05, 1);
+  DelayTask interactive_task("Interactive", 0.001, 1);
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    std::vector<TaskComposerInput::UPtr> batch_inputs;
+    std::vector<TaskComposerFuture::UPtr> batch_futures;
+    for (int i = 0; i < 4; ++i)
+    {
+      batch_inputs.push_back(createInput());
+      batch_futures.push_back(executor.run(batch_task, *batch_inputs.back()));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    auto input = createInput();
+    input->priority = 1;
+    state.ResumeTiming();
+
+    executor.run(interactive_task, *input)->wait();
+
+    state.PauseTiming();
+    for (auto& future : batch_futures)
+      future->wait();
+    state.ResumeTiming();
+  }
+}
+
+BENCHMARK(BM_InteractiveLatency)->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -3,12 +3,16 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
 #include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/joint_state.h>
 #include <tesseract_common/utils.h>
 
 #include <tesseract_task_composer/core/task_composer_data_storage.h>
 #include <tesseract_task_composer/core/task_composer_node.h>
+#include <tesseract_task_composer/core/task_composer_metrics.h>
 #include <tesseract_task_composer/core/task_composer_node_info.h>
 #include <tesseract_task_composer/core/task_composer_task.h>
 #include <tesseract_task_composer/core/task_composer_pipeline.h>
@@ -96,6 +100,45 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerDataStorageTests)  // NOLINT
     EXPECT_EQ(remap_move.getData("remap_" + key).as<tesseract_common::JointState>(), js);
   }
 
+  {  // Test Slot
+    TaskComposerDataStorage slot_data;
+    TaskComposerDataStorage::Slot slot = slot_data.getSlot(key);
+    EXPECT_EQ(slot_data.getSlot(key), slot);
+    EXPECT_NE(slot_data.getSlot("other_" + key), slot);
+    EXPECT_FALSE(slot_data.hasKey(slot));
+    EXPECT_FALSE(slot_data.hasKey(key));
+    EXPECT_TRUE(slot_data.getData(slot).isNull());
+    EXPECT_TRUE(slot_data.getData().empty());
+
+    slot_data.setData(slot, js);
+    EXPECT_TRUE(slot_data.hasKey(slot));
+    EXPECT_TRUE(slot_data.hasKey(key));
+    EXPECT_TRUE(slot_data.getData().size() == 1);
+    EXPECT_EQ(slot_data.getData(slot).as<tesseract_common::JointState>(), js);
+    EXPECT_EQ(slot_data.getData(key).as<tesseract_common::JointState>(), js);
+
+    // Slots are preserved by copy
+    TaskComposerDataStorage slot_copy{ slot_data };
+    EXPECT_EQ(slot_copy.getSlot(key), slot);
+    EXPECT_EQ(slot_copy.getData(slot).as<tesseract_common::JointState>(), js);
+    EXPECT_TRUE(slot_copy == slot_data);
+
+    // Slots remain valid after removing and remapping the data
+    slot_data.removeData(key);
+    EXPECT_FALSE(slot_data.hasKey(slot));
+    EXPECT_TRUE(slot_data.getData(slot).isNull());
+    slot_data.setData(slot, js);
+
+    std::map<std::string, std::string> remap;
+    remap[key] = "remap_" + key;
+    EXPECT_TRUE(slot_data.remapData(remap));
+    EXPECT_FALSE(slot_data.hasKey(slot));
+    EXPECT_EQ(slot_data.getData(slot_data.getSlot("remap_" + key)).as<tesseract_common::JointState>(), js);
+
+    // Invalid slot
+    EXPECT_ANY_THROW(slot_data.getData(TaskComposerDataStorage::Slot{ 100 }));  // NOLINT
+  }
+
   {  // Test Remap Failure
     std::map<std::string, std::string> remap;
     remap["does_not_exist"] = "remap_" + key;
@@ -140,6 +183,39 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerInputTests)  // NOLINT
   EXPECT_FALSE(input->isAborted());
   EXPECT_TRUE(input->isSuccessful());
   EXPECT_TRUE(input->task_infos.getInfoMap().empty());
+  EXPECT_TRUE(input->getParent() == nullptr);
+
+  {  // Abort scopes
+    input->dotgraph = true;
+    input->priority = 2;
+    input->metrics = std::make_shared<TaskComposerMetrics>();
+    TaskComposerInput child1(std::make_unique<TaskComposerProblem>(), *input);
+    TaskComposerInput child2(std::make_unique<TaskComposerProblem>(), *input);
+    TaskComposerInput grandchild(std::make_unique<TaskComposerProblem>(), child1);
+    EXPECT_EQ(child1.getParent(), input.get());
+    EXPECT_EQ(grandchild.getParent(), &child1);
+    EXPECT_TRUE(child1.dotgraph);
+    EXPECT_EQ(grandchild.priority, 2);
+    EXPECT_EQ(child1.metrics, input->metrics);
+
+    // Aborting a child does not abort its parent or siblings
+    child1.abort(node.getUUID());
+    EXPECT_TRUE(child1.isAborted());
+    EXPECT_TRUE(grandchild.isAborted());
+    EXPECT_FALSE(child2.isAborted());
+    EXPECT_FALSE(input->isAborted());
+    EXPECT_TRUE(input->isSuccessful());
+    EXPECT_TRUE(input->task_infos.getAbortingNode().is_nil());
+
+    // Aborting the parent aborts all children
+    input->abort();
+    EXPECT_TRUE(child2.isAborted());
+    EXPECT_FALSE(child2.isSuccessful());
+
+    input->reset();
+    EXPECT_FALSE(child2.isAborted());
+    EXPECT_TRUE(grandchild.isAborted());
+  }
 }
 
 TEST(TesseractTaskComposerCoreUnit, TaskComposerProblemTests)  // NOLINT
@@ -189,6 +265,184 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerNodeInfoContainerTests)  // NOLI
   EXPECT_TRUE(move_node_info_container->getInfo(node.getUUID()) == nullptr);
 }
 
+TEST(TesseractTaskComposerCoreUnit, TaskComposerNodeInfoContainerChromeTraceTests)  // NOLINT
+{
+  auto pipeline = std::make_unique<TaskComposerPipeline>("Pipeline");
+  auto task1 = std::make_unique<test_suite::TestTask>("Task1", false);
+  auto task2 = std::make_unique<test_suite::TestTask>("Task \"2\"", false);
+  boost::uuids::uuid task1_uuid = pipeline->addNode(std::move(task1));
+  boost::uuids::uuid task2_uuid = pipeline->addNode(std::move(task2));
+  pipeline->addEdges(task1_uuid, { task2_uuid });
+
+  TaskComposerNodeInfoContainer container;
+  {
+    auto info = std::make_unique<TaskComposerNodeInfo>(*pipeline);
+    info->start_time = 100;
+    info->elapsed_time = 0.5;
+    info->thread_id = 7;
+    container.addInfo(std::move(info));
+  }
+  {
+    auto info = std::make_unique<TaskComposerNodeInfo>(*pipeline->getNodes().at(task1_uuid));
+    info->start_time = 100.1;
+    info->elapsed_time = 0.1;
+    info->thread_id = 7;
+    container.addInfo(std::move(info));
+  }
+  {
+    auto info = std::make_unique<TaskComposerNodeInfo>(*pipeline->getNodes().at(task2_uuid));
+    info->start_time = 100.3;
+    info->elapsed_time = 0.4;
+    info->thread_id = 9;
+    info->message = "line1\nline2";
+    container.addInfo(std::move(info));
+  }
+
+  std::stringstream os;
+  container.dumpChromeTrace(os);
+  const std::string trace = os.str();
+  EXPECT_EQ(trace.find("{\"traceEvents\":["), 0);
+  EXPECT_NE(trace.find(R"("name":"Pipeline","cat":"task_composer","ph":"X","pid":0,"tid":0,"ts":0.000)"),
+            std::string::npos);
+  EXPECT_NE(trace.find(R"("name":"Task \"2\"","cat":"task_composer","ph":"X","pid":0,"tid":1)"), std::string::npos);
+  EXPECT_NE(trace.find(R"("message":"line1\nline2")"), std::string::npos);
+
+  // The pipeline ends when its last child ends
+  EXPECT_NE(trace.find(R"("dur":700000.000)"), std::string::npos);
+
+  // Task1 waited 0.1 seconds after the pipeline started and Task2 waited 0.1 seconds after Task1 finished
+  EXPECT_EQ(std::count(trace.begin(), trace.end(), 'X'), 3);
+  std::size_t pos = trace.find(R"("queue_wait_us":100000.000)");
+  EXPECT_NE(pos, std::string::npos);
+  EXPECT_NE(trace.find(R"("queue_wait_us":100000.000)", pos + 1), std::string::npos);
+}
+
+TEST(TesseractTaskComposerCoreUnit, TaskComposerMetricsTests)  // NOLINT
+{
+  auto task = std::make_unique<test_suite::TestTask>("Task", true);
+
+  TaskComposerMetrics metrics;
+  EXPECT_TRUE(metrics.getStatistics().empty());
+  EXPECT_EQ(metrics.getStatistics("Task").count, 0);
+
+  // 100 runs from 1 to 100 milliseconds, every fourth run failed
+  for (int i = 1; i <= 100; ++i)
+  {
+    TaskComposerNodeInfo info(*task);
+    info.elapsed_time = static_cast<double>(i) * 1e-3;
+    info.return_value = (i % 4 == 0) ? 0 : 1;
+    metrics.record(info, 2);
+  }
+
+  TaskComposerNodeStatistics statistics = metrics.getStatistics("Task");
+  EXPECT_EQ(statistics.name, "Task");
+  EXPECT_EQ(statistics.count, 100);
+  EXPECT_EQ(statistics.successes, 75);
+  EXPECT_EQ(statistics.aborts, 0);
+  EXPECT_EQ(statistics.data_copies, 200);
+  EXPECT_NEAR(statistics.total_time, 5.05, 1e-6);
+  EXPECT_NEAR(statistics.getMeanTime(), 0.0505, 1e-8);
+  EXPECT_NEAR(statistics.max_time, 0.1, 1e-9);
+
+  // The percentiles are the histogram bucket upper bounds which are within 19% of the exact value
+  EXPECT_GE(statistics.p50, 0.050);
+  EXPECT_LE(statistics.p50, 0.050 * 1.19);
+  EXPECT_GE(statistics.p95, 0.095);
+  EXPECT_LE(statistics.p95, 0.1);
+  EXPECT_GE(statistics.p99, statistics.p95);
+  EXPECT_LE(statistics.p99, statistics.max_time);
+
+  std::stringstream text;
+  metrics.dump(text);
+  EXPECT_NE(text.str().find("Task"), std::string::npos);
+
+  std::stringstream json;
+  metrics.dumpJSON(json);
+  EXPECT_EQ(json.str().find("{\"nodes\":["), 0);
+  EXPECT_NE(json.str().find(R"("name":"Task","count":100,"successes":75,"aborts":0,"data_copies":200)"),
+            std::string::npos);
+
+  metrics.clear();
+  EXPECT_TRUE(metrics.getStatistics().empty());
+
+  {  // Recording while the metrics are cleared
+    std::atomic<bool> done{ false };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+      threads.emplace_back([&metrics, &task, &done] {
+        TaskComposerNodeInfo info(*task);
+        info.elapsed_time = 1e-3;
+        while (!done)
+          metrics.record(info);
+      });
+    }
+
+    for (int i = 0; i < 1000; ++i)
+      metrics.clear();
+
+    done = true;
+    for (auto& thread : threads)
+      thread.join();
+
+    metrics.clear();
+    EXPECT_TRUE(metrics.getStatistics().empty());
+  }
+
+  // Tasks and pipelines record to the metrics of the input
+  auto pipeline = std::make_unique<TaskComposerPipeline>("Pipeline");
+  auto task1 = std::make_unique<test_suite::TestTask>("Task1", false);
+  auto task2 = std::make_unique<test_suite::TestTask>("Task2", true);
+  task2->return_value = 1;
+  auto task3 = std::make_unique<test_suite::TestTask>("Task3", false);
+  auto task4 = std::make_unique<test_suite::TestTask>("Task4", false);
+  boost::uuids::uuid task1_uuid = pipeline->addNode(std::move(task1));
+  boost::uuids::uuid task2_uuid = pipeline->addNode(std::move(task2));
+  boost::uuids::uuid task3_uuid = pipeline->addNode(std::move(task3));
+  boost::uuids::uuid task4_uuid = pipeline->addNode(std::move(task4));
+  pipeline->addEdges(task1_uuid, { task2_uuid });
+  pipeline->addEdges(task2_uuid, { task3_uuid, task4_uuid });
+  pipeline->setTerminals({ task3_uuid, task4_uuid });
+
+  auto shared_metrics = std::make_shared<TaskComposerMetrics>();
+  for (int i = 0; i < 3; ++i)
+  {
+    TaskComposerInput input(std::make_unique<TaskComposerProblem>());
+    input.metrics = shared_metrics;
+    EXPECT_EQ(pipeline->run(input), 1);
+  }
+
+  std::vector<TaskComposerNodeStatistics> all_statistics = shared_metrics->getStatistics();
+  ASSERT_EQ(all_statistics.size(), 4);
+  EXPECT_EQ(all_statistics[0].name, "Pipeline");
+  EXPECT_EQ(all_statistics[0].count, 3);
+  EXPECT_EQ(all_statistics[0].successes, 3);
+  EXPECT_EQ(all_statistics[1].name, "Task1");
+  EXPECT_EQ(all_statistics[1].count, 3);
+  EXPECT_EQ(all_statistics[1].successes, 0);
+  EXPECT_EQ(all_statistics[2].name, "Task2");
+  EXPECT_EQ(all_statistics[2].successes, 3);
+  EXPECT_EQ(all_statistics[3].name, "Task4");
+  EXPECT_EQ(all_statistics[3].count, 3);
+
+  // Aborted runs are counted separately
+  TaskComposerInput input(std::make_unique<TaskComposerProblem>());
+  input.metrics = shared_metrics;
+  input.abort();
+  EXPECT_EQ(pipeline->run(input), 0);
+  EXPECT_EQ(shared_metrics->getStatistics("Pipeline").count, 4);
+  EXPECT_EQ(shared_metrics->getStatistics("Pipeline").aborts, 1);
+
+  // Data copies made by a task are counted
+  std::size_t copy_count = TaskComposerDataStorage::getThreadCopyCount();
+  TaskComposerDataStorage data;
+  data.setData("key", tesseract_common::JointState());
+  data.getData("key");
+  data.remapData({ { "key", "key2" } }, true);
+  EXPECT_EQ(data.getData().size(), 2);
+  EXPECT_EQ(TaskComposerDataStorage::getThreadCopyCount() - copy_count, 4);
+}
+
 TEST(TesseractTaskComposerCoreUnit, TaskComposerNodeTests)  // NOLINT
 {
   std::stringstream os;
@@ -1315,6 +1569,65 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerPipelineTests)  // NOLINT
 }
 
 // Graph is mostly tested through the Pipeline tests becasue they can be run
+TEST(TesseractTaskComposerCoreUnit, TaskComposerPipelineCloneTests)  // NOLINT
+{
+  std::vector<std::string> input_keys{ "input_data" };
+  std::vector<std::string> output_keys{ "output_data" };
+  auto task1 = std::make_unique<test_suite::TestTask>("TaskComposerPipelineCloneTests1", true);
+  auto task2 = std::make_unique<test_suite::TestTask>("TaskComposerPipelineCloneTests2", false);
+  auto task3 = std::make_unique<test_suite::TestTask>("TaskComposerPipelineCloneTests3", false);
+  task1->setInputKeys(input_keys);
+  task1->setOutputKeys(output_keys);
+  task1->return_value = 1;
+  auto pipeline = std::make_unique<TaskComposerPipeline>("TaskComposerPipelineCloneTests");
+  boost::uuids::uuid uuid1 = pipeline->addNode(std::move(task1));
+  boost::uuids::uuid uuid2 = pipeline->addNode(std::move(task2));
+  boost::uuids::uuid uuid3 = pipeline->addNode(std::move(task3));
+  pipeline->addEdges(uuid1, { uuid2, uuid3 });
+  pipeline->setTerminals({ uuid2, uuid3 });
+
+  TaskComposerNode::UPtr node = pipeline->clone();
+  ASSERT_TRUE(node != nullptr);
+  auto* clone = dynamic_cast<TaskComposerPipeline*>(node.get());
+  ASSERT_TRUE(clone != nullptr);
+  EXPECT_NE(clone->getUUID(), pipeline->getUUID());
+  EXPECT_EQ(clone->getName(), pipeline->getName());
+  EXPECT_EQ(clone->isConditional(), pipeline->isConditional());
+  EXPECT_EQ(clone->getNodes().size(), 3U);
+  EXPECT_EQ(clone->getTerminals().size(), 2U);
+
+  // The cloned nodes have new uuids and the edges and terminals refer to them
+  std::map<std::string, TaskComposerNode::ConstPtr> cloned_nodes;
+  for (const auto& pair : clone->getNodes())
+  {
+    EXPECT_EQ(pipeline->getNodes().count(pair.first), 0U);
+    EXPECT_EQ(pair.second->getParentUUID(), clone->getUUID());
+    cloned_nodes[pair.second->getName()] = pair.second;
+  }
+
+  const auto& clone1 = cloned_nodes.at("TaskComposerPipelineCloneTests1");
+  const auto& clone2 = cloned_nodes.at("TaskComposerPipelineCloneTests2");
+  const auto& clone3 = cloned_nodes.at("TaskComposerPipelineCloneTests3");
+  EXPECT_TRUE(clone1->isConditional());
+  EXPECT_EQ(clone1->getInputKeys(), input_keys);
+  EXPECT_EQ(clone1->getOutputKeys(), output_keys);
+  EXPECT_EQ(clone1->getOutboundEdges(), std::vector<boost::uuids::uuid>({ clone2->getUUID(), clone3->getUUID() }));
+  EXPECT_EQ(clone2->getInboundEdges(), std::vector<boost::uuids::uuid>({ clone1->getUUID() }));
+  EXPECT_EQ(clone3->getInboundEdges(), std::vector<boost::uuids::uuid>({ clone1->getUUID() }));
+  EXPECT_EQ(clone->getTerminals(), std::vector<boost::uuids::uuid>({ clone2->getUUID(), clone3->getUUID() }));
+
+  // Renaming the clone does not modify the prototype
+  clone->renameInputKeys({ { "input_data", "id" } });
+  EXPECT_EQ(clone1->getInputKeys(), std::vector<std::string>({ "id" }));
+  EXPECT_EQ(pipeline->getNodes().at(uuid1)->getInputKeys(), input_keys);
+
+  // The clone runs the same as the prototype, taking the branch selected by return_value
+  TaskComposerInput input(std::make_unique<TaskComposerProblem>());
+  EXPECT_EQ(clone->run(input), 1);
+  EXPECT_EQ(input.task_infos.getInfoMap().count(clone3->getUUID()), 1U);
+  EXPECT_EQ(input.task_infos.getInfoMap().count(clone2->getUUID()), 0U);
+}
+
 TEST(TesseractTaskComposerCoreUnit, TaskComposerGraphTests)  // NOLINT
 {
   std::string name{ "TaskComposerGraphTests" };
@@ -4,6 +4,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <yaml-cpp/yaml.h>
 #include <sstream>
 #include <memory>
+#include <iterator>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
@@ -21,16 +22,21 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/planning/nodes/upsample_trajectory_task.h>
 #include <tesseract_task_composer/planning/nodes/iterative_spline_parameterization_task.h>
 #include <tesseract_task_composer/planning/nodes/time_optimal_parameterization_task.h>
+#include <tesseract_task_composer/planning/nodes/segment_time_parameterization.h>
 #include <tesseract_task_composer/planning/nodes/ruckig_trajectory_smoothing_task.h>
 #include <tesseract_task_composer/planning/nodes/motion_planner_task.hpp>
 #include <tesseract_task_composer/planning/nodes/raster_motion_task.h>
 #include <tesseract_task_composer/planning/nodes/raster_only_motion_task.h>
+#include <tesseract_task_composer/planning/nodes/raster_segment_cache.h>
 
 #include <tesseract_task_composer/planning/profiles/contact_check_profile.h>
+#include <tesseract_task_composer/planning/profiles/time_optimal_parameterization_profile.h>
 
 #include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
 
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+#include <tesseract_task_composer/core/nodes/abort_task.h>
+#include <tesseract_task_composer/core/nodes/remap_task.h>
 #include <tesseract_task_composer/core/test_suite/task_composer_serialization_utils.hpp>
 #include <tesseract_task_composer/core/test_suite/test_programs.hpp>
 
@@ -1775,6 +1781,44 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerIterativeSplineParameteriz
     EXPECT_TRUE(input->task_infos.getAbortingNode().is_nil());
   }
 
+  {  // Test run method, moves without a registered move profile use the composite profile
+    CompositeInstruction upsampled;
+    {
+      TaskComposerDataStorage data;
+      data.setData("input_data", test_suite::jointInterpolateExampleProgramABB(false));
+      auto profiles = std::make_shared<ProfileDictionary>();
+      auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+      auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+      UpsampleTrajectoryTask task("abc", "input_data", "output_data", true);
+      EXPECT_EQ(task.run(*input), 1);
+      upsampled = input->data_storage.getData("output_data").as<CompositeInstruction>();
+    }
+
+    for (auto& move : upsampled.flatten(moveFilter))
+      move.get().as<MoveInstructionPoly>().setProfile("UNREGISTERED_MOVE_PROFILE");
+
+    auto getDuration = [this, &upsampled](double scaling_factor) {
+      auto profile = std::make_shared<IterativeSplineParameterizationProfile>(scaling_factor, scaling_factor);
+      auto profiles = std::make_shared<ProfileDictionary>();
+      profiles->addProfile<IterativeSplineParameterizationProfile>("abc", upsampled.getProfile(), profile);
+
+      TaskComposerDataStorage data;
+      data.setData("input_data", upsampled);
+      auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+      auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+      IterativeSplineParameterizationTask task("abc", "input_data", "output_data", true);
+      EXPECT_EQ(task.run(*input), 1);
+
+      const auto& results = input->data_storage.getData("output_data").as<CompositeInstruction>();
+      return results.getLastMoveInstruction()->getWaypoint().as<StateWaypointPoly>().getTime();
+    };
+
+    double full_duration = getDuration(1.0);
+    double scaled_duration = getDuration(0.1);
+    EXPECT_GT(full_duration, 0);
+    EXPECT_GT(scaled_duration, 5 * full_duration);
+  }
+
   {  // Failure missing input data
     auto profiles = std::make_shared<ProfileDictionary>();
     TaskComposerDataStorage data;
@@ -1916,6 +1960,144 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerTimeOptimalParameterizatio
     EXPECT_TRUE(input->task_infos.getAbortingNode().is_nil());
   }
 
+  {  // Test run method segment wise
+    CompositeInstruction upsampled;
+    {
+      TaskComposerDataStorage data;
+      data.setData("input_data", test_suite::jointInterpolateExampleProgramABB(false));
+      auto profiles = std::make_shared<ProfileDictionary>();
+      auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+      auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+      UpsampleTrajectoryTask task("abc", "input_data", "output_data", true);
+      EXPECT_EQ(task.run(*input), 1);
+      upsampled = input->data_storage.getData("output_data").as<CompositeInstruction>();
+    }
+
+    // Split the trajectory into two segments
+    CompositeInstruction program(upsampled);
+    program.clear();
+    CompositeInstruction segment1(program);
+    CompositeInstruction segment2(program);
+    for (std::size_t i = 0; i < upsampled.size(); ++i)
+      (i < 9 ? segment1 : segment2).push_back(upsampled[i]);
+    program.push_back(segment1);
+    program.push_back(segment2);
+    EXPECT_TRUE(canParameterizeSegments(program));
+
+    auto profile = std::make_shared<TimeOptimalParameterizationProfile>();
+    profile->parameterize_segments = true;
+    auto profiles = std::make_shared<ProfileDictionary>();
+    profiles->addProfile<TimeOptimalParameterizationProfile>("abc", program.getProfile(), profile);
+
+    TaskComposerDataStorage data;
+    data.setData("input_data", program);
+    auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+    auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+    tesseract_common::fs::path config_path(
+        locator_->locateResource("package://tesseract_task_composer/config/task_composer_plugins.yaml")->getFilePath());
+    TaskComposerPluginFactory factory(config_path);
+    auto executor = factory.createTaskComposerExecutor("TaskflowExecutor");
+    TimeOptimalParameterizationTask task("abc", "input_data", "output_data", true);
+    EXPECT_EQ(task.run(*input, *executor), 1);
+    auto node_info = input->task_infos.getInfo(task.getUUID());
+    EXPECT_EQ(node_info->color, "green");
+    EXPECT_EQ(node_info->return_value, 1);
+    EXPECT_EQ(input->isAborted(), false);
+    EXPECT_EQ(input->isSuccessful(), true);
+
+    // The segments are stitched back together with monotonically increasing time
+    const auto& results = input->data_storage.getData("output_data").as<CompositeInstruction>();
+    EXPECT_EQ(results.size(), 2);
+    auto moves = results.flatten(moveFilter);
+    EXPECT_EQ(moves.size(), 17);
+    double prev_time{ -1 };
+    for (const auto& move : moves)
+    {
+      double time = move.get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime();
+      EXPECT_GT(time, prev_time);
+      prev_time = time;
+    }
+  }
+
+  {  // Test segment wise matches the whole program when the program comes to rest between segments
+    CompositeInstruction upsampled;
+    {
+      TaskComposerDataStorage data;
+      data.setData("input_data", test_suite::jointInterpolateExampleProgramABB(false));
+      auto profiles = std::make_shared<ProfileDictionary>();
+      auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+      auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+      UpsampleTrajectoryTask task("abc", "input_data", "output_data", true);
+      EXPECT_EQ(task.run(*input), 1);
+      upsampled = input->data_storage.getData("output_data").as<CompositeInstruction>();
+    }
+
+    // The second segment returns along the same path so the motion reverses and must come to rest between them
+    CompositeInstruction program(upsampled);
+    program.clear();
+    CompositeInstruction segment1(upsampled);
+    CompositeInstruction segment2(program);
+    for (auto it = std::next(upsampled.rbegin()); it != upsampled.rend(); ++it)
+    {
+      InstructionPoly instruction = *it;
+      instruction.as<MoveInstructionPoly>().regenerateUUID();
+      segment2.push_back(instruction);
+    }
+    program.push_back(segment1);
+    program.push_back(segment2);
+    EXPECT_TRUE(canParameterizeSegments(program));
+
+    tesseract_common::fs::path config_path(
+        locator_->locateResource("package://tesseract_task_composer/config/task_composer_plugins.yaml")->getFilePath());
+    TaskComposerPluginFactory factory(config_path);
+    auto executor = factory.createTaskComposerExecutor("TaskflowExecutor");
+
+    // A non default scaling makes sure the segment tasks use the same profile as the whole program
+    auto parameterize = [&](bool parameterize_segments, double scaling) {
+      auto profile = std::make_shared<TimeOptimalParameterizationProfile>();
+      profile->parameterize_segments = parameterize_segments;
+      profile->max_velocity_scaling_factor = scaling;
+      profile->max_acceleration_scaling_factor = scaling;
+      auto profiles = std::make_shared<ProfileDictionary>();
+      profiles->addProfile<TimeOptimalParameterizationProfile>("abc", program.getProfile(), profile);
+
+      TaskComposerDataStorage data;
+      data.setData("input_data", program);
+      auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+      auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+      TimeOptimalParameterizationTask task("abc", "input_data", "output_data", true);
+      EXPECT_EQ(task.run(*input, *executor), 1);
+      EXPECT_EQ(input->isSuccessful(), true);
+      return input->data_storage.getData("output_data").as<CompositeInstruction>();
+    };
+
+    const CompositeInstruction whole_results = parameterize(false, 0.5);
+    const CompositeInstruction segment_results = parameterize(true, 0.5);
+    const CompositeInstruction unscaled_results = parameterize(false, 1.0);
+    auto whole_moves = whole_results.flatten(moveFilter);
+    auto segment_moves = segment_results.flatten(moveFilter);
+    ASSERT_EQ(whole_moves.size(), 33);
+    ASSERT_EQ(segment_moves.size(), whole_moves.size());
+
+    // Each segment is forced to rest at its boundaries
+    const auto& boundary = segment_moves[16].get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>();
+    EXPECT_NEAR(boundary.getVelocity().norm(), 0, 1e-6);
+
+    const double duration =
+        whole_moves.back().get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime();
+    const double unscaled_duration =
+        unscaled_results.getLastMoveInstruction()->getWaypoint().as<StateWaypointPoly>().getTime();
+    EXPECT_GT(duration, 1.5 * unscaled_duration);
+    for (std::size_t i = 0; i < whole_moves.size(); ++i)
+    {
+      const auto& whole_swp = whole_moves[i].get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>();
+      const auto& segment_swp =
+          segment_moves[i].get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>();
+      EXPECT_TRUE(whole_swp.getPosition().isApprox(segment_swp.getPosition(), 1e-6));
+      EXPECT_NEAR(whole_swp.getTime(), segment_swp.getTime(), 0.05 * duration);
+    }
+  }
+
   {  // Failure missing input data
     auto profiles = std::make_shared<ProfileDictionary>();
     TaskComposerDataStorage data;
@@ -2039,6 +2221,43 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRuckigTrajectorySmoothingT
     EXPECT_TRUE(input->task_infos.getAbortingNode().is_nil());
   }
 
+  {  // Test run method using local smoothing
+    // Create input data
+    TaskComposerDataStorage data;
+    {
+      data.setData("input_data", test_suite::jointInterpolateExampleProgramABB(false));
+      auto profiles = std::make_shared<ProfileDictionary>();
+      auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+      auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+      UpsampleTrajectoryTask task("abc", "input_data", "output_data", true);
+      EXPECT_EQ(task.run(*input), 1);
+      data.setData("input_data", input->data_storage.getData("output_data"));
+
+      auto problem2 = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+      auto input2 = std::make_unique<TaskComposerInput>(std::move(problem2));
+      TimeOptimalParameterizationTask task2("abc", "input_data", "output_data", true);
+      EXPECT_EQ(task2.run(*input2), 1);
+      data.setData("input_data", input2->data_storage.getData("output_data"));
+    }
+
+    auto profile = std::make_shared<RuckigTrajectorySmoothingCompositeProfile>();
+    profile->smoothing_mode = RuckigSmoothingMode::LOCAL;
+    profile->num_threads = 4;
+    auto profiles = std::make_shared<ProfileDictionary>();
+    profiles->addProfile<RuckigTrajectorySmoothingCompositeProfile>(
+        "abc", data.getData("input_data").as<CompositeInstruction>().getProfile(), profile);
+
+    auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, manip_, data, profiles, "abc");
+    auto input = std::make_unique<TaskComposerInput>(std::move(problem));
+    RuckigTrajectorySmoothingTask task("abc", "input_data", "output_data", true);
+    EXPECT_EQ(task.run(*input), 1);
+    auto node_info = input->task_infos.getInfo(task.getUUID());
+    EXPECT_EQ(node_info->color, "green");
+    EXPECT_EQ(node_info->return_value, 1);
+    EXPECT_EQ(input->isSuccessful(), true);
+    EXPECT_EQ(input->data_storage.getData("output_data").as<CompositeInstruction>().size(), 17);
+  }
+
   {  // Test run method
     TaskComposerDataStorage data;
     auto program = test_suite::jointInterpolateExampleProgramABB(false);
@@ -2219,6 +2438,7 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRasterMotionTaskTests)  //
                            conditional: true
                            inputs: [input_data]
                            outputs: [output_data]
+                           max_segment_retries: 2
                            freespace:
                              task: FreespacePipeline
                              config:
@@ -2242,6 +2462,8 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRasterMotionTaskTests)  //
     EXPECT_EQ(task.getInputKeys().front(), "input_data");
     EXPECT_EQ(task.getOutputKeys().size(), 1);
     EXPECT_EQ(task.getOutputKeys().front(), "output_data");
+    EXPECT_EQ(task.getMaxSegmentRetries(), 2);
+    EXPECT_TRUE(task.getSegmentCache() == nullptr);
     EXPECT_EQ(task.getOutboundEdges().size(), 0);
     EXPECT_EQ(task.getInboundEdges().size(), 0);
   }
@@ -2570,6 +2792,223 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerRasterMotionTaskTests)  //
     EXPECT_TRUE(input->task_infos.getAbortingNode().is_nil());
   }
 
+  {  // Failed segments are scoped and replanned while the planned segments are kept
+    // Segments are planned by copying their input to their output, the first attempt of transition #1 fails
+    std::map<std::string, int> factory_calls;
+    auto create_factory = [&factory_calls](const std::string& prefix) {
+      return [&factory_calls, prefix](const std::string& name, std::size_t index) {
+        const int call = factory_calls[name]++;
+        RasterMotionTask::TaskFactoryResults results;
+        results.input_key = prefix + "_input_data" + std::to_string(index);
+        results.output_key = prefix + "_output_data" + std::to_string(index);
+        if (prefix == "transition" && index == 1 && call == 0)
+          results.node = std::make_unique<AbortTask>(name, false);
+        else
+          results.node = std::make_unique<RemapTask>(
+              name, std::map<std::string, std::string>{ { results.input_key, results.output_key } }, true);
+        return results;
+      };
+    };
+
+    for (const std::size_t retries : std::vector<std::size_t>{ 0, 1 })
+    {
+      factory_calls.clear();
+      RasterMotionTask task("abc",
+                            "input_data",
+                            "output_data",
+                            true,
+                            create_factory("freespace"),
+                            create_factory("raster"),
+                            create_factory("transition"),
+                            retries);
+      EXPECT_EQ(task.getMaxSegmentRetries(), retries);
+
+      TaskComposerDataStorage data;
+      data.setData("input_data", test_suite::rasterExampleProgram());
+      auto profiles = std::make_shared<ProfileDictionary>();
+      auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, data, profiles);
+      auto input = std::make_shared<TaskComposerInput>(std::move(problem));
+      input->dotgraph = true;
+
+      auto executor = factory.createTaskComposerExecutor("TaskflowExecutor");
+      executor->run(task, *input)->wait();
+
+      // The failed transition does not abort the input or the other segments
+      EXPECT_FALSE(input->isAborted());
+      EXPECT_TRUE(input->task_infos.getAbortingNode().is_nil());
+      EXPECT_TRUE(input->data_storage.hasKey("raster_output_data1"));
+      EXPECT_TRUE(input->data_storage.hasKey("raster_output_data2"));
+      EXPECT_TRUE(input->data_storage.hasKey("raster_output_data3"));
+      EXPECT_TRUE(input->data_storage.hasKey("raster_output_data4"));
+      EXPECT_TRUE(input->data_storage.hasKey("transition_output_data2"));
+      EXPECT_TRUE(input->data_storage.hasKey("transition_output_data3"));
+      EXPECT_TRUE(input->data_storage.hasKey("freespace_output_data1"));
+      EXPECT_TRUE(input->data_storage.hasKey("freespace_output_data2"));
+
+      auto node_info = input->task_infos.getInfo(task.getUUID());
+      ASSERT_TRUE(node_info != nullptr);
+      EXPECT_FALSE(node_info->dotgraph.empty());
+      if (retries == 0)
+      {
+        EXPECT_EQ(node_info->return_value, 0);
+        EXPECT_NE(node_info->message.find("Transition #1"), std::string::npos);
+        EXPECT_EQ(node_info->message.find("Transition #2"), std::string::npos);
+        EXPECT_FALSE(input->data_storage.hasKey("output_data"));
+      }
+      else
+      {
+        // Only the failed transition is planned again
+        EXPECT_EQ(node_info->return_value, 1);
+        EXPECT_TRUE(input->data_storage.hasKey("output_data"));
+        EXPECT_EQ(input->data_storage.getData("output_data").as<CompositeInstruction>().size(),
+                  test_suite::rasterExampleProgram().size());
+        for (const auto& pair : factory_calls)
+          EXPECT_EQ(pair.second, (pair.first.rfind("Transition #1", 0) == 0) ? 2 : 1) << pair.first;
+      }
+    }
+  }
+
+  {  // Segments which did not change are reused from the cache
+    auto create_factory = [](const std::string& prefix) {
+      return [prefix](const std::string& name, std::size_t index) {
+        RasterMotionTask::TaskFactoryResults results;
+        results.input_key = prefix + "_input_data" + std::to_string(index);
+        results.output_key = prefix + "_output_data" + std::to_string(index);
+        results.node = std::make_unique<RemapTask>(
+            name, std::map<std::string, std::string>{ { results.input_key, results.output_key } }, true);
+        return results;
+      };
+    };
+
+    auto cache = std::make_shared<RasterSegmentCache>();
+    RasterMotionTask task("abc",
+                          "input_data",
+                          "output_data",
+                          true,
+                          create_factory("freespace"),
+                          create_factory("raster"),
+                          create_factory("transition"),
+                          0,
+                          cache);
+    EXPECT_EQ(task.getSegmentCache(), cache);
+
+    auto profiles = std::make_shared<ProfileDictionary>();
+    auto executor = factory.createTaskComposerExecutor("TaskflowExecutor");
+    auto run = [&](const CompositeInstruction& program) {
+      TaskComposerDataStorage data;
+      data.setData("input_data", program);
+      auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, data, profiles);
+      auto input = std::make_shared<TaskComposerInput>(std::move(problem));
+      executor->run(task, *input)->wait();
+      EXPECT_TRUE(input->isSuccessful());
+      EXPECT_EQ(input->task_infos.getInfo(task.getUUID())->return_value, 1);
+      return input->data_storage.getData("output_data").as<CompositeInstruction>();
+    };
+
+    // The example program has four rasters, three transitions, from start and to end
+    CompositeInstruction program = test_suite::rasterExampleProgram();
+    CompositeInstruction output = run(program);
+    // Only the rasters are looked up, the other segments are not reused since the rasters were planned
+    EXPECT_EQ(cache->size(), 9);
+    EXPECT_EQ(cache->getHits(), 0);
+    EXPECT_EQ(cache->getMisses(), 4);
+
+    // The same program created again has new uuids but all segments are reused
+    CompositeInstruction cached_output = run(test_suite::rasterExampleProgram());
+    EXPECT_EQ(cache->getHits(), 9);
+    EXPECT_EQ(cache->getMisses(), 4);
+    EXPECT_EQ(cached_output.size(), output.size());
+
+    // Editing the second raster replans it and the transitions connected to it, which are not looked up
+    program[3].as<CompositeInstruction>().setDescription("Edited raster");
+    run(program);
+    EXPECT_EQ(cache->getHits(), 15);
+    EXPECT_EQ(cache->getMisses(), 5);
+    EXPECT_EQ(cache->size(), 12);
+
+    {  // A segment is not reused if a raster it depends on was evicted and is replanned
+      auto small_cache = std::make_shared<RasterSegmentCache>(5);
+      RasterMotionTask small_task("abc",
+                                  "input_data",
+                                  "output_data",
+                                  true,
+                                  create_factory("freespace"),
+                                  create_factory("raster"),
+                                  create_factory("transition"),
+                                  0,
+                                  small_cache);
+
+      // Only the last five segments are kept, so the second transition is stored but its first raster is not
+      for (int i = 0; i < 2; ++i)
+      {
+        TaskComposerDataStorage data;
+        data.setData("input_data", test_suite::rasterExampleProgram());
+        auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, data, profiles);
+        auto input = std::make_shared<TaskComposerInput>(std::move(problem));
+        executor->run(small_task, *input)->wait();
+        EXPECT_EQ(input->task_infos.getInfo(small_task.getUUID())->return_value, 1);
+      }
+      EXPECT_EQ(small_cache->getHits(), 4);
+      EXPECT_EQ(small_cache->getMisses(), 6);
+    }
+
+    // The dependencies and profiles are part of the key
+    auto problem = std::make_unique<PlanningTaskComposerProblem>(env_, TaskComposerDataStorage(), profiles);
+    auto problem_key = RasterSegmentCache::createProblemKey(*problem);
+    const auto& raster = program[1].as<CompositeInstruction>();
+    const RasterSegmentCache::Key key = RasterSegmentCache::createKey(raster, problem_key);
+    const RasterSegmentCache::Key other_key = RasterSegmentCache::createKey(program[3].as<CompositeInstruction>(),
+                                                                            problem_key);
+    EXPECT_EQ(key, RasterSegmentCache::createKey(raster, problem_key));
+    EXPECT_EQ(key,
+              RasterSegmentCache::createKey(test_suite::rasterExampleProgram()[1].as<CompositeInstruction>(),
+                                            RasterSegmentCache::createProblemKey(*problem)));
+    EXPECT_NE(key, other_key);
+    EXPECT_NE(key, RasterSegmentCache::createKey(raster, problem_key, { &other_key }));
+
+    // A rebuilt profile dictionary holding the same profiles gives an equal key, adding a profile changes it
+    auto profile = std::make_shared<IterativeSplineParameterizationProfile>();
+    problem->profiles = [&profile] {
+      auto rebuilt = std::make_shared<ProfileDictionary>();
+      rebuilt->addProfile<IterativeSplineParameterizationProfile>("abc", "DEFAULT", profile);
+      return rebuilt;
+    }();
+    const RasterSegmentCache::Key profile_key =
+        RasterSegmentCache::createKey(raster, RasterSegmentCache::createProblemKey(*problem));
+    EXPECT_NE(key, profile_key);
+    auto rebuilt = std::make_shared<ProfileDictionary>();
+    rebuilt->addProfile<IterativeSplineParameterizationProfile>("abc", "DEFAULT", profile);
+    problem->profiles = rebuilt;
+    EXPECT_EQ(profile_key, RasterSegmentCache::createKey(raster, RasterSegmentCache::createProblemKey(*problem)));
+    rebuilt->addProfile<IterativeSplineParameterizationProfile>(
+        "abc", "DEFAULT", std::make_shared<IterativeSplineParameterizationProfile>());
+    EXPECT_NE(profile_key, RasterSegmentCache::createKey(raster, RasterSegmentCache::createProblemKey(*problem)));
+
+    // Keys with the same hash but different content do not match
+    RasterSegmentCache::Key colliding_key = other_key;
+    colliding_key.hash = key.hash;
+    RasterSegmentCache collision_cache;
+    collision_cache.put(key, CompositeInstruction());
+    EXPECT_TRUE(collision_cache.get(key).has_value());
+    EXPECT_FALSE(collision_cache.get(colliding_key).has_value());
+
+    // The least recently used segment is removed when the cache is full
+    const RasterSegmentCache::Key third_key =
+        RasterSegmentCache::createKey(program[5].as<CompositeInstruction>(), problem_key);
+    RasterSegmentCache small_cache(2);
+    small_cache.put(key, CompositeInstruction());
+    small_cache.put(other_key, CompositeInstruction());
+    EXPECT_TRUE(small_cache.get(key).has_value());
+    small_cache.put(third_key, CompositeInstruction());
+    EXPECT_EQ(small_cache.size(), 2);
+    EXPECT_TRUE(small_cache.get(key).has_value());
+    EXPECT_FALSE(small_cache.get(other_key).has_value());
+    EXPECT_TRUE(small_cache.get(third_key).has_value());
+    small_cache.clear();
+    EXPECT_EQ(small_cache.size(), 0);
+    EXPECT_EQ(small_cache.getHits(), 0);
+  }
+
   {  // Failure missing input data
     std::string str = R"(config:
                            conditional: true
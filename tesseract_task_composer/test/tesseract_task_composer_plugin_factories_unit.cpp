@@ -26,6 +26,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
@@ -159,6 +160,49 @@ TEST(TesseractTaskComposerFactoryUnit, LoadAndExportPluginTest)  // NOLINT
   }
 }
 
+TEST(TesseractTaskComposerFactoryUnit, PreloadAndConcurrentCreateTest)  // NOLINT
+{
+#ifdef TESSERACT_TASK_COMPOSER_HAS_TRAJOPT_IFOPT
+  tesseract_common::fs::path config_path(std::string(TESSERACT_TASK_COMPOSER_DIR) + "/config/"
+                                                                                    "task_composer_plugins.yaml");
+#else
+  tesseract_common::fs::path config_path(std::string(TESSERACT_TASK_COMPOSER_DIR) + "/config/"
+                                                                                    "task_composer_plugins_no_"
+                                                                                    "trajopt_"
+                                                                                    "ifopt.yaml");
+#endif
+
+  // The factories are loaded with the config
+  TaskComposerPluginFactory factory(config_path);
+  EXPECT_GT(factory.getPreloadTime(), 0);
+  EXPECT_TRUE(factory.preloadFactories());
+
+  // Create every node from multiple threads using the preloaded factories
+  tesseract_common::PluginInfoMap plugins = factory.getTaskComposerNodePlugins();
+  std::vector<std::thread> threads;
+  std::vector<int> failures(4, 0);
+  for (std::size_t i = 0; i < failures.size(); ++i)
+  {
+    threads.emplace_back([&factory, &plugins, &failures, i]() {
+      for (const auto& plugin : plugins)
+      {
+        if (factory.createTaskComposerNode(plugin.first) == nullptr)
+          ++failures[i];
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  for (int failure : failures)
+    EXPECT_EQ(failure, 0);
+
+  // A copy shares the loaded factories
+  TaskComposerPluginFactory factory_copy(factory);
+  EXPECT_TRUE(factory_copy.createTaskComposerNode(plugins.begin()->first) != nullptr);
+}
+
 TEST(TesseractTaskComposerFactoryUnit, PluginFactorAPIUnit)  // NOLINT
 {
   TaskComposerPluginFactory factory;
@@ -3,14 +3,99 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
 #include <sstream>
+#include <atomic>
+#include <future>
+#include <map>
 #include <memory>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_common/joint_state.h>
 #include <tesseract_task_composer/taskflow/taskflow_task_composer_executor.h>
+#include <tesseract_task_composer/core/nodes/done_task.h>
+#include <tesseract_task_composer/core/nodes/race_task.h>
 #include <tesseract_task_composer/core/test_suite/task_composer_executor_unit.hpp>
 
+TESSERACT_ANY_EXPORT(tesseract_common, JointState)
+
 using namespace tesseract_planning;
 
+/** @brief A task which takes time to run like a motion planner, writing its name to the output on success */
+class DelayTask : public TaskComposerTask
+{
+public:
+  DelayTask(std::string name, double delay, int return_value)
+    : TaskComposerTask(std::move(name), true), delay_(delay), return_value_(return_value)
+  {
+    input_keys_.emplace_back("input_data");
+    output_keys_.emplace_back("output_data");
+  }
+
+protected:
+  double delay_;
+  int return_value_;
+
+  TaskComposerNodeInfo::UPtr runImpl(TaskComposerInput& input,
+                                     OptionalTaskComposerExecutor /*executor*/) const override final
+  {
+    std::this_thread::sleep_for(std::chrono::duration<double>(delay_));
+
+    auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+    info->return_value = (input.data_storage.hasKey(input_keys_[0])) ? return_value_ : 0;
+    info->color = (info->return_value == 0) ? "red" : "green";
+    if (info->return_value != 0)
+    {
+      tesseract_common::JointState js({ name_ }, Eigen::VectorXd::Zero(1));
+      input.data_storage.setData(output_keys_[0], js);
+    }
+    return info;
+  }
+};
+
+/** @brief A task which waits until it is released, recording if its input was aborted while it was waiting */
+class GateTask : public TaskComposerTask
+{
+public:
+  GateTask(std::string name, std::shared_future<void> release, std::shared_ptr<std::atomic<bool>> aborted)
+    : TaskComposerTask(std::move(name), true), release_(std::move(release)), aborted_(std::move(aborted))
+  {
+    input_keys_.emplace_back("input_data");
+    output_keys_.emplace_back("output_data");
+  }
+
+protected:
+  std::shared_future<void> release_;
+  std::shared_ptr<std::atomic<bool>> aborted_;
+
+  TaskComposerNodeInfo::UPtr runImpl(TaskComposerInput& input,
+                                     OptionalTaskComposerExecutor /*executor*/) const override final
+  {
+    release_.wait();
+    *aborted_ = input.isAborted();
+
+    auto info = std::make_unique<TaskComposerNodeInfo>(*this);
+    info->return_value = 1;
+    info->color = "green";
+    tesseract_common::JointState js({ name_ }, Eigen::VectorXd::Zero(1));
+    input.data_storage.setData(output_keys_[0], js);
+    return info;
+  }
+};
+
+/** @brief Run the node and wait for it to finish */
+void runNode(TaskComposerExecutor& executor, const TaskComposerNode& node, TaskComposerInput& input)
+{
+  executor.run(node, input)->wait();
+}
+
+/** @brief Create an input with the input data set */
+TaskComposerInput::UPtr createInput()
+{
+  auto input = std::make_unique<TaskComposerInput>(std::make_unique<TaskComposerProblem>());
+  input->data_storage.setData("input_data", tesseract_common::JointState());
+  return input;
+}
+
 TEST(TesseractTaskComposerTaskflowUnit, TaskComposerExecutorTests)  // NOLINT
 {
   test_suite::runTaskComposerExecutorTest<TaskflowTaskComposerExecutor>();
@@ -34,6 +119,204 @@ TEST(TesseractTaskComposerTaskflowUnit, TaskComposerExecutorTests)  // NOLINT
   }
 }
 
+TEST(TesseractTaskComposerTaskflowUnit, PriorityPartitionTests)  // NOLINT
+{
+  {  // Test YAML Config loading
+    std::string str = R"(config:
+                           threads: 3
+                           priorities:
+                             - priority: 10
+                               threads: 2
+                             - priority: 1
+                               threads: 1)";
+    YAML::Node config = YAML::Load(str);
+    auto executor = std::make_unique<TaskflowTaskComposerExecutor>("TaskComposerExecutorTests", config["config"]);
+    EXPECT_EQ(executor->getWorkerCount(), 6);
+    EXPECT_EQ(executor->getTaskCount(), 0);
+    const std::map<int, std::size_t> priority_threads{ { 1, 1 }, { 10, 2 } };
+    EXPECT_EQ(executor->getPriorityThreads(), priority_threads);
+    EXPECT_FALSE(*executor == TaskflowTaskComposerExecutor("TaskComposerExecutorTests", 3));
+    EXPECT_TRUE(*executor == TaskflowTaskComposerExecutor("TaskComposerExecutorTests", 3, priority_threads));
+
+    // Every priority runs
+    for (int priority : { -1, 0, 1, 5, 10, 20 })
+    {
+      DoneTask task;
+      auto input = createInput();
+      input->priority = priority;
+      runNode(*executor, task, *input);
+      EXPECT_TRUE(input->isSuccessful());
+      EXPECT_EQ(input->task_infos.getInfoMap().size(), 1);
+    }
+
+    test_suite::runSerializationPointerTest(executor, "TaskflowPriorityExecutorTests");
+  }
+
+  {  // Failures
+    std::vector<std::string> configs{ R"(config:
+                                           priorities:
+                                             - priority: 1
+                                               threads: 0)",
+                                      R"(config:
+                                           priorities:
+                                             - threads: 1)",
+                                      R"(config:
+                                           priorities:
+                                             - priority: 1
+                                               threads: 1
+                                             - priority: 1
+                                               threads: 2)" };
+    for (const auto& str : configs)
+    {
+      YAML::Node config = YAML::Load(str);
+      // NOLINTNEXTLINE
+      EXPECT_ANY_THROW(std::make_unique<TaskflowTaskComposerExecutor>("TaskComposerExecutorTests", config["config"]));
+    }
+
+    std::map<int, std::size_t> priority_threads{ { 1, 0 } };
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(std::make_unique<TaskflowTaskComposerExecutor>("TaskComposerExecutorTests", 2, priority_threads));
+  }
+
+  {  // Inputs run on the partition with the highest priority not greater than their priority
+    TaskflowTaskComposerExecutor executor("PartitionedExecutor", 1, { { 1, 1 }, { 10, 1 } });
+    std::map<int, std::size_t> thread_ids;
+    for (int priority : { -1, 0, 1, 5, 10, 20 })
+    {
+      DoneTask task;
+      auto input = createInput();
+      input->priority = priority;
+      runNode(executor, task, *input);
+      auto info = input->task_infos.getInfo(task.getUUID());
+      ASSERT_TRUE(info != nullptr);
+      thread_ids[priority] = info->thread_id;
+    }
+
+    // Each partition has a single worker, so inputs of the same partition run on the same thread
+    EXPECT_EQ(thread_ids[-1], thread_ids[0]);
+    EXPECT_EQ(thread_ids[1], thread_ids[5]);
+    EXPECT_EQ(thread_ids[10], thread_ids[20]);
+    EXPECT_NE(thread_ids[0], thread_ids[1]);
+    EXPECT_NE(thread_ids[0], thread_ids[10]);
+    EXPECT_NE(thread_ids[1], thread_ids[10]);
+  }
+
+  {  // An interactive input is not queued behind batch inputs occupying the workers of the default partition
+    TaskflowTaskComposerExecutor executor("PartitionedExecutor", 2, { { 1, 1 } });
+    std::promise<void> release;
+    GateTask batch_task("Batch", release.get_future().share(), std::make_shared<std::atomic<bool>>(false));
+    std::vector<TaskComposerInput::UPtr> batch_inputs;
+    std::vector<TaskComposerFuture::UPtr> batch_futures;
+    for (int i = 0; i < 4; ++i)
+    {
+      batch_inputs.push_back(createInput());
+      batch_futures.push_back(executor.run(batch_task, *batch_inputs.back()));
+    }
+
+    DoneTask interactive_task;
+    auto input = createInput();
+    input->priority = 1;
+    TaskComposerFuture::UPtr future = executor.run(interactive_task, *input);
+
+    // The batch inputs can not finish before they are released, the timeout only guards against a hang
+    EXPECT_EQ(future->waitFor(std::chrono::seconds(10)), std::future_status::ready);
+    for (const auto& batch_future : batch_futures)
+      EXPECT_FALSE(batch_future->ready());
+
+    release.set_value();
+    future->wait();
+    for (const auto& batch_future : batch_futures)
+      batch_future->wait();
+
+    EXPECT_TRUE(input->isSuccessful());
+  }
+}
+
+TEST(TesseractTaskComposerTaskflowUnit, RaceTaskTests)  // NOLINT
+{
+  TaskflowTaskComposerExecutor executor("TaskComposerExecutorTests", 4);
+  const std::vector<std::string> input_keys{ "input_data" };
+  const std::vector<std::string> output_keys{ "output_data" };
+
+  {  // The first successful branch wins and the other branches are aborted
+    std::promise<void> release;
+    auto slow_aborted = std::make_shared<std::atomic<bool>>(false);
+    auto fast = std::make_shared<DelayTask>("Fast", 0.01, 1);
+    auto slow = std::make_shared<GateTask>("Slow", release.get_future().share(), slow_aborted);
+    {
+      RaceTask race("RaceTask", input_keys, output_keys, { slow, fast });
+      EXPECT_EQ(race.getBranches().size(), 2);
+
+      // The losing branch is released once the race ended, the race waits for it on destruction
+      auto input = createInput();
+      runNode(executor, race, *input);
+      release.set_value();
+      EXPECT_TRUE(input->isSuccessful());
+
+      auto info = input->task_infos.getInfo(race.getUUID());
+      ASSERT_TRUE(info != nullptr);
+      EXPECT_EQ(info->return_value, 1);
+      const auto& race_info = dynamic_cast<const RaceTaskInfo&>(*info);
+      EXPECT_EQ(race_info.winner, 1);
+      EXPECT_EQ(race_info.winner_name, "Fast");
+      ASSERT_EQ(race_info.branch_elapsed_times.size(), 2);
+      EXPECT_EQ(race_info.branch_elapsed_times[0], 0);
+      EXPECT_GT(race_info.branch_elapsed_times[1], 0);
+      EXPECT_EQ(input->data_storage.getData("output_data").as<tesseract_common::JointState>().joint_names.front(),
+                "Fast");
+
+      // The infos of the winning branch are kept
+      EXPECT_TRUE(input->task_infos.getInfo(fast->getUUID()) != nullptr);
+      EXPECT_TRUE(input->task_infos.getInfo(slow->getUUID()) == nullptr);
+    }
+    EXPECT_TRUE(*slow_aborted);
+  }
+
+  {  // A failed branch does not win even if it finishes first
+    auto fail = std::make_shared<DelayTask>("Fail", 0.01, 0);
+    auto slow = std::make_shared<DelayTask>("Slow", 0.1, 1);
+    RaceTask race("RaceTask", input_keys, output_keys, { fail, slow });
+
+    auto input = createInput();
+    runNode(executor, race, *input);
+    EXPECT_TRUE(input->isSuccessful());
+
+    auto info = input->task_infos.getInfo(race.getUUID());
+    EXPECT_EQ(info->return_value, 1);
+    const auto& race_info = dynamic_cast<const RaceTaskInfo&>(*info);
+    EXPECT_EQ(race_info.winner, 1);
+    EXPECT_EQ(race_info.winner_name, "Slow");
+    EXPECT_GT(race_info.branch_elapsed_times[0], 0);
+    EXPECT_GT(race_info.branch_elapsed_times[1], 0);
+  }
+
+  {  // All branches fail
+    auto fail1 = std::make_shared<DelayTask>("Fail1", 0.01, 0);
+    auto fail2 = std::make_shared<DelayTask>("Fail2", 0.02, 0);
+    RaceTask race("RaceTask", input_keys, output_keys, { fail1, fail2 });
+
+    auto input = createInput();
+    runNode(executor, race, *input);
+
+    auto info = input->task_infos.getInfo(race.getUUID());
+    EXPECT_EQ(info->return_value, 0);
+    EXPECT_EQ(dynamic_cast<const RaceTaskInfo&>(*info).winner, -1);
+    EXPECT_FALSE(input->data_storage.hasKey("output_data"));
+  }
+
+  {  // Running without an executor fails
+    auto fast = std::make_shared<DelayTask>("Fast", 0.01, 1);
+    RaceTask race("RaceTask", input_keys, output_keys, { fast });
+    auto input = createInput();
+    EXPECT_EQ(race.run(*input), 0);
+  }
+
+  {  // Construction failure
+    std::vector<TaskComposerNode::Ptr> branches;
+    EXPECT_ANY_THROW(std::make_unique<RaceTask>("RaceTask", input_keys, output_keys, branches));  // NOLINT
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
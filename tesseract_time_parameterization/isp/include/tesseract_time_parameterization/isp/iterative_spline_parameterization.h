@@ -74,10 +74,36 @@ namespace tesseract_planning
 /// If this is a problem, try retuning (increasing) the limits.
 ///
 
+/** @brief Information about the iterations performed by IterativeSplineParameterization::compute */
+struct IterativeSplineParameterizationResult
+{
+  /** @brief The number of spline fit and interval stretch iterations performed */
+  long iterations{ 0 };
+
+  /** @brief False if the max number of iterations was reached before the accelerations were within bounds */
+  bool converged{ false };
+
+  /** @brief The largest fraction of the required interval stretch applied in a single iteration */
+  double max_stretch_gain{ 0 };
+
+  /** @brief The factor all intervals were stretched by to force the trajectory within bounds */
+  double global_adjustment_factor{ 1 };
+};
+
 class IterativeSplineParameterization
 {
 public:
-  IterativeSplineParameterization(bool add_points = true);
+  /**
+   * @brief Constructor
+   * @param add_points If true, add two points to trajectory (first and last segments)
+   * @param max_iterations The max number of interval stretch iterations. If reached the final global adjustment still
+   * forces the trajectory within bounds, but it will be slower than necessary. If zero or negative there is no limit,
+   * which is the default.
+   * @param adaptive_stretch If true, intervals which violate the acceleration bounds for consecutive iterations are
+   * stretched by an increasing fraction (1/16th up to 1/4) of the required stretch instead of a fixed 1/16th. This
+   * requires fewer iterations on long trajectories at the cost of a slightly longer duration.
+   */
+  IterativeSplineParameterization(bool add_points = true, long max_iterations = 0, bool adaptive_stretch = false);
   virtual ~IterativeSplineParameterization();
   IterativeSplineParameterization(const IterativeSplineParameterization&) = default;
   IterativeSplineParameterization& operator=(const IterativeSplineParameterization&) = default;
@@ -136,13 +162,15 @@ public:
    * @param max_accelerations The max acceleration for each joint
    * @param max_velocity_scaling_factor The max velocity scaling factor. Size should be trajectory.size()
    * @param max_acceleration_scaling_factor The max acceleration scaling factor. Size should be trajectory.size()
+   * @param result If not a nullptr it is populated with information about the iterations performed
    * @return True if successful, otherwise false
    */
   bool compute(TrajectoryContainer& trajectory,
                const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
                const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
                const Eigen::Ref<const Eigen::VectorXd>& max_velocity_scaling_factors,
-               const Eigen::Ref<const Eigen::VectorXd>& max_acceleration_scaling_factors) const;
+               const Eigen::Ref<const Eigen::VectorXd>& max_acceleration_scaling_factors,
+               IterativeSplineParameterizationResult* result = nullptr) const;
 
 private:
   /**
@@ -151,6 +179,12 @@ private:
    * If false, move the 2nd and 2nd-last points.
    */
   bool add_points_;
+
+  /** @brief The max number of interval stretch iterations, if zero or negative there is no limit */
+  long max_iterations_;
+
+  /** @brief If true, the fraction of the required stretch applied grows for intervals which keep violating bounds */
+  bool adaptive_stretch_;
 };
 }  // namespace tesseract_planning
 
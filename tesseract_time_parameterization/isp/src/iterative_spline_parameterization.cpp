@@ -47,16 +47,32 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
-static void fit_cubic_spline(long n, const double dt[], const double x[], double x1[], double x2[]);  // NOLINT
-static void adjust_two_positions(long n,
-                                 const double dt[],  // NOLINT
-                                 double x[],         // NOLINT
-                                 double x1[],        // NOLINT
-                                 double x2[],        // NOLINT
-                                 double x2_i,        // NOLINT
-                                 double x2_f);       // NOLINT
-static void
-init_times(long n, double dt[], const double x[], const double max_velocity[], double min_velocity[]);  // NOLINT
+// The fraction of the required interval stretch applied per iteration, the original fixed value is 1/16th
+static constexpr double MIN_STRETCH_GAIN = 1.0 / 16.0;
+// The max fraction of the required interval stretch applied per iteration when using adaptive stretching
+static constexpr double MAX_STRETCH_GAIN = 0.25;
+// The growth of the stretch fraction for each consecutive iteration an interval violates the bounds
+static constexpr double STRETCH_GAIN_GROWTH = 1.5;
+
+// Stores the trajectory in [point][joint] order so each point is contiguous and operations across joints vectorize
+using RowMatrixXd = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+static void fit_cubic_splines(const Eigen::VectorXd& dt,
+                              const RowMatrixXd& x,
+                              RowMatrixXd& x1,
+                              RowMatrixXd& x2,
+                              Eigen::VectorXd& c);
+static void adjust_two_positions(const Eigen::VectorXd& dt,
+                                 RowMatrixXd& x,
+                                 RowMatrixXd& x1,
+                                 RowMatrixXd& x2,
+                                 const Eigen::RowVectorXd& x2_i,
+                                 const Eigen::RowVectorXd& x2_f,
+                                 Eigen::VectorXd& c);
+static void init_times(Eigen::VectorXd& dt,
+                       const RowMatrixXd& x,
+                       const RowMatrixXd& max_velocity,
+                       const RowMatrixXd& min_velocity);
 // static int fit_spline_and_adjust_times(const int n,
 //                                       double dt[],
 //                                       const double x[],
@@ -67,36 +83,32 @@ init_times(long n, double dt[], const double x[], const double max_velocity[], d
 //                                       const double max_acceleration,
 //                                       const double min_acceleration,
 //                                       const double tfactor);
-static double global_adjustment_factor(long n,
-                                       double dt[],                       // NOLINT
-                                       const double x[],                  // NOLINT
-                                       double x1[],                       // NOLINT
-                                       double x2[],                       // NOLINT
-                                       const double max_velocity[],       // NOLINT
-                                       const double min_velocity[],       // NOLINT
-                                       const double max_acceleration[],   // NOLINT
-                                       const double min_acceleration[]);  // NOLINT
-
-// The path of a single joint: positions, velocities, and accelerations
-struct SingleJointTrajectory
+static double global_adjustment_factor(const RowMatrixXd& x1,
+                                       const RowMatrixXd& x2,
+                                       const RowMatrixXd& max_velocity,
+                                       const RowMatrixXd& min_velocity,
+                                       const RowMatrixXd& max_acceleration,
+                                       const RowMatrixXd& min_acceleration);
+
+// Insert the 2nd and 2nd-last rows, copying the values of the first and last rows
+static RowMatrixXd insert_two_rows(const RowMatrixXd& m)
 {
-  std::vector<double> positions_;  // joint's position at time[x]
-  std::vector<double> velocities_;
-  std::vector<double> accelerations_;
-  double initial_acceleration_{ 0 };
-  double final_acceleration_{ 0 };
-  std::vector<double> min_velocity_;
-  std::vector<double> max_velocity_;
-  std::vector<double> min_acceleration_;
-  std::vector<double> max_acceleration_;
-};
-
-void globalAdjustment(std::vector<SingleJointTrajectory>& t2,
-                      long num_joints,
-                      long num_points,
-                      std::vector<double>& time_diff);
-
-IterativeSplineParameterization::IterativeSplineParameterization(bool add_points) : add_points_(add_points) {}
+  const Eigen::Index n = m.rows();
+  RowMatrixXd out(n + 2, m.cols());
+  out.row(0) = m.row(0);
+  out.row(1) = m.row(0);
+  out.middleRows(2, n - 2) = m.middleRows(1, n - 2);
+  out.row(n) = m.row(n - 1);
+  out.row(n + 1) = m.row(n - 1);
+  return out;
+}
+
+IterativeSplineParameterization::IterativeSplineParameterization(bool add_points,
+                                                                 long max_iterations,
+                                                                 bool adaptive_stretch)
+  : add_points_(add_points), max_iterations_(max_iterations), adaptive_stretch_(adaptive_stretch)
+{
+}
 
 IterativeSplineParameterization::~IterativeSplineParameterization() = default;
 
@@ -145,8 +157,12 @@ bool IterativeSplineParameterization::compute(
     const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
     const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
     const Eigen::Ref<const Eigen::VectorXd>& max_velocity_scaling_factors,
-    const Eigen::Ref<const Eigen::VectorXd>& max_acceleration_scaling_factors) const
+    const Eigen::Ref<const Eigen::VectorXd>& max_acceleration_scaling_factors,
+    IterativeSplineParameterizationResult* result) const
 {
+  if (result != nullptr)
+    *result = IterativeSplineParameterizationResult();
+
   if (trajectory.empty())
     return true;
 
@@ -214,88 +230,64 @@ bool IterativeSplineParameterization::compute(
   }
 
   // JointTrajectory indexes in [point][joint] order.
-  // We need [joint][point] order to solve efficiently,
-  // so convert form here.
-
-  std::vector<SingleJointTrajectory> t2(static_cast<std::size_t>(trajectory.dof()));
+  // The splines of all joints share the same time intervals so they are solved together,
+  // storing each point contiguously so the operations across joints are vectorized.
+  const Eigen::Index dof = trajectory.dof();
+  auto n = static_cast<Eigen::Index>(num_points);
 
   const Eigen::VectorXd& start_vel = trajectory.getVelocity(0);
-  const Eigen::VectorXd& last_vel = trajectory.getVelocity(static_cast<Eigen::Index>(num_points - 1));
+  const Eigen::VectorXd& last_vel = trajectory.getVelocity(n - 1);
   const Eigen::VectorXd& start_acc = trajectory.getAcceleration(0);
-  const Eigen::VectorXd& last_acc = trajectory.getAcceleration(static_cast<Eigen::Index>(num_points - 1));
-
-  for (std::size_t j = 0; j < static_cast<std::size_t>(trajectory.dof()); j++)
+  const Eigen::VectorXd& last_acc = trajectory.getAcceleration(n - 1);
+
+  RowMatrixXd positions(n, dof);
+  for (Eigen::Index i = 0; i < n; i++)
+    positions.row(i) = trajectory.getPosition(i).transpose();
+
+  // Initialize velocities, copying initial/final velocities if specified
+  RowMatrixXd velocities = RowMatrixXd::Zero(n, dof);
+  if (start_vel.size() > 0)
+    velocities.row(0) = start_vel.transpose();
+  if (last_vel.size() > 0)
+    velocities.row(n - 1) = last_vel.transpose();
+
+  // Initialize accelerations, copying initial/final accelerations if specified
+  Eigen::RowVectorXd initial_acceleration = Eigen::RowVectorXd::Zero(dof);
+  Eigen::RowVectorXd final_acceleration = Eigen::RowVectorXd::Zero(dof);
+  if (start_acc.size() > 0)
+    initial_acceleration = start_acc.transpose();
+  if (last_acc.size() > 0)
+    final_acceleration = last_acc.transpose();
+
+  RowMatrixXd accelerations = RowMatrixXd::Zero(n, dof);
+  accelerations.row(0) = initial_acceleration;
+  accelerations.row(n - 1) = final_acceleration;
+
+  // Set bounds based on inputs
+  RowMatrixXd max_velocity_bounds = velocity_scaling_factor * max_velocity.transpose();
+  RowMatrixXd min_velocity_bounds = -max_velocity_bounds;
+  RowMatrixXd max_acceleration_bounds = acceleration_scaling_factor * max_acceleration.transpose();
+  RowMatrixXd min_acceleration_bounds = -max_acceleration_bounds;
+
+  for (Eigen::Index j = 0; j < dof; j++)
   {
-    // Copy positions
-    t2[j].positions_.resize(num_points, 0.0);
-    for (std::size_t i = 0; i < num_points; i++)
-      t2[j].positions_[i] = trajectory.getPosition(static_cast<Eigen::Index>(i))[static_cast<Eigen::Index>(j)];
-
-    // Initialize velocities
-    t2[j].velocities_.resize(num_points, 0.0);
-
-    // Copy initial/final velocities if specified
-    if (start_vel.size() > 0)
-      t2[j].velocities_[0] = start_vel[static_cast<Eigen::Index>(j)];
-    if (last_vel.size() > 0)
-      t2[j].velocities_[num_points - 1] = last_vel[static_cast<Eigen::Index>(j)];
-
-    // Initialize accelerations
-    t2[j].accelerations_.resize(num_points, 0.0);
-    t2[j].initial_acceleration_ = 0.0;
-    t2[j].final_acceleration_ = 0.0;
-
-    // Copy initial/final accelerations if specified
-    if (start_acc.size() > 0)
-      t2[j].initial_acceleration_ = start_acc[static_cast<Eigen::Index>(j)];
-    t2[j].accelerations_[0] = t2[j].initial_acceleration_;
-    if (last_acc.size() > 0)
-      t2[j].final_acceleration_ = last_acc[static_cast<Eigen::Index>(j)];
-    t2[j].accelerations_[num_points - 1] = t2[j].final_acceleration_;
-
-    // Set bounds based on inputs
-    t2[j].max_velocity_.resize(num_points);
-    t2[j].min_velocity_.resize(num_points);
-    t2[j].max_acceleration_.resize(num_points);
-    t2[j].min_acceleration_.resize(num_points);
-    Eigen::Map<Eigen::VectorXd> max_velocity_eigen(t2[j].max_velocity_.data(), static_cast<Eigen::Index>(num_points));
-    Eigen::Map<Eigen::VectorXd> min_velocity_eigen(t2[j].min_velocity_.data(), static_cast<Eigen::Index>(num_points));
-    Eigen::Map<Eigen::VectorXd> max_acceleration_eigen(t2[j].max_acceleration_.data(),
-                                                       static_cast<Eigen::Index>(num_points));
-    Eigen::Map<Eigen::VectorXd> min_acceleration_eigen(t2[j].min_acceleration_.data(),
-                                                       static_cast<Eigen::Index>(num_points));
-
-    max_velocity_eigen =
-        Eigen::VectorXd::Ones(static_cast<Eigen::Index>(num_points)) * max_velocity[static_cast<Eigen::Index>(j)];
-    min_velocity_eigen =
-        Eigen::VectorXd::Ones(static_cast<Eigen::Index>(num_points)) * -max_velocity[static_cast<Eigen::Index>(j)];
-    max_velocity_eigen.array() *= velocity_scaling_factor.array();
-    min_velocity_eigen.array() *= velocity_scaling_factor.array();
-
-    max_acceleration_eigen =
-        Eigen::VectorXd::Ones(static_cast<Eigen::Index>(num_points)) * max_acceleration[static_cast<Eigen::Index>(j)];
-    min_acceleration_eigen =
-        Eigen::VectorXd::Ones(static_cast<Eigen::Index>(num_points)) * -max_acceleration[static_cast<Eigen::Index>(j)];
-    max_acceleration_eigen.array() *= acceleration_scaling_factor.array();
-    min_acceleration_eigen.array() *= acceleration_scaling_factor.array();
-
     // Error out if bounds don't make sense
-    if ((max_velocity_eigen.array() <= 0.0).any() || (max_acceleration_eigen.array() <= 0.0).any())
+    if ((max_velocity_bounds.col(j).array() <= 0.0).any() || (max_acceleration_bounds.col(j).array() <= 0.0).any())
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Joint %d max velocity %f and max acceleration %f "
                               "must be greater than zero or a solution won't be found.",
-                              j,
-                              t2[j].max_velocity_[0],
-                              t2[j].max_acceleration_[0]);
+                              static_cast<int>(j),
+                              max_velocity_bounds(0, j),
+                              max_acceleration_bounds(0, j));
       return false;
     }
-    if ((min_velocity_eigen.array() >= 0.0).any() || (min_acceleration_eigen.array() >= 0.0).any())
+    if ((min_velocity_bounds.col(j).array() >= 0.0).any() || (min_acceleration_bounds.col(j).array() >= 0.0).any())
     {
       CONSOLE_BRIDGE_logError("trajectory_processing.iterative_spline_parameterization: Joint %d min velocity %f and "
                               "min acceleration %f must be less than zero or a solution won't be found.",
-                              j,
-                              t2[j].min_velocity_[0],
-                              t2[j].min_acceleration_[0]);
+                              static_cast<int>(j),
+                              min_velocity_bounds(0, j),
+                              min_acceleration_bounds(0, j));
       return false;
     }
   }
@@ -308,93 +300,59 @@ bool IterativeSplineParameterization::compute(
   {
     // Insert 2nd and 2nd-last points
     // (required to force acceleration to specified values at endpoints)
-    for (unsigned int j = 0; j < trajectory.dof(); j++)
-    {
-      double value = 0.9 * t2[j].positions_[0] + 0.1 * t2[j].positions_[1];
-      t2[j].positions_.insert(t2[j].positions_.begin() + 1, value);
-
-      value = t2[j].velocities_.front();
-      t2[j].velocities_.insert(t2[j].velocities_.begin() + 1, value);
-
-      value = t2[j].accelerations_.front();
-      t2[j].accelerations_.insert(t2[j].accelerations_.begin() + 1, value);
-
-      value = t2[j].max_velocity_.front();
-      t2[j].max_velocity_.insert(t2[j].max_velocity_.begin() + 1, value);
-
-      value = t2[j].min_velocity_.front();
-      t2[j].min_velocity_.insert(t2[j].min_velocity_.begin() + 1, value);
-
-      value = t2[j].max_acceleration_.front();
-      t2[j].max_acceleration_.insert(t2[j].max_acceleration_.begin() + 1, value);
-
-      value = t2[j].min_acceleration_.front();
-      t2[j].min_acceleration_.insert(t2[j].min_acceleration_.begin() + 1, value);
-    }
-    num_points++;
-
-    for (unsigned int j = 0; j < trajectory.dof(); j++)
-    {
-      double value = 0.1 * t2[j].positions_[num_points - 2] + 0.9 * t2[j].positions_[num_points - 1];
-      t2[j].positions_.insert(t2[j].positions_.end() - 1, value);
-
-      value = t2[j].velocities_.back();
-      t2[j].velocities_.insert(t2[j].velocities_.end() - 1, value);
-
-      value = t2[j].accelerations_.back();
-      t2[j].accelerations_.insert(t2[j].accelerations_.end() - 1, value);
-
-      value = t2[j].max_velocity_.back();
-      t2[j].max_velocity_.insert(t2[j].max_velocity_.end() - 1, value);
-
-      value = t2[j].min_velocity_.back();
-      t2[j].min_velocity_.insert(t2[j].min_velocity_.end() - 1, value);
-
-      value = t2[j].max_acceleration_.back();
-      t2[j].max_acceleration_.insert(t2[j].max_acceleration_.end() - 1, value);
-
-      value = t2[j].min_acceleration_.back();
-      t2[j].min_acceleration_.insert(t2[j].min_acceleration_.end() - 1, value);
-    }
-    num_points++;
+    Eigen::RowVectorXd second = 0.9 * positions.row(0) + 0.1 * positions.row(1);
+    Eigen::RowVectorXd second_last = 0.1 * ((n == 2) ? second : Eigen::RowVectorXd(positions.row(n - 2))) +
+                                     0.9 * positions.row(n - 1);
+
+    positions = insert_two_rows(positions);
+    positions.row(1) = second;
+    positions.row(n) = second_last;
+
+    velocities = insert_two_rows(velocities);
+    accelerations = insert_two_rows(accelerations);
+    max_velocity_bounds = insert_two_rows(max_velocity_bounds);
+    min_velocity_bounds = insert_two_rows(min_velocity_bounds);
+    max_acceleration_bounds = insert_two_rows(max_acceleration_bounds);
+    min_acceleration_bounds = insert_two_rows(min_acceleration_bounds);
+    num_points += 2;
+    n += 2;
   }
 
   // Error check
   if (num_points < 4)
   {
     CONSOLE_BRIDGE_logError("iterative_spline_parameterization: number of waypoints %d, needs to be greater than 3.",
-                            num_points);
+                            static_cast<int>(num_points));
     return false;
   }
-  for (std::size_t j = 0; j < static_cast<std::size_t>(trajectory.dof()); j++)
+  for (Eigen::Index j = 0; j < dof; j++)
   {
-    if (t2[j].velocities_[0] > t2[j].max_velocity_[0] || t2[j].velocities_[0] < t2[j].min_velocity_[0])
+    if (velocities(0, j) > max_velocity_bounds(0, j) || velocities(0, j) < min_velocity_bounds(0, j))
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Initial velocity %f out of bounds.",
-                              t2[j].velocities_[0]);
+                              velocities(0, j));
       return false;
     }
 
-    if (t2[j].velocities_[num_points - 1] > t2[j].max_velocity_[num_points - 1] ||
-        t2[j].velocities_[num_points - 1] < t2[j].min_velocity_[num_points - 1])
+    if (velocities(n - 1, j) > max_velocity_bounds(n - 1, j) || velocities(n - 1, j) < min_velocity_bounds(n - 1, j))
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Final velocity %f out of bounds.",
-                              t2[j].velocities_[num_points - 1]);
+                              velocities(n - 1, j));
       return false;
     }
 
-    if (t2[j].accelerations_[0] > t2[j].max_acceleration_[0] || t2[j].accelerations_[0] < t2[j].min_acceleration_[0])
+    if (accelerations(0, j) > max_acceleration_bounds(0, j) || accelerations(0, j) < min_acceleration_bounds(0, j))
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Initial acceleration %f out of bounds\n",
-                              t2[j].accelerations_[0]);
+                              accelerations(0, j));
       return false;
     }
 
-    if (t2[j].accelerations_[num_points - 1] > t2[j].max_acceleration_[num_points - 1] ||
-        t2[j].accelerations_[num_points - 1] < t2[j].min_acceleration_[num_points - 1])
+    if (accelerations(n - 1, j) > max_acceleration_bounds(n - 1, j) ||
+        accelerations(n - 1, j) < min_acceleration_bounds(n - 1, j))
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Final acceleration %f out of bounds\n",
-                              t2[j].accelerations_[num_points - 1]);
+                              accelerations(n - 1, j));
       return false;
     }
   }
@@ -402,94 +360,102 @@ bool IterativeSplineParameterization::compute(
   // Initialize times
   // start with valid velocities, then expand intervals
   // epsilon to prevent divide-by-zero
-  std::vector<double> time_diff(static_cast<std::size_t>(num_points - 1), std::numeric_limits<double>::epsilon());
-  for (unsigned int j = 0; j < trajectory.dof(); j++)
-    init_times(static_cast<long>(num_points),
-               time_diff.data(),
-               t2[j].positions_.data(),
-               t2[j].max_velocity_.data(),
-               t2[j].min_velocity_.data());
+  Eigen::VectorXd time_diff = Eigen::VectorXd::Constant(n - 1, std::numeric_limits<double>::epsilon());
+  init_times(time_diff, positions, max_velocity_bounds, min_velocity_bounds);
+
+  // The fraction of the required stretch applied to each interval per iteration
+  Eigen::VectorXd stretch_gain = Eigen::VectorXd::Constant(n - 1, MIN_STRETCH_GAIN);
+  Eigen::VectorXd time_factor(n - 1);
+  Eigen::VectorXd point_factor(n);
+  Eigen::VectorXd spline_coeffs(n);
 
   // Stretch intervals until close to the bounds
-  while (true)
+  long iterations = 0;
+  bool converged = false;
+  while (max_iterations_ <= 0 || iterations < max_iterations_)
   {
-    int loop = 0;
+    ++iterations;
+
+    // Move points to satisfy initial/final acceleration
+    if (add_points)
+      adjust_two_positions(
+          time_diff, positions, velocities, accelerations, initial_acceleration, final_acceleration, spline_coeffs);
+
+    fit_cubic_splines(time_diff, positions, velocities, accelerations, spline_coeffs);
 
     // Calculate the interval stretches due to acceleration
-    std::vector<double> time_factor(static_cast<std::size_t>(num_points - 1), 1.00);
-    for (unsigned int j = 0; j < trajectory.dof(); j++)
+    for (Eigen::Index i = 0; i < n; i++)
     {
-      // Move points to satisfy initial/final acceleration
-      if (add_points)
-      {
-        adjust_two_positions(static_cast<int>(num_points),
-                             time_diff.data(),
-                             t2[j].positions_.data(),
-                             t2[j].velocities_.data(),
-                             t2[j].accelerations_.data(),
-                             t2[j].initial_acceleration_,
-                             t2[j].final_acceleration_);
-      }
-
-      fit_cubic_spline(static_cast<int>(num_points),
-                       time_diff.data(),
-                       t2[j].positions_.data(),
-                       t2[j].velocities_.data(),
-                       t2[j].accelerations_.data());
-      for (unsigned i = 0; i < num_points; i++)
-      {
-        const double acc = t2[j].accelerations_[i];
-        double atfactor = 1.0;
-        if (acc > t2[j].max_acceleration_[i])
-          atfactor = sqrt(acc / t2[j].max_acceleration_[i]);
-        if (acc < t2[j].min_acceleration_[i])
-          atfactor = sqrt(acc / t2[j].min_acceleration_[i]);
-        if (atfactor > 1.01)  // within 1%
-          loop = 1;
-        atfactor = (atfactor - 1.0) / 16.0 + 1.0;  // 1/16th
-        if (i > 0)
-          time_factor[i - 1] = std::max(time_factor[i - 1], atfactor);
-        if (i < num_points - 1)
-          time_factor[i] = std::max(time_factor[i], atfactor);
-      }
+      const auto acc = accelerations.row(i).array();
+      point_factor[i] =
+          std::max((acc > max_acceleration_bounds.row(i).array())
+                       .select((acc / max_acceleration_bounds.row(i).array()).sqrt(), 1.0)
+                       .maxCoeff(),
+                   (acc < min_acceleration_bounds.row(i).array())
+                       .select((acc / min_acceleration_bounds.row(i).array()).sqrt(), 1.0)
+                       .maxCoeff());
     }
 
-    if (loop == 0)
+    if ((point_factor.array() <= 1.01).all())  // within 1%
+    {
+      converged = true;
       break;  // finished
+    }
 
     // Stretch
-    for (unsigned i = 0; i < num_points - 1; i++)
-      time_diff[i] *= time_factor[i];
+    for (Eigen::Index i = 0; i < n - 1; i++)
+    {
+      const double factor = std::max(point_factor[i], point_factor[i + 1]);
+      time_factor[i] = (factor - 1.0) * stretch_gain[i] + 1.0;
+
+      // Intervals which keep violating the bounds are stretched more aggressively
+      if (adaptive_stretch_)
+        stretch_gain[i] = (factor > 1.01) ? std::min(stretch_gain[i] * STRETCH_GAIN_GROWTH, MAX_STRETCH_GAIN) :
+                                            MIN_STRETCH_GAIN;
+    }
+    time_diff.array() *= time_factor.array();
   }
 
+  if (!converged)
+    CONSOLE_BRIDGE_logDebug("iterative_spline_parameterization: Reached the max number of iterations %ld, the global "
+                            "adjustment will enforce the bounds.",
+                            max_iterations_);
+
   // Final adjustment forces the trajectory within bounds
-  globalAdjustment(t2, trajectory.dof(), static_cast<long>(num_points), time_diff);
+  const double global_factor = global_adjustment_factor(velocities,
+                                                        accelerations,
+                                                        max_velocity_bounds,
+                                                        min_velocity_bounds,
+                                                        max_acceleration_bounds,
+                                                        min_acceleration_bounds);
+  time_diff *= global_factor;
+  fit_cubic_splines(time_diff, positions, velocities, accelerations, spline_coeffs);
+
+  if (result != nullptr)
+  {
+    result->iterations = iterations;
+    result->converged = converged;
+    result->max_stretch_gain = stretch_gain.maxCoeff();
+    result->global_adjustment_factor = global_factor;
+  }
 
   // Convert back to JointTrajectory form
   double time = 0;
   Eigen::Index idx = 0;
-  for (unsigned int i = 0; i < num_points; i++)
+  for (Eigen::Index i = 0; i < n; i++)
   {
-    Eigen::VectorXd uv(trajectory.dof());
-    Eigen::VectorXd ua(trajectory.dof());
-    for (unsigned int j = 0; j < trajectory.dof(); j++)
-    {
-      uv[j] = t2[j].velocities_[i];
-      ua[j] = t2[j].accelerations_[i];
-    }
-
     // Calculate time from start
     if (i > 0)
       time = time + time_diff[i - 1];
 
     // Do not process added points
-    if (add_points && (i == 1 || i == num_points - 2))
+    if (add_points && (i == 1 || i == n - 2))
     {
       time = time + time_diff[i - 1];
       continue;
     }
 
-    trajectory.setData(idx++, uv, ua, time);
+    trajectory.setData(idx++, velocities.row(i).transpose(), accelerations.row(i).transpose(), time);
   }
 
   assert(trajectory.isTimeStrictlyIncreasing());
@@ -521,50 +487,54 @@ bool IterativeSplineParameterization::compute(
   using the tridiagonal algorithm.
   There is a forward propogation pass followed by a backsubstitution pass.
 
-  n is the number of points
+  The coefficients c of the forward sweep only depend on the time intervals,
+  so they are computed once and the splines of all joints are solved together
+  with each row holding the values of every joint at a point.
+
+  n is the number of points (rows), each column is a joint
   dt contains the time difference between each point (size=n-1)
   x  contains the positions                          (size=n)
   x1 contains the 1st derivative (velocities)        (size=n)
      x1[0] and x1[n-1] MUST be specified.
   x2 contains the 2nd derivative (accelerations)     (size=n)
+  c  is scratch storage for the forward sweep        (size=n)
   x1 and x2 are filled in by the algorithm.
 */
-// NOLINTNEXTLINE
-static void fit_cubic_spline(const long n, const double dt[], const double x[], double x1[], double x2[])
+static void fit_cubic_splines(const Eigen::VectorXd& dt,
+                              const RowMatrixXd& x,
+                              RowMatrixXd& x1,
+                              RowMatrixXd& x2,
+                              Eigen::VectorXd& c)
 {
-  long i{ 0 };
-  const double x1_i = x1[0], x1_f = x1[n - 1];
+  const Eigen::Index n = x.rows();
 
   // Tridiagonal alg - forward sweep
-  // x1 and x2 used to store the temporary coefficients c and d
+  // x2 used to store the temporary coefficients d
   // (will get overwritten during backsubstitution)
-  double *c = x1, *d = x2;
   c[0] = 0.5;
-  d[0] = 3.0 * ((x[1] - x[0]) / dt[0] - x1_i) / dt[0];
-  for (i = 1; i <= n - 2; i++)
+  x2.row(0) = 3.0 * ((x.row(1) - x.row(0)) / dt[0] - x1.row(0)) / dt[0];
+  for (Eigen::Index i = 1; i <= n - 2; i++)
   {
     const double dt2 = dt[i - 1] + dt[i];
     const double a = dt[i - 1] / dt2;
     const double denom = 2.0 - a * c[i - 1];
     c[i] = (1.0 - a) / denom;
-    d[i] = 6.0 * ((x[i + 1] - x[i]) / dt[i] - (x[i] - x[i - 1]) / dt[i - 1]) / dt2;
-    d[i] = (d[i] - a * d[i - 1]) / denom;
+    x2.row(i) = (6.0 * ((x.row(i + 1) - x.row(i)) / dt[i] - (x.row(i) - x.row(i - 1)) / dt[i - 1]) / dt2 -
+                 a * x2.row(i - 1)) /
+                denom;
   }
   const double denom = dt[n - 2] * (2.0 - c[n - 2]);
-  d[n - 1] = 6.0 * (x1_f - (x[n - 1] - x[n - 2]) / dt[n - 2]);
-  d[n - 1] = (d[n - 1] - dt[n - 2] * d[n - 2]) / denom;
+  x2.row(n - 1) =
+      (6.0 * (x1.row(n - 1) - (x.row(n - 1) - x.row(n - 2)) / dt[n - 2]) - dt[n - 2] * x2.row(n - 2)) / denom;
 
   // Tridiagonal alg - backsubstitution sweep
   // 2nd derivative
-  x2[n - 1] = d[n - 1];
-  for (i = n - 2; i >= 0; i--)
-    x2[i] = d[i] - c[i] * x2[i + 1];
-
-  // 1st derivative
-  x1[0] = x1_i;
-  for (i = 1; i < n - 1; i++)
-    x1[i] = (x[i + 1] - x[i]) / dt[i] - (2 * x2[i] + x2[i + 1]) * dt[i] / 6.0;
-  x1[n - 1] = x1_f;
+  for (Eigen::Index i = n - 2; i >= 0; i--)
+    x2.row(i) -= c[i] * x2.row(i + 1);
+
+  // 1st derivative, the endpoints are left unchanged
+  for (Eigen::Index i = 1; i < n - 1; i++)
+    x1.row(i) = (x.row(i + 1) - x.row(i)) / dt[i] - (2 * x2.row(i) + x2.row(i + 1)) * dt[i] / 6.0;
 }
 
 /*
@@ -576,51 +546,56 @@ static void fit_cubic_spline(const long n, const double dt[], const double x[],
   x2_i and x2_f are the (initial and final) 2nd derivative at 0 and N-1
 */
 
-static void adjust_two_positions(const long n,
-                                 const double dt[],  // NOLINT
-                                 double x[],         // NOLINT
-                                 double x1[],        // NOLINT
-                                 double x2[],        // NOLINT
-                                 const double x2_i,
-                                 const double x2_f)
+static void adjust_two_positions(const Eigen::VectorXd& dt,
+                                 RowMatrixXd& x,
+                                 RowMatrixXd& x1,
+                                 RowMatrixXd& x2,
+                                 const Eigen::RowVectorXd& x2_i,
+                                 const Eigen::RowVectorXd& x2_f,
+                                 Eigen::VectorXd& c)
 {
-  x[1] = x[0];
-  x[n - 2] = x[n - 3];
-  fit_cubic_spline(n, dt, x, x1, x2);
-  double a0 = x2[0];
-  double b0 = x2[n - 1];
-
-  x[1] = x[2];
-  x[n - 2] = x[n - 1];
-  fit_cubic_spline(n, dt, x, x1, x2);
-  double a2 = x2[0];
-  double b2 = x2[n - 1];
+  const Eigen::Index n = x.rows();
+
+  x.row(1) = x.row(0);
+  x.row(n - 2) = x.row(n - 3);
+  fit_cubic_splines(dt, x, x1, x2, c);
+  Eigen::RowVectorXd a0 = x2.row(0);
+  Eigen::RowVectorXd b0 = x2.row(n - 1);
+
+  x.row(1) = x.row(2);
+  x.row(n - 2) = x.row(n - 1);
+  fit_cubic_splines(dt, x, x1, x2, c);
+  const Eigen::RowVectorXd& a2 = x2.row(0);
+  const Eigen::RowVectorXd& b2 = x2.row(n - 1);
 
   // we can solve this with linear equation (use two-point form)
-  // if (a2 != a0)
-  if (!tesseract_common::almostEqualRelativeAndAbs(a2, a0, 1e-5))
-    x[1] = x[0] + ((x[2] - x[0]) / (a2 - a0)) * (x2_i - a0);
+  for (Eigen::Index j = 0; j < x.cols(); j++)
+  {
+    // if (a2 != a0)
+    if (!tesseract_common::almostEqualRelativeAndAbs(a2[j], a0[j], 1e-5))
+      x(1, j) = x(0, j) + ((x(2, j) - x(0, j)) / (a2[j] - a0[j])) * (x2_i[j] - a0[j]);
 
-  // if (b2 != b0)
-  if (!tesseract_common::almostEqualRelativeAndAbs(b2, b0, 1e-5))
-    x[n - 2] = x[n - 3] + ((x[n - 1] - x[n - 3]) / (b2 - b0)) * (x2_f - b0);
+    // if (b2 != b0)
+    if (!tesseract_common::almostEqualRelativeAndAbs(b2[j], b0[j], 1e-5))
+      x(n - 2, j) = x(n - 3, j) + ((x(n - 1, j) - x(n - 3, j)) / (b2[j] - b0[j])) * (x2_f[j] - b0[j]);
+  }
 }
 
 /*
   Find time required to go max velocity on each segment.
   Increase a segment's time interval if the current time isn't long enough.
 */
-// NOLINTNEXTLINE
-static void init_times(long n, double dt[], const double x[], const double max_velocity[], double min_velocity[])
+static void init_times(Eigen::VectorXd& dt,
+                       const RowMatrixXd& x,
+                       const RowMatrixXd& max_velocity,
+                       const RowMatrixXd& min_velocity)
 {
-  for (long i = 0; i < n - 1; i++)
+  for (Eigen::Index i = 0; i < x.rows() - 1; i++)
   {
-    double time{ NAN };
-    double dx = x[i + 1] - x[i];
-    if (dx >= 0.0)
-      time = (dx / max_velocity[i]);
-    else
-      time = (dx / min_velocity[i]);
+    const Eigen::ArrayXd dx = (x.row(i + 1) - x.row(i)).transpose();
+    const Eigen::ArrayXd max_v = max_velocity.row(i).transpose();
+    const Eigen::ArrayXd min_v = min_velocity.row(i).transpose();
+    double time = (dx >= 0.0).select(dx / max_v, dx / min_v).maxCoeff();
     time += std::numeric_limits<double>::epsilon();  // prevent divide-by-zero
 
     if (dt[i] < time)
@@ -695,78 +670,23 @@ static void init_times(long n, double dt[], const double x[], const double max_v
 // return global expansion multiplicative factor required
 // to force within bounds.
 // Assumes that the spline is already fit
-// (fit_cubic_spline must have been called before this).
-static double global_adjustment_factor(long n,
-                                       double /*dt*/[],                  // NOLINT
-                                       const double /*x*/[],             // NOLINT
-                                       double x1[],                      // NOLINT
-                                       double x2[],                      // NOLINT
-                                       const double max_velocity[],      // NOLINT
-                                       const double min_velocity[],      // NOLINT
-                                       const double max_acceleration[],  // NOLINT
-                                       const double min_acceleration[])  // NOLINT
+// (fit_cubic_splines must have been called before this).
+static double global_adjustment_factor(const RowMatrixXd& x1,
+                                       const RowMatrixXd& x2,
+                                       const RowMatrixXd& max_velocity,
+                                       const RowMatrixXd& min_velocity,
+                                       const RowMatrixXd& max_acceleration,
+                                       const RowMatrixXd& min_acceleration)
 {
   double tfactor2 = 1.00;
-
-  // fit_cubic_spline(n, dt, x, x1, x2);
-
-  for (long i = 0; i < n; i++)
-  {
-    double tfactor{ NAN };
-    tfactor = x1[i] / max_velocity[i];
-    if (tfactor2 < tfactor)
-      tfactor2 = tfactor;
-    tfactor = x1[i] / min_velocity[i];
-    if (tfactor2 < tfactor)
-      tfactor2 = tfactor;
-
-    if (x2[i] >= 0)
-    {
-      tfactor = sqrt(fabs(x2[i] / max_acceleration[i]));
-      if (tfactor2 < tfactor)
-        tfactor2 = tfactor;
-    }
-    else
-    {
-      tfactor = sqrt(fabs(x2[i] / min_acceleration[i]));
-      if (tfactor2 < tfactor)
-        tfactor2 = tfactor;
-    }
-  }
-
+  tfactor2 = std::max(tfactor2, (x1.array() / max_velocity.array()).maxCoeff());
+  tfactor2 = std::max(tfactor2, (x1.array() / min_velocity.array()).maxCoeff());
+  tfactor2 = std::max(tfactor2,
+                      (x2.array() >= 0)
+                          .select((x2.array() / max_acceleration.array()).abs().sqrt(),
+                                  (x2.array() / min_acceleration.array()).abs().sqrt())
+                          .maxCoeff());
   return tfactor2;
 }
 
-// Expands the entire trajectory to fit exactly within bounds
-void globalAdjustment(std::vector<SingleJointTrajectory>& t2,
-                      long num_joints,
-                      long num_points,
-                      std::vector<double>& time_diff)
-{
-  double gtfactor = 1.0;
-  for (std::size_t j = 0; j < static_cast<std::size_t>(num_joints); j++)
-  {
-    double tfactor = global_adjustment_factor(num_points,
-                                              time_diff.data(),
-                                              t2[j].positions_.data(),
-                                              t2[j].velocities_.data(),
-                                              t2[j].accelerations_.data(),
-                                              t2[j].max_velocity_.data(),
-                                              t2[j].min_velocity_.data(),
-                                              t2[j].max_acceleration_.data(),
-                                              t2[j].min_acceleration_.data());
-    if (tfactor > gtfactor)
-      gtfactor = tfactor;
-  }
-
-  // printf("# Global adjustment: %0.4f%%\n", 100.0 * (gtfactor - 1.0));
-  for (std::size_t i = 0; i < static_cast<std::size_t>(num_points - 1); i++)
-    time_diff[i] *= gtfactor;
-
-  for (std::size_t j = 0; j < static_cast<std::size_t>(num_joints); j++)
-  {
-    fit_cubic_spline(
-        num_points, time_diff.data(), t2[j].positions_.data(), t2[j].velocities_.data(), t2[j].accelerations_.data());
-  }
-}
 }  // namespace tesseract_planning
@@ -34,6 +34,21 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
+/** @brief How the trajectory is extended when Ruckig is not able to reach a waypoint within its segment duration */
+enum class RuckigSmoothingMode
+{
+  /**
+   * @brief Stretch the duration of the entire trajectory and restart from the first waypoint. Every segment is
+   * checked using the average segment duration.
+   */
+  GLOBAL = 0,
+  /**
+   * @brief Stretch only the failing segments and re-check the segments sharing a modified waypoint. Every segment
+   * is checked against its own duration, independent of the other segments, so segments are evaluated in parallel.
+   */
+  LOCAL = 1
+};
+
 class RuckigTrajectorySmoothing
 {
 public:
@@ -50,6 +65,16 @@ public:
   /** @brief Set the max duration extension factor */
   void setMaxDurationExtensionFactor(double max_duration_extension_factor);
 
+  /** @brief Set how the trajectory is extended when Ruckig fails to reach a waypoint */
+  void setSmoothingMode(RuckigSmoothingMode mode);
+
+  /**
+   * @brief Set the number of threads used to evaluate the segments when using RuckigSmoothingMode::LOCAL
+   * @details The threads are created once per compute and reused by every round of checks. Rounds with too few
+   * segments to split between the threads are checked on the calling thread.
+   */
+  void setNumThreads(std::size_t num_threads);
+
   /**
    * @brief Compute the time stamps for a flattened vector of move instruction
    * @param trajectory Flattended vector of move instruction
@@ -121,6 +146,8 @@ public:
 protected:
   double duration_extension_fraction_;
   double max_duration_extension_factor_;
+  RuckigSmoothingMode mode_{ RuckigSmoothingMode::GLOBAL };
+  std::size_t num_threads_{ 1 };
 };
 }  // namespace tesseract_planning
 
@@ -36,12 +36,18 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_time_parameterization/ruckig/ruckig_trajectory_smoothing.h>
 #include <tesseract_common/kinematic_limits.h>
 
 #include <memory>
+#include <numeric>
 
 #include <ruckig/input_parameter.hpp>
 #include <ruckig/ruckig.hpp>
@@ -66,6 +72,13 @@ void RuckigTrajectorySmoothing::setMaxDurationExtensionFactor(double max_duratio
   max_duration_extension_factor_ = max_duration_extension_factor;
 }
 
+void RuckigTrajectorySmoothing::setSmoothingMode(RuckigSmoothingMode mode) { mode_ = mode; }
+
+void RuckigTrajectorySmoothing::setNumThreads(std::size_t num_threads)
+{
+  num_threads_ = std::max<std::size_t>(num_threads, 1);
+}
+
 bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
                                         const double& max_velocity,
                                         const double& max_acceleration,
@@ -261,6 +274,299 @@ void initializeRuckigState(ruckig::InputParameter<ruckig::DynamicDOFs>& ruckig_i
   ruckig_output.new_acceleration = ruckig_input.current_acceleration;
 }
 
+/** @brief Clamp the values to the symmetric limits due to small numerical errors */
+Eigen::VectorXd clampToLimits(const Eigen::VectorXd& values, const Eigen::Ref<const Eigen::VectorXd>& limits)
+{
+  if (values.rows() == 0)
+    return Eigen::VectorXd::Zero(limits.rows());
+
+  return values.array().min(limits.array()).max((-1.0 * limits).array());
+}
+
+/** @brief The waypoint data used to smooth a trajectory locally */
+struct LocalSmoothingData
+{
+  std::vector<Eigen::VectorXd> positions;
+  std::vector<Eigen::VectorXd> velocities;
+  std::vector<Eigen::VectorXd> accelerations;
+
+  /** @brief The original duration of each segment, the segment at index i ends at waypoint i + 1 */
+  Eigen::VectorXd durations;
+
+  /** @brief The current extension factor of each segment */
+  Eigen::VectorXd extension_factors;
+};
+
+/**
+ * @brief The threads used to check the segments, they are created once and reused by every round of checks
+ * @details The calling thread takes part in running the jobs so only num_threads - 1 workers are created, and only
+ * when a round of checks is large enough to be split.
+ */
+class SegmentCheckPool
+{
+public:
+  explicit SegmentCheckPool(std::size_t num_threads) : num_threads_(num_threads) {}
+  ~SegmentCheckPool()
+  {
+    {
+      std::scoped_lock lock(mutex_);
+      stop_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& worker : workers_)
+      worker.join();
+  }
+  SegmentCheckPool(const SegmentCheckPool&) = delete;
+  SegmentCheckPool& operator=(const SegmentCheckPool&) = delete;
+  SegmentCheckPool(SegmentCheckPool&&) = delete;
+  SegmentCheckPool& operator=(SegmentCheckPool&&) = delete;
+
+  /** @brief The number of threads, including the calling thread */
+  std::size_t getNumThreads() const { return num_threads_; }
+
+  /**
+   * @brief Run the jobs on the workers and the calling thread
+   * @param num_jobs The number of jobs
+   * @param job The job, called once with each index in [0, num_jobs)
+   */
+  void run(std::size_t num_jobs, const std::function<void(std::size_t)>& job)
+  {
+    if (workers_.empty())
+    {
+      workers_.reserve(num_threads_ - 1);
+      for (std::size_t i = 1; i < num_threads_; ++i)
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+
+    {
+      std::scoped_lock lock(mutex_);
+      job_ = &job;
+      num_jobs_ = num_jobs;
+      next_job_ = 0;
+      remaining_jobs_ = num_jobs;
+      ++round_;
+    }
+    start_cv_.notify_all();
+
+    runJobs();
+
+    std::unique_lock lock(mutex_);
+    done_cv_.wait(lock, [this] { return remaining_jobs_ == 0; });
+    job_ = nullptr;
+  }
+
+private:
+  std::size_t num_threads_;
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable start_cv_;
+  std::condition_variable done_cv_;
+  const std::function<void(std::size_t)>* job_{ nullptr };
+  std::size_t num_jobs_{ 0 };
+  std::size_t next_job_{ 0 };
+  std::size_t remaining_jobs_{ 0 };
+  std::size_t round_{ 0 };
+  bool stop_{ false };
+
+  /** @brief Run jobs of the current round until none are left */
+  void runJobs()
+  {
+    std::unique_lock lock(mutex_);
+    while (next_job_ < num_jobs_)
+    {
+      const std::function<void(std::size_t)>& job = *job_;
+      const std::size_t index = next_job_++;
+      lock.unlock();
+      job(index);
+      lock.lock();
+      if (--remaining_jobs_ == 0)
+        done_cv_.notify_one();
+    }
+  }
+
+  void workerLoop()
+  {
+    std::size_t round{ 0 };
+    while (true)
+    {
+      {
+        std::unique_lock lock(mutex_);
+        start_cv_.wait(lock, [this, round] { return stop_ || round_ != round; });
+        if (stop_)
+          return;
+
+        round = round_;
+      }
+      runJobs();
+    }
+  }
+};
+
+/** @brief The minimum number of segments checked by each thread, smaller rounds of checks run on fewer threads */
+constexpr std::size_t MIN_SEGMENTS_PER_THREAD{ 16 };
+
+/**
+ * @brief Check if Ruckig is able to move between the waypoints of each segment within the segment duration
+ * @details The checks only read the shared data so the segments are split between the threads of the pool
+ */
+void checkSegments(const LocalSmoothingData& data,
+                   const ruckig::InputParameter<ruckig::DynamicDOFs>& ruckig_limits,
+                   const std::vector<Eigen::Index>& segments,
+                   std::vector<ruckig::Result>& results,
+                   SegmentCheckPool& pool)
+{
+  const std::size_t dof = ruckig_limits.degrees_of_freedom;
+  auto check = [&](std::size_t begin, std::size_t end) {
+    ruckig::Ruckig<ruckig::DynamicDOFs> otg{ dof };
+    ruckig::Trajectory<ruckig::DynamicDOFs> ruckig_trajectory{ dof };
+    ruckig::InputParameter<ruckig::DynamicDOFs> ruckig_input = ruckig_limits;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const auto segment = static_cast<std::size_t>(segments[i]);
+      const Eigen::VectorXd& current_position = data.positions[segment];
+      const Eigen::VectorXd& current_velocity = data.velocities[segment];
+      const Eigen::VectorXd& current_acceleration = data.accelerations[segment];
+      const Eigen::VectorXd& next_position = data.positions[segment + 1];
+      const Eigen::VectorXd& next_velocity = data.velocities[segment + 1];
+      const Eigen::VectorXd& next_acceleration = data.accelerations[segment + 1];
+
+      ruckig_input.current_position.assign(current_position.data(), current_position.data() + current_position.rows());
+      ruckig_input.current_velocity.assign(current_velocity.data(), current_velocity.data() + current_velocity.rows());
+      ruckig_input.current_acceleration.assign(current_acceleration.data(),
+                                               current_acceleration.data() + current_acceleration.rows());
+      ruckig_input.target_position.assign(next_position.data(), next_position.data() + next_position.rows());
+      ruckig_input.target_velocity.assign(next_velocity.data(), next_velocity.data() + next_velocity.rows());
+      ruckig_input.target_acceleration.assign(next_acceleration.data(),
+                                              next_acceleration.data() + next_acceleration.rows());
+
+      // Offline calculation returns Working when successful
+      ruckig::Result result = otg.calculate(ruckig_input, ruckig_trajectory);
+      if (result == ruckig::Result::Working || result == ruckig::Result::Finished)
+      {
+        const auto s = static_cast<Eigen::Index>(segment);
+        const double duration = data.durations(s) * data.extension_factors(s);
+        result = (ruckig_trajectory.get_duration() <= duration) ? ruckig::Result::Finished : ruckig::Result::Working;
+      }
+      results[segment] = result;
+    }
+  };
+
+  // Rounds after the first usually only re-check a few segments which is faster than waking the workers
+  const std::size_t num_chunks = std::min(pool.getNumThreads(), segments.size() / MIN_SEGMENTS_PER_THREAD);
+  if (num_chunks < 2)
+  {
+    check(0, segments.size());
+    return;
+  }
+
+  const std::size_t chunk_size = (segments.size() + num_chunks - 1) / num_chunks;
+  pool.run(num_chunks, [&](std::size_t chunk) {
+    const std::size_t begin = chunk * chunk_size;
+    check(begin, std::min(begin + chunk_size, segments.size()));
+  });
+}
+
+/**
+ * @brief Smooth the trajectory by only extending the duration of the segments Ruckig is not able to complete
+ * @details The velocity and acceleration of a waypoint are scaled by the largest extension factor of its adjacent
+ * segments, so only segments sharing a modified waypoint need to be checked again.
+ */
+bool smoothLocal(TrajectoryContainer& trajectory,
+                 const ruckig::InputParameter<ruckig::DynamicDOFs>& ruckig_limits,
+                 const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
+                 const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
+                 double duration_extension_fraction,
+                 double max_duration_extension_factor,
+                 std::size_t num_threads)
+{
+  const Eigen::Index num_waypoints = trajectory.size();
+  const Eigen::Index num_segments = num_waypoints - 1;
+
+  LocalSmoothingData data;
+  data.positions.reserve(static_cast<std::size_t>(num_waypoints));
+  data.velocities.reserve(static_cast<std::size_t>(num_waypoints));
+  data.accelerations.reserve(static_cast<std::size_t>(num_waypoints));
+  data.durations.resize(num_segments);
+  data.extension_factors = Eigen::VectorXd::Ones(num_segments);
+  for (Eigen::Index i = 0; i < num_waypoints; ++i)
+  {
+    data.positions.push_back(trajectory.getPosition(i));
+    data.velocities.push_back(clampToLimits(trajectory.getVelocity(i), max_velocity));
+    data.accelerations.push_back(clampToLimits(trajectory.getAcceleration(i), max_acceleration));
+    if (i > 0)
+      data.durations(i - 1) = trajectory.getTimeFromStart(i) - trajectory.getTimeFromStart(i - 1);
+  }
+
+  // The start state is never modified
+  const std::vector<Eigen::VectorXd> original_velocities = data.velocities;
+  const std::vector<Eigen::VectorXd> original_accelerations = data.accelerations;
+
+  std::vector<ruckig::Result> results(static_cast<std::size_t>(num_segments), ruckig::Result::Working);
+  std::vector<Eigen::Index> segments(static_cast<std::size_t>(num_segments));
+  std::iota(segments.begin(), segments.end(), 0);
+
+  SegmentCheckPool pool(num_threads);
+  while (!segments.empty())
+  {
+    checkSegments(data, ruckig_limits, segments, results, pool);
+
+    std::vector<Eigen::Index> modified_waypoints;
+    for (const Eigen::Index segment : segments)
+    {
+      if (results[static_cast<std::size_t>(segment)] == ruckig::Result::Finished)
+        continue;
+
+      data.extension_factors(segment) *= duration_extension_fraction;
+      if (data.extension_factors(segment) >= max_duration_extension_factor)
+      {
+        CONSOLE_BRIDGE_logError("Ruckig trajectory smoothing failed. Segment %ld exceeded the max duration extension "
+                                "factor, Ruckig error: %d",
+                                segment,
+                                static_cast<int>(results[static_cast<std::size_t>(segment)]));
+        return false;
+      }
+
+      if (segment > 0)
+        modified_waypoints.push_back(segment);
+      modified_waypoints.push_back(segment + 1);
+    }
+
+    std::sort(modified_waypoints.begin(), modified_waypoints.end());
+    modified_waypoints.erase(std::unique(modified_waypoints.begin(), modified_waypoints.end()),
+                             modified_waypoints.end());
+
+    // Scale the waypoint states as if the surrounding region was uniformly slowed down
+    segments.clear();
+    for (const Eigen::Index waypoint : modified_waypoints)
+    {
+      double factor = data.extension_factors(waypoint - 1);
+      if (waypoint < num_segments)
+        factor = std::max(factor, data.extension_factors(waypoint));
+
+      const auto w = static_cast<std::size_t>(waypoint);
+      data.velocities[w] = original_velocities[w] / factor;
+      data.accelerations[w] = original_accelerations[w] / (factor * factor);
+
+      if (segments.empty() || segments.back() != waypoint - 1)
+        segments.push_back(waypoint - 1);
+      if (waypoint < num_segments)
+        segments.push_back(waypoint);
+    }
+  }
+
+  double time_from_start = trajectory.getTimeFromStart(0);
+  for (Eigen::Index i = 0; i < num_waypoints; ++i)
+  {
+    if (i > 0)
+      time_from_start += data.durations(i - 1) * data.extension_factors(i - 1);
+
+    const auto w = static_cast<std::size_t>(i);
+    trajectory.setData(i, data.velocities[w], data.accelerations[w], time_from_start);
+  }
+
+  return true;
+}
+
 bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
                                         const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
                                         const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
@@ -298,6 +604,17 @@ bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
         std::vector<double>(max_scaled_jerk.data(), max_scaled_jerk.data() + max_scaled_jerk.rows());
   }
 
+  if (mode_ == RuckigSmoothingMode::LOCAL)
+  {
+    return smoothLocal(trajectory,
+                       ruckig_input,
+                       max_scaled_velocity,
+                       max_scaled_acceleration,
+                       duration_extension_fraction_,
+                       max_duration_extension_factor_,
+                       num_threads_);
+  }
+
   // Get origina data
   std::vector<Eigen::VectorXd> original_velocities;
   std::vector<Eigen::VectorXd> original_accelerations;
@@ -0,0 +1,95 @@
+/**
+ * @file iterative_spline_benchmark.cpp
+ * @brief Benchmark the iterative spline parameterization on long rasters
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <cmath>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_time_parameterization/isp/iterative_spline_parameterization.h>
+#include <tesseract_time_parameterization/core/instructions_trajectory.h>
+
+using namespace tesseract_planning;
+
+/** @brief Create a six joint raster-like trajectory which oscillates between two positions */
+CompositeInstruction createLongRasterTrajectory(long num)
+{
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+
+  CompositeInstruction program;
+  for (long i = 0; i < num; i++)
+  {
+    StateWaypointPoly swp{ StateWaypoint(joint_names, Eigen::VectorXd::Zero(6)) };
+    for (Eigen::Index j = 0; j < 6; j++)
+      swp.getPosition()[j] = 0.01 * static_cast<double>(i) + 0.2 * std::sin(0.05 * static_cast<double>(i * (j + 1)));
+    program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+
+  return program;
+}
+
+/**
+ * @brief Time parameterize a raster with the number of points of the first argument
+ * @details The second argument enables the adaptive stretch
+ */
+static void BM_IterativeSplineLongRaster(benchmark::State& state)
+{
+  Eigen::VectorXd max_velocity(6);
+  max_velocity << 2.088, 2.082, 3.27, 3.6, 3.3, 3.078;
+  const Eigen::VectorXd max_acceleration = Eigen::VectorXd::Ones(6);
+  const CompositeInstruction raster = createLongRasterTrajectory(state.range(0));
+  const Eigen::VectorXd scaling_factors = Eigen::VectorXd::Ones(static_cast<Eigen::Index>(raster.size()));
+  const IterativeSplineParameterization time_parameterization(true, 0, state.range(1) != 0);
+
+  IterativeSplineParameterizationResult result;
+  double duration{ 0 };
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    CompositeInstruction program = raster;
+    InstructionsTrajectory trajectory(program);
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(time_parameterization.compute(
+        trajectory, max_velocity, max_acceleration, scaling_factors, scaling_factors, &result));
+
+    duration = program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime();
+  }
+
+  state.counters["iterations"] = static_cast<double>(result.iterations);
+  state.counters["max_stretch_gain"] = result.max_stretch_gain;
+  state.counters["duration"] = duration;
+}
+
+BENCHMARK(BM_IterativeSplineLongRaster)
+    ->ArgNames({ "points", "adaptive" })
+    ->ArgsProduct({ { 500, 2000, 8000 }, { 0, 1 } })
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
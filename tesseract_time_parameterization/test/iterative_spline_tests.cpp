@@ -88,6 +88,29 @@ CompositeInstruction createStraightTrajectory()
   return program;
 }
 
+// Initialize a long six-joint raster-like trajectory which oscillates between two positions
+CompositeInstruction createLongRasterTrajectory()
+{
+  const int num = 500;
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+
+  CompositeInstruction program;
+  for (int i = 0; i < num; i++)
+  {
+    StateWaypointPoly swp{ StateWaypoint(joint_names, Eigen::VectorXd::Zero(6)) };
+    for (Eigen::Index j = 0; j < 6; j++)
+      swp.getPosition()[j] = 0.01 * static_cast<double>(i) + 0.2 * std::sin(0.05 * static_cast<double>(i * (j + 1)));
+    program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+
+  return program;
+}
+
+double getDuration(const CompositeInstruction& program)
+{
+  return program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime();
+}
+
 TEST(IterativeSplineParameterizationUnit, Solve)  // NOLINT
 {
   EXPECT_TRUE(true);
@@ -152,6 +175,70 @@ TEST(TestTimeParameterization, TestRepeatedPoint)  // NOLINT
   ASSERT_LT(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 0.001);
 }
 
+TEST(TestTimeParameterization, TestIterativeSplineLongTrajectory)  // NOLINT
+{
+  Eigen::VectorXd max_velocity(6);
+  max_velocity << 2.088, 2.082, 3.27, 3.6, 3.3, 3.078;
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Ones(6);
+
+  CompositeInstruction program = createLongRasterTrajectory();
+  Eigen::VectorXd scaling_factors = Eigen::VectorXd::Ones(static_cast<Eigen::Index>(program.size()));
+
+  // Default fixed stretch
+  IterativeSplineParameterization time_parameterization(true);
+  IterativeSplineParameterizationResult result;
+  TrajectoryContainer::Ptr trajectory = std::make_shared<InstructionsTrajectory>(program);
+  EXPECT_TRUE(time_parameterization.compute(
+      *trajectory, max_velocity, max_acceleration, scaling_factors, scaling_factors, &result));
+  EXPECT_TRUE(result.converged);
+  EXPECT_GT(result.iterations, 0);
+  EXPECT_NEAR(result.max_stretch_gain, 1.0 / 16.0, 1e-12);
+  EXPECT_GE(result.global_adjustment_factor, 1.0);
+  const double duration = getDuration(program);
+
+  for (Eigen::Index i = 0; i < trajectory->size(); i++)
+  {
+    EXPECT_TRUE((trajectory->getVelocity(i).array().abs() <= max_velocity.array() + 1e-6).all());
+    EXPECT_TRUE((trajectory->getAcceleration(i).array().abs() <= max_acceleration.array() + 1e-6).all());
+  }
+
+  // Adaptive stretch requires fewer iterations and produces a similar duration
+  program = createLongRasterTrajectory();
+  IterativeSplineParameterization adaptive_time_parameterization(true, 1000, true);
+  IterativeSplineParameterizationResult adaptive_result;
+  trajectory = std::make_shared<InstructionsTrajectory>(program);
+  EXPECT_TRUE(adaptive_time_parameterization.compute(
+      *trajectory, max_velocity, max_acceleration, scaling_factors, scaling_factors, &adaptive_result));
+  EXPECT_TRUE(adaptive_result.converged);
+  EXPECT_LT(adaptive_result.iterations, result.iterations);
+  EXPECT_GT(adaptive_result.max_stretch_gain, result.max_stretch_gain);
+  EXPECT_NEAR(getDuration(program), duration, 0.1 * duration);
+
+  for (Eigen::Index i = 0; i < trajectory->size(); i++)
+  {
+    EXPECT_TRUE((trajectory->getVelocity(i).array().abs() <= max_velocity.array() + 1e-6).all());
+    EXPECT_TRUE((trajectory->getAcceleration(i).array().abs() <= max_acceleration.array() + 1e-6).all());
+  }
+
+  // Reaching the iteration cap still produces a trajectory within bounds
+  program = createLongRasterTrajectory();
+  IterativeSplineParameterization capped_time_parameterization(true, 1);
+  IterativeSplineParameterizationResult capped_result;
+  trajectory = std::make_shared<InstructionsTrajectory>(program);
+  EXPECT_TRUE(capped_time_parameterization.compute(
+      *trajectory, max_velocity, max_acceleration, scaling_factors, scaling_factors, &capped_result));
+  EXPECT_FALSE(capped_result.converged);
+  EXPECT_EQ(capped_result.iterations, 1);
+  EXPECT_GT(capped_result.global_adjustment_factor, result.global_adjustment_factor);
+  EXPECT_GE(getDuration(program), duration);
+
+  for (Eigen::Index i = 0; i < trajectory->size(); i++)
+  {
+    EXPECT_TRUE((trajectory->getVelocity(i).array().abs() <= max_velocity.array() + 1e-6).all());
+    EXPECT_TRUE((trajectory->getAcceleration(i).array().abs() <= max_acceleration.array() + 1e-6).all());
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
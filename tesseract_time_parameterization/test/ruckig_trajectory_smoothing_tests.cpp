@@ -139,6 +139,39 @@ TEST(RuckigTrajectorySmoothingTest, RuckigTrajectorySmoothingRepeatedPointSolve)
   ASSERT_LT(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 0.001);
 }
 
+TEST(RuckigTrajectorySmoothingTest, RuckigTrajectorySmoothingLocalSolve)  // NOLINT
+{
+  std::vector<double> max_velocity = { 2.088, 2.082, 3.27, 3.6, 3.3, 3.078 };
+  std::vector<double> max_acceleration = { 1, 1, 1, 1, 1, 1 };
+  std::vector<double> max_jerk = { 1000, 1000, 1000, 1000, 1000, 1000 };
+
+  std::vector<double> durations;
+  for (std::size_t num_threads : { 1, 4 })
+  {
+    IterativeSplineParameterization time_parameterization(false);
+    CompositeInstruction program = createStraightTrajectory();
+    TrajectoryContainer::Ptr trajectory = std::make_shared<InstructionsTrajectory>(program);
+    EXPECT_TRUE(time_parameterization.compute(*trajectory, max_velocity, max_acceleration));
+    const double original_duration =
+        program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime();
+
+    RuckigTrajectorySmoothing traj_smoothing;
+    traj_smoothing.setSmoothingMode(RuckigSmoothingMode::LOCAL);
+    traj_smoothing.setNumThreads(num_threads);
+    EXPECT_TRUE(traj_smoothing.compute(*trajectory, max_velocity, max_acceleration, max_jerk));
+    EXPECT_TRUE(trajectory->isTimeStrictlyIncreasing());
+
+    // Only the failing segments are extended
+    const double duration = program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime();
+    EXPECT_GE(duration, original_duration);
+    EXPECT_LT(duration, 8.0);
+    durations.push_back(duration);
+  }
+
+  // The result does not depend on the number of threads
+  EXPECT_DOUBLE_EQ(durations[0], durations[1]);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,85 @@
+/**
+ * @file time_optimal_trajectory_generation_benchmark.cpp
+ * @brief Benchmark the fixed and adaptive integration time step of the time optimal trajectory generation
+ *
+ * @author Levi Armstrong
+ * @date October 19, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Southwest Research Institute
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <cmath>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_time_parameterization/totg/time_optimal_trajectory_generation.h>
+
+using namespace tesseract_planning::totg;
+
+/** @brief The approximate size of a trajectory step list node, the step data and two list pointers */
+const double STEP_SIZE_BYTES = 3 * sizeof(double) + 2 * sizeof(void*);
+
+/** @brief Create a smooth six joint path */
+std::list<Eigen::VectorXd> createWaypoints()
+{
+  std::list<Eigen::VectorXd> waypoints;
+  for (int i = 0; i < 50; ++i)
+  {
+    Eigen::VectorXd waypoint(6);
+    for (Eigen::Index j = 0; j < 6; ++j)
+      waypoint[j] = std::sin(0.1 * i + static_cast<double>(j)) * (1.0 + 0.1 * static_cast<double>(j));
+    waypoints.push_back(waypoint);
+  }
+  return waypoints;
+}
+
+/**
+ * @brief Generate the trajectory with the limits scaled by the first argument in percent
+ * @details The adaptive tolerance is the second argument in micro units, zero uses the fixed time step
+ */
+static void BM_TrajectoryTimeStep(benchmark::State& state)
+{
+  const Path path(createWaypoints(), 0.1);
+  const double scale = static_cast<double>(state.range(0)) / 100.0;
+  const double adaptive_tolerance = static_cast<double>(state.range(1)) * 1e-6;
+  const Eigen::VectorXd max_velocities = Eigen::VectorXd::Constant(6, 2.0 * scale);
+  const Eigen::VectorXd max_accelerations = Eigen::VectorXd::Constant(6, 5.0 * scale);
+
+  std::size_t steps{ 0 };
+  double duration{ 0 };
+  for (auto _ : state)
+  {
+    Trajectory trajectory(path, max_velocities, max_accelerations, 0.001, adaptive_tolerance, 0.00001, 0.01);
+    steps = trajectory.getStepCount();
+    duration = trajectory.getDuration();
+    benchmark::DoNotOptimize(duration);
+  }
+
+  state.counters["steps"] = static_cast<double>(steps);
+  state.counters["memory_bytes"] = static_cast<double>(steps) * STEP_SIZE_BYTES;
+  state.counters["duration"] = duration;
+}
+
+BENCHMARK(BM_TrajectoryTimeStep)
+    ->ArgNames({ "scale_percent", "tolerance_micro" })
+    ->ArgsProduct({ { 100, 5, 1 }, { 0, 100, 1000 } })
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
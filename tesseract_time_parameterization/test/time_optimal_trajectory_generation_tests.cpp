@@ -374,6 +374,42 @@ TEST(time_optimal_trajectory_generation, testTrajectoryContainerInterface)  // N
   runTrajectoryContainerInterfaceTest(0.0001);
 }
 
+TEST(time_optimal_trajectory_generation, testAdaptiveTimeStep)  // NOLINT
+{
+  std::list<Eigen::VectorXd> waypoints;
+  for (int i = 0; i < 50; ++i)
+  {
+    Eigen::VectorXd waypoint(6);
+    for (Eigen::Index j = 0; j < 6; ++j)
+      waypoint[j] = std::sin(0.1 * i + static_cast<double>(j)) * (1.0 + 0.1 * static_cast<double>(j));
+    waypoints.push_back(waypoint);
+  }
+
+  // Slow limits result in a long trajectory which requires many fixed integration steps
+  Eigen::VectorXd max_velocities = Eigen::VectorXd::Constant(6, 0.1);
+  Eigen::VectorXd max_accelerations = Eigen::VectorXd::Constant(6, 0.25);
+
+  Trajectory fixed_trajectory(Path(waypoints, 0.1), max_velocities, max_accelerations, 0.001);
+  EXPECT_TRUE(fixed_trajectory.isValid());
+
+  Trajectory adaptive_trajectory(Path(waypoints, 0.1), max_velocities, max_accelerations, 0.001, 0.001, 0.00001, 0.01);
+  EXPECT_TRUE(adaptive_trajectory.isValid());
+  EXPECT_LT(adaptive_trajectory.getStepCount() * 5, fixed_trajectory.getStepCount());
+  EXPECT_NEAR(adaptive_trajectory.getDuration(), fixed_trajectory.getDuration(), 1e-4 * fixed_trajectory.getDuration());
+
+  // Test end matches
+  PathData path_data = adaptive_trajectory.getPathData(adaptive_trajectory.getDuration());
+  Eigen::VectorXd position = adaptive_trajectory.getPosition(path_data);
+  EXPECT_TRUE(position.isApprox(waypoints.back(), 1e-8));
+
+  // Test the velocity limits are respected
+  for (double t = 0; t < adaptive_trajectory.getDuration(); t += 0.1)
+  {
+    Eigen::VectorXd velocity = adaptive_trajectory.getVelocity(adaptive_trajectory.getPathData(t));
+    EXPECT_LE(velocity.cwiseAbs().maxCoeff(), 0.1 + 1e-6);
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
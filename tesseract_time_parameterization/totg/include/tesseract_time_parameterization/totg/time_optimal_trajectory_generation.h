@@ -53,7 +53,21 @@ namespace tesseract_planning
 class TimeOptimalTrajectoryGeneration
 {
 public:
-  TimeOptimalTrajectoryGeneration(double path_tolerance = 0.1, double min_angle_change = 0.001);
+  /**
+   * @brief Construct the time optimal trajectory generation
+   * @param path_tolerance The maximum deviation allowed when blending the path corners
+   * @param min_angle_change At least one joint must change by greater than this amount for the point to be added
+   * @param time_step The time step used when integrating forward and backward, the initial step if adaptive
+   * @param adaptive_tolerance The maximum path velocity error per integration step, if zero a fixed step is used
+   * @param min_time_step The smallest time step allowed when adaptive
+   * @param max_time_step The largest time step allowed when adaptive
+   */
+  TimeOptimalTrajectoryGeneration(double path_tolerance = 0.1,
+                                  double min_angle_change = 0.001,
+                                  double time_step = 0.001,
+                                  double adaptive_tolerance = 0.0,
+                                  double min_time_step = 0.00001,
+                                  double max_time_step = 0.01);
 
   bool computeTimeStamps(TrajectoryContainer& trajectory,
                          const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
@@ -64,6 +78,10 @@ public:
 private:
   double path_tolerance_;
   double min_angle_change_;
+  double time_step_;
+  double adaptive_tolerance_;
+  double min_time_step_;
+  double max_time_step_;
 };
 
 namespace totg
@@ -138,7 +156,12 @@ public:
    * @param path Path that will be parameterized
    * @param max_velocity Maximum velocity per joint
    * @param max_acceleration Maximum acceleration per joint
-   * @param time_step Time step used when integrating forward and backward
+   * @param time_step Time step used when integrating forward and backward, the initial step if adaptive
+   * @param adaptive_tolerance The maximum path velocity error per integration step, if zero a fixed step is used.
+   * The error is estimated from the change in path acceleration over the step, the step is shrunk when it is exceeded
+   * and grown when the path acceleration is nearly constant such as when following the velocity limit.
+   * @param min_time_step The smallest time step allowed when adaptive
+   * @param max_time_step The largest time step allowed when adaptive
    * @bug A negative path velocity error will occur if the path contains points that are close to but not equal to the
    * start or end point. A workaround (implemented in TimeOptimalTrajectoryGeneration::computeTimesteps) is to append an
    * extra joint that increments such that no point is ever repeated. See
@@ -147,7 +170,10 @@ public:
   Trajectory(const Path& path,
              const Eigen::VectorXd& max_velocity,
              const Eigen::VectorXd& max_acceleration,
-             double time_step = 0.001);
+             double time_step = 0.001,
+             double adaptive_tolerance = 0.0,
+             double min_time_step = 0.00001,
+             double max_time_step = 0.01);
 
   /** @brief Call this method after constructing the object to make sure the
      trajectory generation succeeded without errors. If this method returns
@@ -168,6 +194,9 @@ public:
   /** @brief get the time given a position on the trajectory */
   double getTime(double pos) const;
 
+  /** @brief Get the number of integration steps stored in the trajectory */
+  std::size_t getStepCount() const;
+
   /**
    * @brief Assign trajectory velocity acceleration and time
    * @details This is brute force approach and should always return true
@@ -210,6 +239,14 @@ private:
   double getAccelerationMaxPathVelocityDeriv(double path_pos);
   double getVelocityMaxPathVelocityDeriv(double path_pos);
 
+  /**
+   * @brief Get the adaptive time step following a step
+   * @param time_step The time step just taken
+   * @param error The estimated path velocity error of the step
+   * @return The time step to take next, or to retry with if the step is rejected
+   */
+  double getNextTimeStep(double time_step, double error) const;
+
   std::list<TrajectoryStep>::const_iterator getTrajectorySegment(double time) const;
   std::list<TrajectoryStep>::const_iterator getTrajectorySegmentFromDist(double pos) const;
 
@@ -222,6 +259,9 @@ private:
   std::list<TrajectoryStep> end_trajectory_;  // non-empty only if the trajectory generation failed.
 
   const double time_step_;
+  const double adaptive_tolerance_;
+  const double min_time_step_;
+  const double max_time_step_;
 
   mutable double cached_time_;
   mutable std::list<TrajectoryStep>::const_iterator cached_trajectory_segment_;
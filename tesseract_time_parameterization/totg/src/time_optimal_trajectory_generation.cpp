@@ -54,8 +54,18 @@ constexpr double EPS = 0.000001;
 
 namespace tesseract_planning
 {
-TimeOptimalTrajectoryGeneration::TimeOptimalTrajectoryGeneration(double path_tolerance, double min_angle_change)
-  : path_tolerance_(path_tolerance), min_angle_change_(min_angle_change)
+TimeOptimalTrajectoryGeneration::TimeOptimalTrajectoryGeneration(double path_tolerance,
+                                                                 double min_angle_change,
+                                                                 double time_step,
+                                                                 double adaptive_tolerance,
+                                                                 double min_time_step,
+                                                                 double max_time_step)
+  : path_tolerance_(path_tolerance)
+  , min_angle_change_(min_angle_change)
+  , time_step_(time_step)
+  , adaptive_tolerance_(adaptive_tolerance)
+  , min_time_step_(min_time_step)
+  , max_time_step_(max_time_step)
 {
 }
 
@@ -175,7 +185,13 @@ bool TimeOptimalTrajectoryGeneration::computeTimeStamps(TrajectoryContainer& tra
 
   // Now actually call the algorithm
   totg::Path path(new_points, path_tolerance_);
-  totg::Trajectory parameterized(path, max_velocity_dummy_appended, max_acceleration_dummy_appended, 0.001);
+  totg::Trajectory parameterized(path,
+                                 max_velocity_dummy_appended,
+                                 max_acceleration_dummy_appended,
+                                 time_step_,
+                                 adaptive_tolerance_,
+                                 min_time_step_,
+                                 max_time_step_);
   if (!parameterized.isValid())
   {
     CONSOLE_BRIDGE_logError("Unable to parameterize trajectory.");
@@ -448,12 +464,18 @@ std::list<std::pair<double, bool>> Path::getSwitchingPoints() const { return swi
 Trajectory::Trajectory(const Path& path,
                        const Eigen::VectorXd& max_velocity,
                        const Eigen::VectorXd& max_acceleration,  // NOLINT
-                       double time_step)
+                       double time_step,
+                       double adaptive_tolerance,
+                       double min_time_step,
+                       double max_time_step)
   : path_(path)
   , max_velocity_(max_velocity)
   , max_acceleration_(max_acceleration)
   , joint_num_(max_velocity.size())
   , time_step_(time_step)
+  , adaptive_tolerance_(adaptive_tolerance)
+  , min_time_step_(std::min(min_time_step, time_step))
+  , max_time_step_(std::max(max_time_step, time_step))
   , cached_time_(std::numeric_limits<double>::max())
 {
   trajectory_.emplace_back(0.0, 0.0);
@@ -656,6 +678,7 @@ bool Trajectory::integrateForward(std::list<TrajectoryStep>& trajectory, double
 
   std::list<std::pair<double, bool>> switching_points = path_.getSwitchingPoints();
   auto next_discontinuity = switching_points.begin();
+  double time_step = time_step_;
 
   while (true)
   {
@@ -668,8 +691,23 @@ bool Trajectory::integrateForward(std::list<TrajectoryStep>& trajectory, double
     double old_path_pos = path_pos;
     double old_path_vel = path_vel;
 
-    path_vel += time_step_ * acceleration;
-    path_pos += time_step_ * 0.5 * (old_path_vel + path_vel);
+    path_vel += time_step * acceleration;
+    path_pos += time_step * 0.5 * (old_path_vel + path_vel);
+
+    if (adaptive_tolerance_ > 0.0 && path_pos < path_.getLength())
+    {
+      // The step assumes a constant acceleration so its error is proportional to the change in acceleration
+      const double error =
+          0.5 * time_step * std::abs(getMinMaxPathAcceleration(path_pos, path_vel, true) - acceleration);
+      const bool accept = (error <= adaptive_tolerance_ || time_step <= min_time_step_);
+      time_step = getNextTimeStep(time_step, error);
+      if (!accept)
+      {
+        path_pos = old_path_pos;
+        path_vel = old_path_vel;
+        continue;
+      }
+    }
 
     if (next_discontinuity != switching_points.end() && path_pos > next_discontinuity->first)
     {
@@ -778,16 +816,33 @@ void Trajectory::integrateBackward(std::list<TrajectoryStep>& start_trajectory,
   --start1;
   std::list<TrajectoryStep> trajectory;
   double slope{ 0 };
+  double time_step = time_step_;
   assert(start1->path_pos_ < path_pos || tesseract_common::almostEqualRelativeAndAbs(start1->path_pos_, path_pos, EPS));
 
   while (start1 != start_trajectory.begin() || path_pos >= 0.0)
   {
     if (start1->path_pos_ < path_pos || tesseract_common::almostEqualRelativeAndAbs(start1->path_pos_, path_pos, EPS))
     {
+      const double old_acceleration = acceleration;
       trajectory.push_front(TrajectoryStep(path_pos, path_vel));
-      path_vel -= time_step_ * acceleration;
-      path_pos -= time_step_ * 0.5 * (path_vel + trajectory.front().path_vel_);
+      path_vel -= time_step * acceleration;
+      path_pos -= time_step * 0.5 * (path_vel + trajectory.front().path_vel_);
       acceleration = getMinMaxPathAcceleration(path_pos, path_vel, false);
+
+      if (adaptive_tolerance_ > 0.0)
+      {
+        const double error = 0.5 * time_step * std::abs(acceleration - old_acceleration);
+        const bool accept = (error <= adaptive_tolerance_ || time_step <= min_time_step_);
+        time_step = getNextTimeStep(time_step, error);
+        if (!accept)
+        {
+          path_pos = trajectory.front().path_pos_;
+          path_vel = trajectory.front().path_vel_;
+          acceleration = old_acceleration;
+          trajectory.pop_front();
+          continue;
+        }
+      }
       slope = (trajectory.front().path_vel_ - path_vel) / (trajectory.front().path_pos_ - path_pos);
 
       if (path_vel < 0.0)
@@ -932,10 +987,19 @@ double Trajectory::getVelocityMaxPathVelocityDeriv(double path_pos)
          (tangent[active_constraint] * std::abs(tangent[active_constraint]));
 }
 
+double Trajectory::getNextTimeStep(double time_step, double error) const
+{
+  // The error of a step is quadratic in the time step, scale it towards the tolerance with a safety factor
+  const double factor = (error > 0.0) ? 0.9 * std::sqrt(adaptive_tolerance_ / error) : 5.0;
+  return std::clamp(time_step * std::clamp(factor, 0.2, 5.0), min_time_step_, max_time_step_);
+}
+
 bool Trajectory::isValid() const { return valid_; }
 
 double Trajectory::getDuration() const { return trajectory_.back().time_; }
 
+std::size_t Trajectory::getStepCount() const { return trajectory_.size(); }
+
 bool Trajectory::assignData(TrajectoryContainer& trajectory, const std::vector<std::size_t>& mapping) const
 {
   const auto& dist_mapping = path_.getMapping();